@@ -470,6 +470,18 @@ namespace hyperion::concepts {
 	template<typename T>
 	concept NotNoexceptCopyable = (!NoexceptCopyable<T>);
 
+	/// @brief Concept that requires that `T` is trivially copyable
+	/// @ingroup concepts
+	/// @headerfile "Hyperion/Concepts.h"
+	template<typename T>
+	concept TriviallyCopyable = std::is_trivially_copyable_v<T>;
+
+	/// @brief Concept that requires that `T` is __NOT__ trivially copyable
+	/// @ingroup concepts
+	/// @headerfile "Hyperion/Concepts.h"
+	template<typename T>
+	concept NotTriviallyCopyable = (!TriviallyCopyable<T>);
+
 	/// @brief Concept that requires that `T` is move constructible and move assignable
 	/// @ingroup concepts
 	/// @headerfile "Hyperion/Concepts.h"
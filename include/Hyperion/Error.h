@@ -31,12 +31,16 @@
 #include <Hyperion/Ignore.h>
 #include <Hyperion/Memory.h>
 #include <Hyperion/error/SystemDomain.h>
+#include <array>
+#include <cstddef>
 #include <cstring>
 #include <gsl/gsl>
 #include <memory>
+#include <new>
 #include <string>
 #include <system_error>
 #include <type_traits>
+#include <utility>
 
 ///	@defgroup error Error
 /// The Error module provides various types and facilities that make communicating and handling
@@ -103,6 +107,37 @@ namespace hyperion::error {
 		/// @brief Move assignment operator
 		/// @ingroup error
 		constexpr auto operator=(ErrorBase&&) noexcept -> ErrorBase& = default;
+
+		/// @brief Allocates heap-held errors (e.g. those owned by `AnyError`) from the
+		/// allocating thread's `ThreadCache`, since errors are often created on one thread and
+		/// dropped on another
+		/// @ingroup error
+		[[nodiscard]] static inline auto operator new(usize size) noexcept -> void* {
+			return ThreadCachingHeap::allocate(size);
+		}
+
+		/// @brief Returns the memory of a heap-held error to the `ThreadCache` it was allocated
+		/// from
+		/// @ingroup error
+		static inline auto operator delete(void* ptr, usize size) noexcept -> void {
+			ThreadCachingHeap::deallocate(ptr, size);
+		}
+
+		/// @brief Allocates heap-held errors aligned more strictly than
+		/// `__STDCPP_DEFAULT_NEW_ALIGNMENT__`, honoring their alignment
+		/// @ingroup error
+		[[nodiscard]] static inline auto
+		operator new(usize size, std::align_val_t alignment) noexcept -> void* {
+			return ThreadCachingHeap::allocate(size, static_cast<usize>(alignment));
+		}
+
+		/// @brief Returns the memory of an over-aligned heap-held error to where it was
+		/// allocated from
+		/// @ingroup error
+		static inline auto
+		operator delete(void* ptr, usize size, std::align_val_t alignment) noexcept -> void {
+			ThreadCachingHeap::deallocate(ptr, size, static_cast<usize>(alignment));
+		}
 	};
 
 	IGNORE_WEAK_VTABLES_STOP
@@ -126,14 +161,7 @@ namespace hyperion::error {
 		/// @brief Constructs a default `Error` with an error code representing an
 		/// unknown error
 		/// @ingroup error
-		constexpr Error() noexcept {
-
-			if constexpr(StatusCodeEnum<value_type>) {
-				m_error_code = make_error_code(static_cast<value_type>(-1));
-			}
-			else {
-				m_error_code = make_error_code<Domain>(static_cast<value_type>(-1));
-			}
+		constexpr Error() noexcept : m_error_code(unknown_error_code()) {
 		}
 
 		/// @brief Constructs an `Error` from the given `ErrorCode<Domain>`
@@ -204,13 +232,34 @@ namespace hyperion::error {
 			}
 		}
 
+		/// @brief Returns the error message associated with this `Error`, without allocating
+		///
+		/// # Requirements
+		/// * `Domain` must be a `StatusCodeDomainWithMessageView`
+		///
+		/// @return The error message, valid for the lifetime of the program
+		/// @ingroup error
+		[[nodiscard]] inline constexpr auto message_view() const noexcept -> std::string_view
+		requires StatusCodeDomainWithMessageView<Domain>
+		{
+			return m_error_code.message_view();
+		}
+
 		/// @brief Returns the error message associated with this `Error`, as a cstring
 		///
-		/// @return The error message
+		/// This relies on `Domain::message_view` upholding the null-termination requirement of
+		/// `StatusCodeDomainWithMessageView`: a domain returning views that aren't null-terminated
+		/// makes reading the returned string run past the end of the message
+		///
+		/// # Requirements
+		/// * `Domain` must be a `StatusCodeDomainWithMessageView`
+		///
+		/// @return The error message, valid for the lifetime of the program
 		/// @ingroup error
-		[[nodiscard]] inline HYPERION_CONSTEXPR_STRINGS auto message_as_cstr() const noexcept
-			-> const char* {
-			return m_error_code.message().c_str();
+		[[nodiscard]] inline constexpr auto message_as_cstr() const noexcept -> const char*
+		requires StatusCodeDomainWithMessageView<Domain>
+		{
+			return m_error_code.message_view().data();
 		}
 
 		/// @brief Gets the `std::string` representation of this `Error`
@@ -219,7 +268,12 @@ namespace hyperion::error {
 		/// @ingroup error
 		[[nodiscard]] inline HYPERION_CONSTEXPR_STRINGS auto to_string() const noexcept
 			-> std::string final {
-			return fmt::format("Error: {}", m_error_code.message());
+			if constexpr(StatusCodeDomainWithMessageView<Domain>) {
+				return fmt::format("Error: {}", m_error_code.message_view());
+			}
+			else {
+				return fmt::format("Error: {}", m_error_code.message());
+			}
 		}
 
 		/// @brief Makes a copy of this error
@@ -341,6 +395,16 @@ namespace hyperion::error {
 		}
 
 	  private:
+		[[nodiscard]] static inline constexpr auto unknown_error_code() noexcept
+			-> ErrorCode<Domain> {
+			if constexpr(StatusCodeEnum<value_type>) {
+				return make_error_code(static_cast<value_type>(-1));
+			}
+			else {
+				return make_error_code<Domain>(static_cast<value_type>(-1));
+			}
+		}
+
 		template<usize Index, typename T>
 		constexpr auto get_impl(T && val) const noexcept {
 
@@ -433,16 +497,140 @@ namespace hyperion::error {
 	template<typename E>
 	concept NotErrorType = (!ErrorType<E>);
 
+	namespace detail::any_error {
+		/// @brief The size of `AnyError`'s inline storage. Large enough to hold the `Error`s of
+		/// the built-in `StatusCodeDomain`s, which are just a domain id and an integer code
+		static constexpr usize INLINE_SIZE = 4_usize * sizeof(void*);
+		/// @brief The alignment of `AnyError`'s inline storage
+		static constexpr usize INLINE_ALIGNMENT = alignof(std::max_align_t);
+
+		/// @brief Whether an `E` is stored inline in an `AnyError`, instead of on the heap
+		template<typename E>
+		static constexpr bool stored_inline = sizeof(E) <= INLINE_SIZE
+											  && alignof(E) <= INLINE_ALIGNMENT
+											  && std::is_nothrow_move_constructible_v<E>;
+
+		/// @brief Manual vtable for the error held by an `AnyError`.
+		///
+		/// Each function receives the `AnyError`'s storage, which holds either the error itself
+		/// or (if the error isn't `stored_inline`) a pointer to it
+		struct VTable {
+			using message_view_function = auto (*)(const void* storage) noexcept
+										  -> std::string_view;
+
+			auto (*message)(const void* storage) noexcept -> std::string;
+			/// `nullptr` if the error doesn't provide `message_view`
+			message_view_function message_view;
+			auto (*value)(const void* storage) noexcept -> i64;
+			auto (*copy)(void* dest, const void* src) noexcept -> void;
+			auto (*move)(void* dest, void* src) noexcept -> void;
+			auto (*destroy)(void* storage) noexcept -> void;
+			bool is_inline;
+		};
+
+		template<typename E>
+		[[nodiscard]] inline auto get(void* storage) noexcept -> E& {
+			if constexpr(stored_inline<E>) {
+				return *std::launder(static_cast<E*>(storage));
+			}
+			else {
+				return **std::launder(static_cast<E**>(storage));
+			}
+		}
+
+		template<typename E>
+		[[nodiscard]] inline auto get(const void* storage) noexcept -> const E& {
+			if constexpr(stored_inline<E>) {
+				return *std::launder(static_cast<const E*>(storage));
+			}
+			else {
+				return **std::launder(static_cast<E* const*>(storage));
+			}
+		}
+
+		template<typename E, typename... Args>
+		inline auto construct(void* storage, Args&&... args) noexcept -> void {
+			if constexpr(stored_inline<E>) {
+				std::construct_at(static_cast<E*>(storage), std::forward<Args>(args)...);
+			}
+			else {
+				// NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+				std::construct_at(static_cast<E**>(storage), new E(std::forward<Args>(args)...));
+			}
+		}
+
+		template<typename E>
+		inline auto destroy(void* storage) noexcept -> void {
+			if constexpr(stored_inline<E>) {
+				std::destroy_at(std::launder(static_cast<E*>(storage)));
+			}
+			else {
+				auto* error = *std::launder(static_cast<E**>(storage));
+				if(error != nullptr) {
+					delete error; // NOLINT(cppcoreguidelines-owning-memory)
+				}
+			}
+		}
+
+		/// @brief The `VTable` for an `AnyError` holding an `E`
+		template<typename E>
+		static constexpr auto vtable = VTable{
+			.message = [](const void* storage) noexcept -> std::string {
+				return get<E>(storage).message();
+			},
+			.message_view = []() noexcept -> VTable::message_view_function {
+				if constexpr(requires(const E& error) { error.message_view(); }) {
+					return [](const void* storage) noexcept -> std::string_view {
+						return get<E>(storage).message_view();
+					};
+				}
+				else {
+					return nullptr;
+				}
+			}(),
+			.value = [](const void* storage) noexcept -> i64 {
+				const auto& code = get<E>(storage).code();
+				if constexpr(requires { static_cast<i64>(code.code()); }) {
+					return static_cast<i64>(code.code());
+				}
+				else {
+					return -1_i64;
+				}
+			},
+			.copy = [](void* dest, const void* src) noexcept -> void {
+				construct<E>(dest, get<E>(src));
+			},
+			.move = [](void* dest, void* src) noexcept -> void {
+				if constexpr(stored_inline<E>) {
+					construct<E>(dest, std::move(get<E>(src)));
+				}
+				else {
+					std::construct_at(static_cast<E**>(dest),
+									  std::exchange(*std::launder(static_cast<E**>(src)), nullptr));
+				}
+			},
+			.destroy = [](void* storage) noexcept -> void { destroy<E>(storage); },
+			.is_inline = stored_inline<E>};
+	} // namespace detail::any_error
+
 	IGNORE_WEAK_VTABLES_START
 
+	IGNORE_PADDING_START
 	/// @brief `AnyError` represents a type erased error from any
 	/// `error::StatusCodeDomain`
+	///
+	/// Errors from domains whose `Error` fits in a small inline buffer (including
+	/// `PosixDomain`, `GenericDomain` and `SystemDomain`) are stored inline, so creating, copying
+	/// and moving an `AnyError` holding one doesn't allocate. Larger errors are stored on the
+	/// heap.
 	/// @ingroup error
 	class [[nodiscard("An error should not be discarded")]] AnyError final : public ErrorBase {
 	  public:
 		/// @brief Constructs an `AnyError` as an unknown error
 		/// @ingroup error
-		HYPERION_CONSTEXPR_STRINGS AnyError() noexcept = default;
+		inline AnyError() noexcept {
+			construct<SystemError>();
+		}
 
 		/// @brief Constructs an `AnyError` from the given `error::ErrorCode<Domain>`
 		///
@@ -451,8 +639,8 @@ namespace hyperion::error {
 		/// @param code - The error code this `AnyError` should represent
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS AnyError(const ErrorCode<Domain>& code) noexcept // NOLINT
-			: m_error(hyperion::make_unique<Error<Domain>>(code)) {
+		inline AnyError(const ErrorCode<Domain>& code) noexcept { // NOLINT
+			construct<Error<Domain>>(code);
 		}
 
 		/// @brief Constructs an `AnyError` from the given `error::ErrorCode<Domain>`
@@ -462,8 +650,8 @@ namespace hyperion::error {
 		/// @param code - The error code this `AnyError` should represent
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS AnyError(ErrorCode<Domain> && code) noexcept // NOLINT
-			: m_error(hyperion::make_unique<Error<Domain>>(std::move(code))) {
+		inline AnyError(ErrorCode<Domain> && code) noexcept { // NOLINT
+			construct<Error<Domain>>(std::move(code));
 		}
 
 		/// @brief Constructs an `AnyError` from the given `error::Error<Domain>`
@@ -473,8 +661,8 @@ namespace hyperion::error {
 		/// @param error - The error this `AnyError` should represent
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS AnyError(const Error<Domain>& error) noexcept // NOLINT
-			: m_error(hyperion::make_unique<Error<Domain>>(error)) {
+		inline AnyError(const Error<Domain>& error) noexcept { // NOLINT
+			construct<Error<Domain>>(error);
 		}
 
 		/// @brief Constructs an `AnyError` from the given `error::Error<Domain>`
@@ -484,37 +672,62 @@ namespace hyperion::error {
 		/// @param error - The error this `AnyError` should represent
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS AnyError(Error<Domain> && error) noexcept // NOLINT
-			: m_error(hyperion::make_unique<Error<Domain>>(std::move(error))) {
+		inline AnyError(Error<Domain> && error) noexcept { // NOLINT
+			construct<Error<Domain>>(std::move(error));
 		}
 		/// @brief Copy-constructs an `AnyError` from the given one
 		/// @ingroup error
-		HYPERION_CONSTEXPR_STRINGS AnyError(const AnyError& error) noexcept
-			: m_error(error.m_error->clone()) {
+		inline AnyError(const AnyError& error) noexcept
+			: ErrorBase(error), m_vtable(error.m_vtable) {
+			m_vtable->copy(m_storage.data(), error.m_storage.data());
 		}
-		/// @brief Move-constructs an `AnyError` from the given one
+		/// @brief Move-constructs an `AnyError` from the given one. `error` is left holding an
+		/// unknown error
 		/// @ingroup error
-		HYPERION_CONSTEXPR_STRINGS AnyError(AnyError &&) noexcept = default;
+		inline AnyError(AnyError && error) noexcept
+			: ErrorBase(std::move(error)), m_vtable(error.m_vtable) {
+			m_vtable->move(m_storage.data(), error.m_storage.data());
+			error.reset();
+		}
 		/// @brief Destroys this `AnyError`
 		/// @ingroup error
-		HYPERION_CONSTEXPR_STRINGS ~AnyError() noexcept final = default;
+		inline ~AnyError() noexcept final {
+			m_vtable->destroy(m_storage.data());
+		}
 
 		/// @brief Returns the error message associated with the error code this
 		/// represents
 		/// @return The error code message
 		/// @ingroup error
-		[[nodiscard]] inline HYPERION_CONSTEXPR_STRINGS auto message() const noexcept
-			-> std::string final {
-			return m_error->message();
+		[[nodiscard]] inline auto message() const noexcept -> std::string final {
+			return m_vtable->message(m_storage.data());
+		}
+
+		/// @brief Returns whether the held error provides an allocation-free `message_view`
+		/// @return `true` if `message_view` returns the error's message
+		/// @ingroup error
+		[[nodiscard]] inline auto has_message_view() const noexcept -> bool {
+			return m_vtable->message_view != nullptr;
+		}
+
+		/// @brief Returns the error message associated with the held error, without allocating
+		///
+		/// @return The error message if `has_message_view()`, otherwise an empty view
+		/// @ingroup error
+		[[nodiscard]] inline auto message_view() const noexcept -> std::string_view {
+			if(m_vtable->message_view == nullptr) {
+				return {};
+			}
+
+			return m_vtable->message_view(m_storage.data());
 		}
 
 		/// @brief Returns the string representation of this `AnyError`
 		/// @return this `AnyError` as a `std::string`
 		/// @ingroup error
-		[[nodiscard]] inline HYPERION_CONSTEXPR_STRINGS auto to_string() const noexcept
-			-> std::string final {
+		[[nodiscard]] inline auto to_string() const noexcept -> std::string final {
 			using namespace std::literals::string_literals;
-			return "Error: "s + m_error->message() + "\n"s;
+			return "Error: "s + message() + "\n"s;
 		}
 
 		[[nodiscard]] inline constexpr auto clone() const noexcept -> hyperion::UniquePtr<ErrorBase>
@@ -524,18 +737,32 @@ namespace hyperion::error {
 
 		/// @brief Copy-assigns the given `AnyError` to this one
 		/// @ingroup error
-		HYPERION_CONSTEXPR_STRINGS auto operator=(const AnyError& error) noexcept -> AnyError& {
+		inline auto operator=(const AnyError& error) noexcept -> AnyError& {
 			if(this == &error) {
 				return *this;
 			}
 
-			m_error = error.m_error->clone();
+			m_vtable->destroy(m_storage.data());
+			m_vtable = error.m_vtable;
+			m_vtable->copy(m_storage.data(), error.m_storage.data());
 
 			return *this;
 		}
-		/// @brief Move-assigns the given `AnyError` to this one
+		/// @brief Move-assigns the given `AnyError` to this one. `error` is left holding an
+		/// unknown error
 		/// @ingroup error
-		HYPERION_CONSTEXPR_STRINGS auto operator=(AnyError&&) noexcept -> AnyError& = default;
+		inline auto operator=(AnyError&& error) noexcept -> AnyError& {
+			if(this == &error) {
+				return *this;
+			}
+
+			m_vtable->destroy(m_storage.data());
+			m_vtable = error.m_vtable;
+			m_vtable->move(m_storage.data(), error.m_storage.data());
+			error.reset();
+
+			return *this;
+		}
 
 		/// @brief Copy-assigns this `AnyError` with the given
 		/// `error::ErrorCode<Domain>`
@@ -545,9 +772,9 @@ namespace hyperion::error {
 		/// @param code - The error code to assign to this
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS auto operator=(const ErrorCode<Domain>& code) noexcept
-			-> AnyError& {
-			m_error = hyperion::make_unique<Error<Domain>>(code);
+		inline auto operator=(const ErrorCode<Domain>& code) noexcept -> AnyError& {
+			m_vtable->destroy(m_storage.data());
+			construct<Error<Domain>>(code);
 
 			return *this;
 		}
@@ -560,8 +787,9 @@ namespace hyperion::error {
 		/// @param code - The error code to assign to this
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS auto operator=(ErrorCode<Domain>&& code) noexcept -> AnyError& {
-			m_error = hyperion::make_unique<Error<Domain>>(std::move(code));
+		inline auto operator=(ErrorCode<Domain>&& code) noexcept -> AnyError& {
+			m_vtable->destroy(m_storage.data());
+			construct<Error<Domain>>(std::move(code));
 
 			return *this;
 		}
@@ -573,9 +801,9 @@ namespace hyperion::error {
 		/// @param error - The error to assign to this
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS auto operator=(const Error<Domain>& error) noexcept
-			-> AnyError& {
-			m_error = hyperion::make_unique<Error<Domain>>(error);
+		inline auto operator=(const Error<Domain>& error) noexcept -> AnyError& {
+			m_vtable->destroy(m_storage.data());
+			construct<Error<Domain>>(error);
 
 			return *this;
 		}
@@ -587,12 +815,21 @@ namespace hyperion::error {
 		/// @param error - The error to assign to this
 		/// @ingroup error
 		template<StatusCodeDomain Domain>
-		HYPERION_CONSTEXPR_STRINGS auto operator=(Error<Domain>&& error) noexcept -> AnyError& {
-			m_error = hyperion::make_unique<Error<Domain>>(std::move(error));
+		inline auto operator=(Error<Domain>&& error) noexcept -> AnyError& {
+			m_vtable->destroy(m_storage.data());
+			construct<Error<Domain>>(std::move(error));
 
 			return *this;
 		}
 
+		/// @brief Returns whether the error this represents is stored inline, instead of on the
+		/// heap
+		/// @return Whether the error is stored inline
+		/// @ingroup error
+		[[nodiscard]] inline auto is_inline() const noexcept -> bool {
+			return m_vtable->is_inline;
+		}
+
 		/// @brief Provides `std::tuple`-like structured binding support.
 		///
 		/// `Index == 0` returns the error code value.
@@ -605,7 +842,7 @@ namespace hyperion::error {
 		/// == 1`)
 		/// @ingroup error
 		template<usize Index>
-		constexpr auto get() const&& noexcept {
+		inline auto get() const&& noexcept {
 
 			return get_impl<Index>(*this);
 		}
@@ -623,26 +860,49 @@ namespace hyperion::error {
 		/// == 1`)
 		/// @ingroup error
 		template<usize Index>
-		HYPERION_CONSTEXPR_STRINGS auto get() const& noexcept {
+		inline auto get() const& noexcept {
 
 			return get_impl<Index>(*this);
 		}
 
 	  private:
 		template<usize Index, typename T>
-		constexpr auto get_impl(T && val) const noexcept {
+		inline auto get_impl(T && val) const noexcept {
 
 			static_assert(Index < 2, "Index out of bounds for hyperion::error::AnyError::get");
 			if constexpr(Index == 0) {
-				return std::forward<T>(val).m_error->value();
+				return val.m_vtable->value(val.m_storage.data());
 			}
 			else {
-				return std::forward<T>(val).m_error->message();
+				return val.m_vtable->message(val.m_storage.data());
 			}
 		}
 
-		hyperion::UniquePtr<ErrorBase> m_error;
+		/// @brief Constructs an `E` from `args` in this `AnyError`'s (uninitialized) storage
+		template<typename E, typename... Args>
+		inline auto construct(Args&&... args) noexcept -> void {
+			detail::any_error::construct<E>(m_storage.data(), std::forward<Args>(args)...);
+			m_vtable = &detail::any_error::vtable<E>;
+		}
+
+		/// @brief Replaces the held error with an unknown error
+		inline auto reset() noexcept -> void {
+			m_vtable->destroy(m_storage.data());
+			construct<SystemError>();
+		}
+
+		const detail::any_error::VTable* m_vtable = nullptr;
+		alignas(detail::any_error::INLINE_ALIGNMENT)
+			std::array<std::byte, detail::any_error::INLINE_SIZE> m_storage;
 	};
+	IGNORE_PADDING_STOP
+
+	static_assert(detail::any_error::stored_inline<PosixError>,
+				  "PosixError must be stored inline in AnyError");
+	static_assert(detail::any_error::stored_inline<GenericError>,
+				  "GenericError must be stored inline in AnyError");
+	static_assert(detail::any_error::stored_inline<SystemError>,
+				  "SystemError must be stored inline in AnyError");
 
 	IGNORE_WEAK_VTABLES_STOP
 } // namespace hyperion::error
@@ -667,3 +927,48 @@ template<>
 struct std::tuple_element<1, hyperion::error::AnyError> {
 	using type = std::string;
 };
+
+/// @brief Specialize `fmt::formatter` for `error::Error<Domain>`, formatting its message.
+/// If `Domain` provides `message_view`, formatting doesn't allocate
+/// @ingroup error
+/// @headerfile "Hyperion/Error.h"
+template<hyperion::error::StatusCodeDomain Domain>
+struct fmt::formatter<hyperion::error::Error<Domain>> {
+	// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+	[[nodiscard]] inline constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin()) {
+		return ctx.begin();
+	}
+
+	template<typename FormatContext>
+	[[nodiscard]] inline auto format(const hyperion::error::Error<Domain>& error,
+									 FormatContext& ctx) -> decltype(ctx.out()) {
+		if constexpr(hyperion::error::StatusCodeDomainWithMessageView<Domain>) {
+			return fmt::format_to(ctx.out(), "{}", error.message_view());
+		}
+		else {
+			return fmt::format_to(ctx.out(), "{}", error.message());
+		}
+	}
+};
+
+/// @brief Specialize `fmt::formatter` for `error::AnyError`, formatting its message.
+/// If the held error provides `message_view`, formatting doesn't allocate
+/// @ingroup error
+/// @headerfile "Hyperion/Error.h"
+template<>
+struct fmt::formatter<hyperion::error::AnyError> {
+	// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+	[[nodiscard]] inline constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin()) {
+		return ctx.begin();
+	}
+
+	template<typename FormatContext>
+	[[nodiscard]] inline auto
+	format(const hyperion::error::AnyError& error, FormatContext& ctx) -> decltype(ctx.out()) {
+		if(error.has_message_view()) {
+			return fmt::format_to(ctx.out(), "{}", error.message_view());
+		}
+
+		return fmt::format_to(ctx.out(), "{}", error.message());
+	}
+};
@@ -126,6 +126,31 @@ IGNORE_UNUSED_MACROS_START
 	#define HYPERION_NO_DESTROY
 #endif
 
+/// @def HYPERION_NOINLINE
+/// @brief Prevents the following function from being inlined. Use to keep rarely taken slow
+/// paths out of line, so the fast paths calling them stay small enough to inline
+/// @ingroup defines
+/// @headerfile "Hyperion/HyperionDef.h"
+#if HYPERION_PLATFORM_COMPILER_CLANG || HYPERION_PLATFORM_COMPILER_GCC
+	#define HYPERION_NOINLINE [[gnu::noinline]] // NOLINT(cppcoreguidelines-macro-usage)
+#elif HYPERION_PLATFORM_COMPILER_MSVC
+	#define HYPERION_NOINLINE __declspec(noinline) // NOLINT(cppcoreguidelines-macro-usage)
+#else
+	#define HYPERION_NOINLINE
+#endif
+
+/// @def HYPERION_COLD
+/// @brief Marks the following function as rarely called. The compiler optimizes it for size,
+/// places it away from hot code, and treats the branches leading to it as unlikely. Use together
+/// with `HYPERION_NOINLINE` to move failure paths, like panics, out of the fast paths calling them
+/// @ingroup defines
+/// @headerfile "Hyperion/HyperionDef.h"
+#if HYPERION_PLATFORM_COMPILER_CLANG || HYPERION_PLATFORM_COMPILER_GCC
+	#define HYPERION_COLD [[gnu::cold]] // NOLINT(cppcoreguidelines-macro-usage)
+#else
+	#define HYPERION_COLD
+#endif
+
 /// @def HYPERION_CONSTEXPR_STRINGS
 /// @brief Conditionally marks a function or variable constexpr if `constexpr std::string` has been
 /// implemented for the compiler/standard library implementation being compiled with
@@ -33,10 +33,13 @@
 #include <Hyperion/BasicTypes.h>
 #include <Hyperion/FmtIO.h>
 #include <Hyperion/Option.h>
+#include <Hyperion/error/Panic.h>
 #include <Hyperion/logging/Config.h>
 #include <Hyperion/logging/Entry.h>
+#include <Hyperion/logging/LevelRegistry.h>
 #include <Hyperion/logging/Queue.h>
 #include <Hyperion/logging/Sink.h>
+#include <Hyperion/logging/Thread.h>
 #include <Hyperion/synchronization/ReadWriteLock.h>
 #include <algorithm>
 #include <atomic>
@@ -62,6 +65,8 @@ namespace hyperion {
 		/// lower than the minimum level for the logger
 		LevelError = 2,
 		LoggerNotInitialized = 3,
+		/// @brief the logger failed to flush all pending entries within the requested timeout
+		FlushTimedOut = 4,
 		Unknown = -1
 	};
 } // namespace hyperion
@@ -88,6 +93,12 @@ STATUS_CODE_DOMAIN(
 			return "Requested log level for entry is lower than minimum level configured for "
 				   "logger.";
 		}
+		else if(code == value_type::LoggerNotInitialized) {
+			return "Logger has not been initialized.";
+		}
+		else if(code == value_type::FlushTimedOut) {
+			return "Logger failed to flush pending entries before the timeout elapsed.";
+		}
 		else {
 			return "Unknown Logger error.";
 		}
@@ -121,6 +132,9 @@ namespace hyperion {
 		class ILogger {
 		  public:
 			ILogger() noexcept = default;
+			explicit ILogger(logging::Level minimum_level) noexcept
+				: m_minimum_level(minimum_level) {
+			}
 			ILogger(const ILogger&) noexcept = default;
 			ILogger(ILogger&&) noexcept = default;
 			virtual ~ILogger() noexcept = default;
@@ -130,18 +144,89 @@ namespace hyperion {
 							fmt::format_string<Args...>&& format_string,
 							Args&&... args) noexcept -> Result<None, LoggerError> {
 				HYPERION_PROFILE_FUNCTION();
+				// check before formatting so that disabled levels cost a single relaxed load
+				if(!is_enabled(Level)) {
+					return Ok();
+				}
+
 				return log(format_entry<Level>(std::move(thread_id),
 											   std::move(format_string),
 											   std::forward<Args>(args)...));
 			}
 
-			template<logging::Level, typename... Args>
+			template<logging::Level Level, typename... Args>
 			inline auto log(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept
 				-> Result<None, LoggerError> {
 				HYPERION_PROFILE_FUNCTION();
-				return log(None(), std::move(format_string), std::forward<Args>(args)...);
+				return log<Level>(None(), std::move(format_string), std::forward<Args>(args)...);
 			}
 
+			/// @brief Logs the given entry if its level is enabled both for this logger and for
+			/// the given tag
+			///
+			/// @param tag - The tag (module, subsystem, etc.) the entry is logged for
+			/// @param thread_id - The thread id to log the entry with, or `None` to use the
+			/// calling thread's id
+			/// @param format_string - The format string for the entry
+			/// @param args - The arguments to format into the entry
+			template<logging::Level Level, typename... Args>
+			inline auto log(const logging::Tag& tag,
+							Option<usize> thread_id,
+							fmt::format_string<Args...>&& format_string,
+							Args&&... args) noexcept -> Result<None, LoggerError> {
+				HYPERION_PROFILE_FUNCTION();
+				if(!tag.is_enabled(Level)) {
+					return Ok();
+				}
+
+				return log<Level>(std::move(thread_id),
+								  std::move(format_string),
+								  std::forward<Args>(args)...);
+			}
+
+			/// @brief Returns the current minimum `Level` of this logger.
+			///
+			/// Entries with a level above this are logged
+			[[nodiscard]] inline auto get_minimum_level() const noexcept -> logging::Level {
+				return m_minimum_level.load();
+			}
+
+			/// @brief Sets the minimum `Level` of this logger, taking effect for entries logged
+			/// after the call.
+			///
+			/// This can be called from any thread, including while the logger is in use. It
+			/// overrides the level the logger was configured with in its `logging::Parameters`
+			///
+			/// @param level - The new minimum `Level`
+			inline auto set_minimum_level(logging::Level level) noexcept -> void {
+				m_minimum_level.store(level);
+			}
+
+			/// @brief Returns whether entries of the given `Level` are currently logged by this
+			///
+			/// @param level - The `Level` to check
+			[[nodiscard]] inline auto is_enabled(logging::Level level) const noexcept -> bool {
+				return level > m_minimum_level.load();
+			}
+
+			/// @brief Flushes the logger, blocking until every entry logged before the call has
+			/// been written to the logger's sinks and the sinks have been flushed, or until
+			/// `timeout` has elapsed.
+			///
+			/// For synchronous loggers this simply flushes the sinks. For asynchronous loggers
+			/// this wakes the logging thread and waits for it to drain the queue and flush the
+			/// sinks.
+			///
+			/// # Errors
+			/// Returns `LoggerErrorCategory::FlushTimedOut` if the flush did not complete before
+			/// `timeout` elapsed
+			///
+			/// @param timeout - The maximum amount of time to wait for the flush to complete
+			///
+			/// @return `Ok` if the flush completed, `LoggerError` otherwise
+			virtual auto
+			flush(std::chrono::nanoseconds timeout) noexcept -> Result<None, LoggerError> = 0;
+
 			auto operator=(const ILogger&) noexcept -> ILogger& = default;
 			auto operator=(ILogger&&) noexcept -> ILogger& = default;
 
@@ -160,6 +245,8 @@ namespace hyperion {
 			}
 
 		  private:
+			logging::AtomicLevel m_minimum_level = logging::Level::DISABLED;
+
 			template<logging::Level Level, typename... Args>
 			static inline auto
 			format_entry(Option<usize> thread_id, // NOLINT(bugprone-exception-escape)
@@ -195,12 +282,17 @@ namespace hyperion {
 					log_type = "ERROR"s;
 				}
 
-				return logging::make_entry<logging::entry_level_t<Level>>(
+				auto formatted = logging::make_entry<logging::entry_level_t<Level>>(
 					FMT_COMPILE("{0} [Thread ID: {1}] [{2}]: {3}"),
 					timestamp,
 					tid,
 					log_type,
 					entry);
+				// the context is only captured here, as a handle shared with every other entry
+				// logged under the same context. It's formatted by the sinks when they write the
+				// entry
+				formatted.capture_context();
+				return formatted;
 				//	return make_entry<entry_level_t<Level>>(FMT_COMPILE("[{0}]: {1}"),
 				//	                                        log_type,
 				//	                                        entry);
@@ -258,6 +350,16 @@ namespace hyperion {
 		Logger() = default;
 		explicit Logger(logging::Sinks&& sinks) noexcept : LogBase(std::move(sinks)) {
 		}
+		/// @brief Constructs an asynchronous `Logger` logging to the given sinks, with its
+		/// logging thread placed according to the given `ThreadOptions`
+		///
+		/// @param sinks - The sinks to log to
+		/// @param options - The name, CPU affinity, and priority to give the logging thread
+		Logger(logging::Sinks&& sinks, logging::ThreadOptions options) noexcept
+		requires(THREADING_POLICY == logging::ThreadingPolicy::SingleThreadedAsync
+				 || THREADING_POLICY == logging::ThreadingPolicy::MultiThreadedAsync)
+			: LogBase(std::move(sinks), std::move(options)) {
+		}
 		Logger(const Logger& logger) noexcept = delete;
 		Logger(Logger&& logger) noexcept = default;
 
@@ -421,6 +523,10 @@ namespace hyperion {
 	struct GlobalLog {
 		static UniquePtr<detail::ILogger> GLOBAL_LOGGER; // NOLINT
 
+		/// @brief The maximum amount of time a panic will wait for the global logger to flush
+		/// before the panic handler is invoked
+		static constexpr auto PANIC_FLUSH_TIMEOUT = std::chrono::milliseconds(500);
+
 		[[nodiscard]] static inline auto
 		get_global_logger() noexcept -> Result<detail::ILogger*, LoggerError> {
 			if(GLOBAL_LOGGER == nullptr) {
@@ -433,6 +539,23 @@ namespace hyperion {
 		[[maybe_unused]] static inline auto
 		set_global_logger(hyperion::UniquePtr<Logger<Parameters>>&& logger) noexcept -> void {
 			GLOBAL_LOGGER = std::move(logger);
+			error::Panic::set_flush_hook(&flush_on_panic);
+		}
+
+		/// @brief Flushes the global logger, blocking until all entries logged before the call
+		/// have been written and the sinks flushed, or until `timeout` has elapsed
+		///
+		/// # Errors
+		/// Returns `LoggerErrorCategory::LoggerNotInitialized` if the global logger has not been
+		/// set, or `LoggerErrorCategory::FlushTimedOut` if the flush did not complete in time
+		///
+		/// @param timeout - The maximum amount of time to wait for the flush to complete
+		///
+		/// @return `Ok` if the flush completed, `LoggerError` otherwise
+		[[maybe_unused]] static inline auto
+		flush(std::chrono::nanoseconds timeout) noexcept -> Result<None, LoggerError> {
+			return get_global_logger().and_then(
+				[timeout](auto* logger) noexcept { return logger->flush(timeout); });
 		}
 
 		template<typename... Args>
@@ -532,6 +655,11 @@ namespace hyperion {
 		ERROR(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept {
 			return ERROR(None(), std::move(format_string), std::forward<Args>(args)...);
 		}
+
+	  private:
+		static inline auto flush_on_panic() noexcept -> void {
+			ignore(flush(PANIC_FLUSH_TIMEOUT));
+		}
 	};
 
 	IGNORE_UNUSED_TEMPLATES_START
@@ -692,12 +820,24 @@ namespace hyperion {
 
 			LogBase() : LogBase(detail::ILogger::create_default_sinks()) {
 			}
-			explicit LogBase(logging::Sinks&& sinks) noexcept : m_sinks(std::move(sinks)) {
+			explicit LogBase(logging::Sinks&& sinks) noexcept
+				: detail::ILogger(MINIMUM_LEVEL), m_sinks(std::move(sinks)) {
 			}
 			LogBase(const LogBase&) = delete;
 			LogBase(LogBase&&) noexcept = default;
 			~LogBase() noexcept override = default;
 
+			inline auto flush(std::chrono::nanoseconds timeout) noexcept
+				-> Result<None, LoggerError> final {
+				HYPERION_PROFILE_FUNCTION();
+				if(!logging::detail::flush_sinks(m_sinks, logging::detail::flush_deadline(timeout)))
+				{
+					return Err(LoggerError(LoggerErrorCategory::FlushTimedOut));
+				}
+
+				return Ok();
+			}
+
 			auto operator=(const LogBase&) -> LogBase& = delete;
 			auto operator=(LogBase&&) noexcept -> LogBase& = default;
 
@@ -706,7 +846,7 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
+				if(this->is_enabled(entry.level())) {
 					std::ranges::for_each(m_sinks, [&entry](const auto& sink) noexcept -> void {
 						sink->sink(entry);
 					});
@@ -719,7 +859,7 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
+				if(this->is_enabled(entry.level())) {
 					std::ranges::for_each(
 						m_sinks,
 						[_entry = std::move(entry)](const auto& sink) noexcept -> void {
@@ -749,12 +889,24 @@ namespace hyperion {
 			LogBase() : LogBase(detail::ILogger::create_default_sinks()) {
 			}
 			explicit LogBase(logging::Sinks&& sinks) noexcept
-				: m_sinks(std::move(sinks)), m_queue() {
+				: LogBase(std::move(sinks), logging::ThreadOptions()) {
+			}
+			LogBase(logging::Sinks&& sinks, logging::ThreadOptions options) noexcept
+				: detail::ILogger(MINIMUM_LEVEL), m_sinks(std::move(sinks)),
+				  m_queue(logging::large_page_options_for(options)) {
 #if HYPERION_HAS_JTHREAD
 				m_logging_thread = detail::thread(
-					[this](const std::stop_token& token) { message_thread_function(token); });
+					[this, _options = std::move(options)](const std::stop_token& token) {
+						// placement is best-effort, a logger that can't be placed should still log
+						ignore(logging::set_current_thread_options(_options));
+						message_thread_function(token);
+					});
 #else
-				m_logging_thread = detail::thread([this]() { message_thread_function(); });
+				m_logging_thread = detail::thread([this, _options = std::move(options)]() {
+					// placement is best-effort, a logger that can't be placed should still log
+					ignore(logging::set_current_thread_options(_options));
+					message_thread_function();
+				});
 #endif
 			}
 			LogBase(const LogBase&) = delete;
@@ -764,6 +916,20 @@ namespace hyperion {
 				m_logging_thread.join();
 			}
 
+			inline auto flush(std::chrono::nanoseconds timeout) noexcept
+				-> Result<None, LoggerError> final {
+				HYPERION_PROFILE_FUNCTION();
+				const auto deadline = logging::detail::flush_deadline(timeout);
+				const auto ticket = m_flush_requests.request(deadline);
+				m_signal.release(1);
+
+				if(!m_flush_requests.wait(ticket, deadline)) {
+					return Err(LoggerError(LoggerErrorCategory::FlushTimedOut));
+				}
+
+				return Ok();
+			}
+
 			auto operator=(const LogBase&) -> LogBase& = delete;
 			auto operator=(LogBase&&) -> LogBase& = delete;
 
@@ -772,17 +938,18 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
-					m_signal.release(1);
+				if(this->is_enabled(entry.level())) {
 					if constexpr(ASYNC_POLICY == logging::AsyncPolicy::DropWhenFull) {
-						return m_queue.push(entry).map_err(
-							[]([[maybe_unused]] const QueueError& error) {
-								return LoggerError(LoggerErrorCategory::QueueingError);
-							});
+						if(m_queue.push(entry).is_err()) {
+							return Err(LoggerError(LoggerErrorCategory::QueueingError));
+						}
 					}
 					else {
 						m_queue.push(entry);
 					}
+					// signal the logging thread once per queued entry, after it's been queued,
+					// so it never wakes to find the entry missing
+					m_signal.release(1);
 				}
 
 				return Ok();
@@ -792,17 +959,18 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
-					m_signal.release(1);
+				if(this->is_enabled(entry.level())) {
 					if constexpr(ASYNC_POLICY == logging::AsyncPolicy::DropWhenFull) {
-						return m_queue.push(std::move(entry))
-							.map_err([]([[maybe_unused]] const QueueError& error) {
-								return LoggerError(LoggerErrorCategory::QueueingError);
-							});
+						if(m_queue.push(std::move(entry)).is_err()) {
+							return Err(LoggerError(LoggerErrorCategory::QueueingError));
+						}
 					}
 					else {
 						m_queue.push(std::move(entry));
 					}
+					// signal the logging thread once per queued entry, after it's been queued,
+					// so it never wakes to find the entry missing
+					m_signal.release(1);
 				}
 
 				return Ok();
@@ -822,11 +990,19 @@ namespace hyperion {
 				}
 			}
 
-			using Queue = logging::Queue<logging::Entry, get_queue_policy(), QUEUE_SIZE>;
+			using Queue = logging::
+				Queue<logging::Entry, get_queue_policy(), QUEUE_SIZE, THREADING_POLICY>;
+
+			// bound each batch so the producer can keep queueing while the batch is being sunk
+			static constexpr usize SINK_BATCH_SIZE = std::max(QUEUE_SIZE / 2, 1_usize);
 
 			logging::Sinks m_sinks;
 			Queue m_queue;
-			std::counting_semaphore<QUEUE_SIZE> m_signal = std::counting_semaphore<QUEUE_SIZE>(0);
+			// entries, flush requests, and stopping all signal this, so it can be released more
+			// than `QUEUE_SIZE` times before the logging thread wakes up
+			std::counting_semaphore<> m_signal = std::counting_semaphore<>(0);
+
+			logging::detail::FlushRequests m_flush_requests;
 
 #if !HYPERION_HAS_JTHREAD
 			std::atomic_bool m_exit_flag = false;
@@ -847,6 +1023,60 @@ namespace hyperion {
 				return m_queue.read();
 			}
 
+			inline auto try_sink_next() noexcept -> bool {
+				return try_read().and_then([this](const auto& message) noexcept -> None {
+					std::ranges::for_each(
+						m_sinks,
+						[&message](const auto& sink) noexcept -> void { sink->sink(message); });
+					return {};
+				})
+					.is_ok();
+			}
+
+			/// @brief Sinks up to `SINK_BATCH_SIZE` entries, handing their queue slots back to
+			/// the producer in one go
+			///
+			/// @return The number of entries sunk
+			inline auto try_sink_batch() noexcept -> usize {
+				HYPERION_PROFILE_FUNCTION();
+				return m_queue.read_batch(
+					[this](logging::Entry&& message) noexcept -> void {
+						std::ranges::for_each(m_sinks, [&message](const auto& sink) noexcept {
+							sink->sink(message);
+						});
+					},
+					SINK_BATCH_SIZE);
+			}
+
+			// only called from the logging thread
+			inline auto service_flush_requests() noexcept -> void {
+				if(!m_flush_requests.pending()) {
+					return;
+				}
+
+				const auto [requested, deadline] = m_flush_requests.take();
+				// drain everything queued before the flush was requested, but no more, so
+				// producers that keep logging can't hold the flush off past its deadline
+				const auto queued = m_queue.size();
+				for(auto drained = 0_usize;
+					drained < queued && logging::detail::FlushClock::now() < deadline;
+					++drained)
+				{
+					if(!try_sink_next()) {
+						break;
+					}
+					// every entry was signalled once when it was logged, so consume its signal
+					ignore(m_signal.try_acquire());
+				}
+
+				// sinks are flushed against the requesters' deadline, so one slow sink (e.g. a
+				// `SinkGroup`) can't hold up the logging thread indefinitely. If a sink couldn't
+				// finish in time, its requesters have given up, so leave them uncompleted
+				if(logging::detail::flush_sinks(m_sinks, deadline)) {
+					m_flush_requests.complete(requested);
+				}
+			}
+
 #if HYPERION_HAS_JTHREAD
 			// NOLINTNEXTLINE(readability-function-cognitive-complexity)
 			inline auto message_thread_function(const std::stop_token& token) noexcept -> void {
@@ -857,25 +1087,21 @@ namespace hyperion {
 				while(!m_exit_flag.load()) {
 #endif
 
-					ignore(try_read().and_then([this](const auto& message) noexcept -> None {
-						std::ranges::for_each(
-							m_sinks,
-							[&message](const auto& sink) noexcept -> void { sink->sink(message); });
-						return {};
-					}));
+					// every entry was signalled once when it was logged. The acquire below
+					// accounts for one of them, so consume the rest of the batch's signals here
+					const auto sunk = try_sink_batch();
+					for(auto signal = 1_usize; signal < sunk; ++signal) {
+						ignore(m_signal.try_acquire());
+					}
+					service_flush_requests();
 					// waiting for the semaphore __after__ we attempt the read can reduce latency
 					// under extreme contention
 					m_signal.acquire();
 				}
-				while(try_read().and_then([this](const auto& message) noexcept -> None {
-					std::ranges::for_each(m_sinks, [&message](const auto& sink) noexcept -> void {
-						sink->sink(message);
-					});
-					return {};
-				}))
-				{
+				while(try_sink_next()) {
 					// loop until we flush the queue
 				}
+				service_flush_requests();
 			}
 		};
 
@@ -890,12 +1116,25 @@ namespace hyperion {
 
 			LogBase() : LogBase(detail::ILogger::create_default_sinks()) {
 			}
-			explicit LogBase(logging::Sinks&& sinks) noexcept : m_sinks(std::move(sinks)) {
+			explicit LogBase(logging::Sinks&& sinks) noexcept
+				: detail::ILogger(MINIMUM_LEVEL), m_sinks(std::move(sinks)) {
 			}
 			LogBase(const LogBase&) = delete;
 			LogBase(LogBase&&) noexcept = default;
 			~LogBase() noexcept override = default;
 
+			inline auto flush(std::chrono::nanoseconds timeout) noexcept
+				-> Result<None, LoggerError> final {
+				HYPERION_PROFILE_FUNCTION();
+				auto sinks_guard = m_sinks.write();
+				if(!logging::detail::flush_sinks(*sinks_guard,
+												 logging::detail::flush_deadline(timeout))) {
+					return Err(LoggerError(LoggerErrorCategory::FlushTimedOut));
+				}
+
+				return Ok();
+			}
+
 			auto operator=(const LogBase&) -> LogBase& = delete;
 			auto operator=(LogBase&&) noexcept -> LogBase& = default;
 
@@ -904,7 +1143,7 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
+				if(this->is_enabled(entry.level())) {
 					auto sinks_guard = m_sinks.write();
 					std::ranges::for_each(
 						*sinks_guard,
@@ -918,7 +1157,7 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
+				if(this->is_enabled(entry.level())) {
 					auto sinks_guard = m_sinks.write();
 					std::ranges::for_each(
 						*sinks_guard,
@@ -949,12 +1188,24 @@ namespace hyperion {
 			LogBase() : LogBase(detail::ILogger::create_default_sinks()) {
 			}
 			explicit LogBase(logging::Sinks&& sinks) noexcept
-				: m_sinks(std::move(sinks)), m_queue() {
+				: LogBase(std::move(sinks), logging::ThreadOptions()) {
+			}
+			LogBase(logging::Sinks&& sinks, logging::ThreadOptions options) noexcept
+				: detail::ILogger(MINIMUM_LEVEL), m_sinks(std::move(sinks)),
+				  m_queue(logging::large_page_options_for(options)) {
 #if HYPERION_HAS_JTHREAD
 				m_logging_thread = detail::thread(
-					[this](const std::stop_token& token) { message_thread_function(token); });
+					[this, _options = std::move(options)](const std::stop_token& token) {
+						// placement is best-effort, a logger that can't be placed should still log
+						ignore(logging::set_current_thread_options(_options));
+						message_thread_function(token);
+					});
 #else
-				m_logging_thread = detail::thread([this]() { message_thread_function(); });
+				m_logging_thread = detail::thread([this, _options = std::move(options)]() {
+					// placement is best-effort, a logger that can't be placed should still log
+					ignore(logging::set_current_thread_options(_options));
+					message_thread_function();
+				});
 #endif
 			}
 			LogBase(const LogBase&) = delete;
@@ -964,6 +1215,20 @@ namespace hyperion {
 				m_logging_thread.join();
 			}
 
+			inline auto flush(std::chrono::nanoseconds timeout) noexcept
+				-> Result<None, LoggerError> final {
+				HYPERION_PROFILE_FUNCTION();
+				const auto deadline = logging::detail::flush_deadline(timeout);
+				const auto ticket = m_flush_requests.request(deadline);
+				m_signal.release(1);
+
+				if(!m_flush_requests.wait(ticket, deadline)) {
+					return Err(LoggerError(LoggerErrorCategory::FlushTimedOut));
+				}
+
+				return Ok();
+			}
+
 			auto operator=(const LogBase&) -> LogBase& = delete;
 			auto operator=(LogBase&& logger) -> LogBase& = delete;
 
@@ -972,16 +1237,18 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
+				if(this->is_enabled(entry.level())) {
 					if constexpr(ASYNC_POLICY == logging::AsyncPolicy::DropWhenFull) {
-						return m_queue.push(entry).map_err(
-							[]([[maybe_unused]] const QueueError& error) {
-								return LoggerError(LoggerErrorCategory::QueueingError);
-							});
+						if(m_queue.push(entry).is_err()) {
+							return Err(LoggerError(LoggerErrorCategory::QueueingError));
+						}
 					}
 					else {
 						m_queue.push(entry);
 					}
+					// signal the logging thread once per queued entry, after it's been queued,
+					// so it never wakes to find the entry missing
+					m_signal.release(1);
 				}
 
 				return Ok();
@@ -991,16 +1258,18 @@ namespace hyperion {
 				noexcept -> Result<None, LoggerError> final {
 
 				HYPERION_PROFILE_FUNCTION();
-				if(entry.level() > MINIMUM_LEVEL) {
+				if(this->is_enabled(entry.level())) {
 					if constexpr(ASYNC_POLICY == logging::AsyncPolicy::DropWhenFull) {
-						return m_queue.push(std::move(entry))
-							.map_err([]([[maybe_unused]] const QueueError& error) {
-								return LoggerError(LoggerErrorCategory::QueueingError);
-							});
+						if(m_queue.push(std::move(entry)).is_err()) {
+							return Err(LoggerError(LoggerErrorCategory::QueueingError));
+						}
 					}
 					else {
 						m_queue.push(std::move(entry));
 					}
+					// signal the logging thread once per queued entry, after it's been queued,
+					// so it never wakes to find the entry missing
+					m_signal.release(1);
 				}
 
 				return Ok();
@@ -1020,11 +1289,16 @@ namespace hyperion {
 				}
 			}
 
-			using Queue = logging::Queue<logging::Entry, get_queue_policy(), QUEUE_SIZE>;
+			using Queue = logging::
+				Queue<logging::Entry, get_queue_policy(), QUEUE_SIZE, THREADING_POLICY>;
 
 			logging::Sinks m_sinks;
 			Queue m_queue;
-			std::counting_semaphore<QUEUE_SIZE> m_signal = std::counting_semaphore<QUEUE_SIZE>(0);
+			// entries, flush requests, and stopping all signal this, so it can be released more
+			// than `QUEUE_SIZE` times before the logging thread wakes up
+			std::counting_semaphore<> m_signal = std::counting_semaphore<>(0);
+
+			logging::detail::FlushRequests m_flush_requests;
 
 #if !HYPERION_HAS_JTHREAD
 			std::atomic_bool m_exit_flag = false;
@@ -1045,6 +1319,45 @@ namespace hyperion {
 				return m_queue.read();
 			}
 
+			inline auto try_sink_next() noexcept -> bool {
+				return try_read().and_then([this](const auto& message) noexcept -> None {
+					std::ranges::for_each(
+						m_sinks,
+						[&message](const auto& sink) noexcept -> void { sink->sink(message); });
+					return {};
+				})
+					.is_ok();
+			}
+
+			// only called from the logging thread
+			inline auto service_flush_requests() noexcept -> void {
+				if(!m_flush_requests.pending()) {
+					return;
+				}
+
+				const auto [requested, deadline] = m_flush_requests.take();
+				// drain everything queued before the flush was requested, but no more, so
+				// producers that keep logging can't hold the flush off past its deadline
+				const auto queued = m_queue.size();
+				for(auto drained = 0_usize;
+					drained < queued && logging::detail::FlushClock::now() < deadline;
+					++drained)
+				{
+					if(!try_sink_next()) {
+						break;
+					}
+					// every entry was signalled once when it was logged, so consume its signal
+					ignore(m_signal.try_acquire());
+				}
+
+				// sinks are flushed against the requesters' deadline, so one slow sink (e.g. a
+				// `SinkGroup`) can't hold up the logging thread indefinitely. If a sink couldn't
+				// finish in time, its requesters have given up, so leave them uncompleted
+				if(logging::detail::flush_sinks(m_sinks, deadline)) {
+					m_flush_requests.complete(requested);
+				}
+			}
+
 #if HYPERION_HAS_JTHREAD
 			// NOLINTNEXTLINE(readability-function-cognitive-complexity)
 			inline auto message_thread_function(const std::stop_token& token) noexcept -> void {
@@ -1055,25 +1368,16 @@ namespace hyperion {
 				while(!m_exit_flag.load()) {
 #endif
 
-					ignore(try_read().and_then([this](const auto& message) noexcept -> None {
-						std::ranges::for_each(
-							m_sinks,
-							[&message](const auto& sink) noexcept -> void { sink->sink(message); });
-						return {};
-					}));
+					ignore(try_sink_next());
+					service_flush_requests();
 					// waiting for the semaphore __after__ we attempt the read can reduce latency
 					// under extreme contention
 					m_signal.acquire();
 				}
-				while(try_read().and_then([this](const auto& message) noexcept -> None {
-					std::ranges::for_each(m_sinks, [&message](const auto& sink) noexcept -> void {
-						sink->sink(message);
-					});
-					return {};
-				}))
-				{
+				while(try_sink_next()) {
 					// loop until we flush the queue
 				}
+				service_flush_requests();
 			}
 		};
 	} // namespace detail
@@ -27,6 +27,10 @@
 /// SOFTWARE.
 #pragma once
 
+#include <Hyperion/memory/ArenaAllocator.h>
+#include <Hyperion/memory/LargePageAllocator.h>
+#include <Hyperion/memory/ObjectPool.h>
+#include <Hyperion/memory/ThreadCachingAllocator.h>
 #include <Hyperion/memory/UniquePtr.h>
 
 ///	@defgroup memory Memory
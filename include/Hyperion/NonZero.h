@@ -0,0 +1,130 @@
+/// @file NonZero.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Integer type that is guaranteed to never be zero
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/Concepts.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Option.h>
+#include <compare>
+
+namespace hyperion {
+
+	/// @brief `NonZero<T>` is an integer that is known to never be zero.
+	///
+	/// Zero is used as the `option::Niche` of `NonZero<T>`, so `Option<NonZero<T>>` is the same
+	/// size as `T` and trivially copyable, making it a compact alternative to `Option<T>` for
+	/// values like ids, handles, or counts where zero is never valid.
+	///
+	/// Example:
+	/// @code {.cpp}
+	/// #include <Hyperion/NonZero.h>
+	///
+	/// using namespace hyperion;
+	///
+	/// static_assert(sizeof(Option<NonZero<u32>>) == sizeof(u32));
+	///
+	/// auto id = NonZero<u32>::make(42_u32);
+	/// if(id.is_some()) {
+	/// 	println("id is: {}", id.unwrap().get());
+	/// }
+	/// @endcode
+	///
+	/// @tparam T - The integer type
+	/// @ingroup option
+	/// @headerfile "Hyperion/NonZero.h"
+	template<concepts::Integral T>
+	class NonZero {
+	  public:
+		/// @brief The integer type held by this `NonZero`
+		/// @ingroup option
+		/// @headerfile "Hyperion/NonZero.h"
+		using value_type = T;
+
+		/// @brief Creates a `NonZero` holding `value`, if `value` is not zero
+		///
+		/// @param value - The value to hold
+		///
+		/// @return `Some(NonZero)` if `value` is not zero, otherwise `None`
+		/// @ingroup option
+		/// @headerfile "Hyperion/NonZero.h"
+		[[nodiscard]] static inline constexpr auto make(T value) noexcept -> Option<NonZero> {
+			if(value == T(0)) {
+				return None();
+			}
+
+			return Option<NonZero>(NonZero(value));
+		}
+
+		/// @brief Returns the value held by this `NonZero`
+		///
+		/// @return The value
+		/// @ingroup option
+		/// @headerfile "Hyperion/NonZero.h"
+		[[nodiscard]] inline constexpr auto get() const noexcept -> T {
+			return m_value;
+		}
+
+		/// @brief Compares two `NonZero`s
+		/// @ingroup option
+		/// @headerfile "Hyperion/NonZero.h"
+		friend constexpr auto operator<=>(const NonZero& lhs, const NonZero& rhs) noexcept
+			-> std::strong_ordering
+			= default;
+		/// @brief Compares two `NonZero`s for equality
+		/// @ingroup option
+		/// @headerfile "Hyperion/NonZero.h"
+		friend constexpr auto operator==(const NonZero& lhs, const NonZero& rhs) noexcept
+			-> bool
+			= default;
+
+	  private:
+		T m_value;
+
+		explicit constexpr NonZero(T value) noexcept : m_value(value) {
+		}
+
+		friend struct option::Niche<NonZero>;
+	};
+
+	/// @brief `NonZero`s use zero as their `option::Niche`, so `Option<NonZero<T>>` is the same
+	/// size as `T`
+	/// @ingroup option
+	/// @headerfile "Hyperion/NonZero.h"
+	template<concepts::Integral T>
+	struct option::Niche<NonZero<T>> {
+		static constexpr bool has_niche = true;
+
+		[[nodiscard]] static inline constexpr auto none() noexcept -> NonZero<T> {
+			return NonZero<T>(T(0));
+		}
+
+		[[nodiscard]] static inline constexpr auto is_none(const NonZero<T>& value) noexcept
+			-> bool {
+			return value.get() == T(0);
+		}
+	};
+} // namespace hyperion
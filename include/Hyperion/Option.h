@@ -177,11 +177,25 @@ namespace hyperion {
 		constexpr Option(None none) noexcept { // NOLINT
 			ignore(none);
 		}
+		/// @brief Trivial Copy Constructor, used when `T` is trivially copyable or a reference
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		constexpr Option(const Option& option) noexcept
+		requires concepts::TriviallyCopyable<OptionData>
+		= default;
+		/// @brief Trivial Move Constructor, used when `T` is trivially copyable or a reference
+		///
+		/// Unlike the non-trivial move constructor, this leaves `option` unchanged
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		constexpr Option(Option&& option) noexcept
+		requires concepts::TriviallyCopyable<OptionData>
+		= default;
 		/// @brief Copy Constructor
 		/// @ingroup option
 		/// @headerfile "Hyperion/Option.h"
 		constexpr Option(const Option& option) noexcept(concepts::NoexceptCopyConstructible<T>)
-		requires concepts::CopyConstructible<T>
+		requires concepts::CopyConstructible<T> && concepts::NotTriviallyCopyable<OptionData>
 			: OptionData(static_cast<const OptionData&>(option)) {
 		}
 		/// @brief Converting Copy Constructor from `Option<U>` where `T != U`
@@ -199,7 +213,7 @@ namespace hyperion {
 		/// @ingroup option
 		/// @headerfile "Hyperion/Option.h"
 		constexpr Option(Option&& option) noexcept(concepts::NoexceptMoveConstructible<T>)
-		requires concepts::MoveConstructible<T>
+		requires concepts::MoveConstructible<T> && concepts::NotTriviallyCopyable<OptionData>
 			: OptionData(static_cast<OptionData&&>(option)) {
 			option = None();
 		}
@@ -256,7 +270,7 @@ namespace hyperion {
 		template<typename F,
 				 typename U = decltype(std::declval<F>()(std::declval<const_reference>()))>
 		requires concepts::InvocableWithReturn<U, F, const_reference>
-		[[nodiscard]] inline auto map(F&& map_func) const noexcept -> Option<U> {
+		[[nodiscard]] inline auto map(F&& map_func) const& noexcept -> Option<U> {
 			// the invocable checks above are probably redundant because of the inferred
 			// template parameters, but we'll keep them for completeness’ sake and
 			// clarity of requirements
@@ -267,6 +281,32 @@ namespace hyperion {
 			return Some(std::forward<F>(map_func)(this->get()));
 		}
 
+		/// @brief Maps this `Option` to another one, with a potentially different
+		/// `Some` type, consuming this `Option`.
+		///
+		/// If this is the `Some` variant, invokes `map_func` with the contained value moved out of
+		/// this, returning the result as a new `Option`. Otherwise, returns `None`.
+		///
+		/// @tparam F - The type of the invocable mapping `T`
+		/// @tparam U - The type that `F` maps `T` to. This is deduced. Do not
+		/// explicitly provide this.
+		/// @param map_func - The invocable that performs the mapping
+		///
+		/// @return The result of `map_func` wrapped in an `Option` if this is `Some`, `None`
+		/// otherwise
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		template<typename F,
+				 typename U = decltype(std::declval<F>()(std::declval<rvalue_reference>()))>
+		requires concepts::InvocableWithReturn<U, F, rvalue_reference>
+		[[nodiscard]] inline auto map(F&& map_func) && noexcept -> Option<U> {
+			if(!is_some()) {
+				return hyperion::None();
+			}
+
+			return Some(std::forward<F>(map_func)(this->extract()));
+		}
+
 		/// @brief Maps this `Option` to a `U`
 		///
 		/// If this is the `Some` variant, returns the result of invoking `map_func` with a const
@@ -283,7 +323,7 @@ namespace hyperion {
 		/// @headerfile "Hyperion/Option.h"
 		template<typename F, typename U>
 		requires concepts::InvocableWithReturn<U, F, const_reference>
-		[[nodiscard]] inline auto map_or(F&& map_func, U&& default_value) const noexcept -> U {
+		[[nodiscard]] inline auto map_or(F&& map_func, U&& default_value) const& noexcept -> U {
 			if(!is_some()) {
 				return std::forward<U>(default_value);
 			}
@@ -291,6 +331,30 @@ namespace hyperion {
 			return std::forward<F>(map_func)(this->get());
 		}
 
+		/// @brief Maps this `Option` to a `U`, consuming this `Option`
+		///
+		/// If this is the `Some` variant, returns the result of invoking `map_func` with the
+		/// contained value moved out of this. Otherwise, returns `default_value`.
+		//
+		/// @tparam F - The type of the invocable mapping `T`
+		/// @tparam U - The type that `F` maps `T` to. This is deduced. Do not
+		/// explicitly provide this.
+		/// @param map_func - The invocable that performs the mapping
+		/// @param default_value - The default value
+		///
+		/// @return The result of the mapping if this is `Some`, `default_value` otherwise
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		template<typename F, typename U>
+		requires concepts::InvocableWithReturn<U, F, rvalue_reference>
+		[[nodiscard]] inline auto map_or(F&& map_func, U&& default_value) && noexcept -> U {
+			if(!is_some()) {
+				return std::forward<U>(default_value);
+			}
+
+			return std::forward<F>(map_func)(this->extract());
+		}
+
 		/// @brief Maps this `Option` to a `U`
 		///
 		/// If this is the `Some` variant, returns the result of invoking `map_func` with a const
@@ -319,7 +383,7 @@ namespace hyperion {
 		requires concepts::Same<U, V>
 				 && concepts::InvocableWithReturn<U, F, const_reference>
 				 [[nodiscard]] inline auto
-				 map_or_else(F&& map_func, G&& default_generator) const noexcept -> U {
+				 map_or_else(F&& map_func, G&& default_generator) const& noexcept -> U {
 			// the invocable checks above are probably redundant because of the inferred
 			// template parameters, but we'll keep them for completeness’ sake and
 			// clarity of requirements
@@ -330,6 +394,42 @@ namespace hyperion {
 			return std::forward<F>(map_func)(this->get());
 		}
 
+		/// @brief Maps this `Option` to a `U`, consuming this `Option`
+		///
+		/// If this is the `Some` variant, returns the result of invoking `map_func` with the
+		/// contained value moved out of this. Otherwise, returns the result of invoking
+		/// `default_generator`.
+		//
+		/// @tparam F - The type of the invocable mapping `T`
+		/// @tparam G - The type of the invocable that generates the default value
+		/// @tparam U - The type that `F` maps `T` to. This is deduced. Do not
+		/// explicitly provide this.
+		/// @tparam V - The type that `G` generates. This is deduced. Do not
+		/// explicitly provide this.
+		/// @param map_func - The function to perform the mapping
+		/// @param default_generator - The function to generate the default value
+		///
+		/// @note `map_func` and `default_generator` must return the same type
+		///
+		/// @return The result of the mapping if this is `Some`, or the value returned by
+		/// `default_generator` if this is `None`
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		template<typename F,
+				 concepts::Invocable G,
+				 typename U = decltype(std::declval<F>()(std::declval<rvalue_reference>())),
+				 typename V = decltype(std::declval<G>()())>
+		requires concepts::Same<U, V>
+				 && concepts::InvocableWithReturn<U, F, rvalue_reference>
+				 [[nodiscard]] inline auto
+				 map_or_else(F&& map_func, G&& default_generator) && noexcept -> U {
+			if(!is_some()) {
+				return std::forward<G>(default_generator)();
+			}
+
+			return std::forward<F>(map_func)(this->extract());
+		}
+
 		/// @brief Matches this `Option` to a consuming function, depending on whether it is the
 		/// `Some` or `None` variant.
 		///
@@ -543,7 +643,7 @@ namespace hyperion {
 		requires(std::is_reference_v<T> || concepts::MoveConstructible<T>
 				 || concepts::CopyConstructible<T>)
 		{
-			if(!is_some()) {
+			if(!is_some()) [[unlikely]] {
 				panic("Option::unwrap called on a None, terminating");
 			}
 
@@ -643,7 +743,7 @@ namespace hyperion {
 					requires(std::is_reference_v<T> || concepts::MoveConstructible<T>
 							 || concepts::CopyConstructible<T>)
 		{
-			if(!is_some()) {
+			if(!is_some()) [[unlikely]] {
 				panic("{}", std::forward<U>(panic_message));
 			}
 
@@ -657,16 +757,11 @@ namespace hyperion {
 		/// @ingroup option
 		/// @headerfile "Hyperion/Option.h"
 		[[nodiscard]] inline constexpr auto as_ref() noexcept -> reference {
-			if(!is_some()) {
+			if(!is_some()) [[unlikely]] {
 				panic("Option::as_ref called on a None, terminating");
 			}
 
-			if constexpr(concepts::Reference<T>) {
-				return this->get().get();
-			}
-			else {
-				return this->get();
-			}
+			return this->get();
 		}
 
 		/// @brief Returns a const reference to the contained value if this is `Some`, otherwise
@@ -676,7 +771,7 @@ namespace hyperion {
 		/// @ingroup option
 		/// @headerfile "Hyperion/Option.h"
 		[[nodiscard]] inline constexpr auto as_cref() const noexcept -> const_reference {
-			if(!is_some()) {
+			if(!is_some()) [[unlikely]] {
 				panic("Option::as_cref called on a None, terminating");
 			}
 
@@ -743,12 +838,29 @@ namespace hyperion {
 			return is_some();
 		}
 
+		/// @brief Trivial copy assignment operator, used when `T` is trivially copyable or a
+		/// reference
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		constexpr auto operator=(const Option& option) noexcept -> Option&
+		requires concepts::TriviallyCopyable<OptionData>
+		= default;
+		/// @brief Trivial move assignment operator, used when `T` is trivially copyable or a
+		/// reference
+		///
+		/// Unlike the non-trivial move assignment operator, this leaves `option` unchanged
+		/// @ingroup option
+		/// @headerfile "Hyperion/Option.h"
+		constexpr auto operator=(Option&& option) noexcept -> Option&
+		requires concepts::TriviallyCopyable<OptionData>
+		= default;
+
 		/// @brief Copy assignment operator
 		/// @ingroup option
 		/// @headerfile "Hyperion/Option.h"
 		constexpr auto
 		operator=(const Option& option) noexcept(concepts::NoexceptCopyAssignable<T>) -> Option&
-		requires concepts::CopyAssignable<T>
+		requires concepts::CopyAssignable<T> && concepts::NotTriviallyCopyable<OptionData>
 		{
 			if(this == &option) {
 				return *this;
@@ -794,7 +906,8 @@ namespace hyperion {
 		/// @headerfile "Hyperion/Option.h"
 		constexpr auto
 		operator=(Option&& option) noexcept(concepts::NoexceptMoveAssignable<T>) -> Option&
-		requires concepts::MoveAssignable<T> || concepts::Reference<T>
+		requires(concepts::MoveAssignable<T> || concepts::Reference<T>)
+				&& concepts::NotTriviallyCopyable<OptionData>
 		{
 
 			if(this == &option) {
@@ -93,6 +93,16 @@ namespace hyperion {
 
 	using option::None;
 
+	namespace result {
+		/// @brief Requires that a `Result` backed by the storage `Data` can use trivial copy and
+		/// move operations. This is never the case when
+		/// `HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED` is enabled, because `Result` then
+		/// has to track whether it has been handled.
+		template<typename Data>
+		concept TrivialResult = (!HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED)
+								&& concepts::TriviallyCopyable<Data>;
+	} // namespace result
+
 	IGNORE_PADDING_START
 	/// @brief A `Result` represents the outcome of an operation that can fail recoverably.
 	///
@@ -230,6 +240,28 @@ namespace hyperion {
 			noexcept(concepts::NoexceptConstructibleFrom<T, Args...>)
 			: ResultData(std::forward<Args>(args)...) {
 		}
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		/// @brief Constructs a `Result` from the given `E`, recording `location` as the error's
+		/// origin
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		constexpr Result(const E& err, // NOLINT
+						 const std::source_location& location = std::source_location::current())
+			noexcept(concepts::NoexceptCopyConstructible<E>)
+		requires concepts::CopyConstructible<E>
+			: ResultData(err), m_origin(location) {
+		}
+		/// @brief Constructs a `Result` from the given `E`, recording `location` as the error's
+		/// origin
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		constexpr Result(E && err, // NOLINT
+						 const std::source_location& location = std::source_location::current())
+			noexcept(concepts::NoexceptMoveConstructible<E>)
+		requires concepts::MoveConstructible<E>
+			: ResultData(std::move(err)), m_origin(location) {
+		}
+	#else
 		/// @brief Constructs a `Result` from the given `E`
 		/// @ingroup result
 		/// @headerfile "Hyperion/Result.h"
@@ -246,6 +278,7 @@ namespace hyperion {
 		requires concepts::MoveConstructible<E>
 			: ResultData(std::move(err)) {
 		}
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 		/// @brief Constructs a `Result` by constructing the `E` in place in the `Result`
 		///
 		/// @tparam Args - The types of the arguments to pass to `E`'s constructor
@@ -267,7 +300,12 @@ namespace hyperion {
 		Result(const hyperion::Err<E>& error) // NOLINT
 			noexcept(concepts::NoexceptCopyConstructible<E>)
 		requires concepts::CopyConstructible<E>
-			: ResultData(error.m_error) {
+			: ResultData(error.m_error)
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			  ,
+			  m_origin(error.origin())
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		{
 		}
 		/// @brief Constructs a `Result` from an `Err`
 		///
@@ -277,7 +315,12 @@ namespace hyperion {
 		Result(hyperion::Err<E> && error) // NOLINT
 			noexcept(concepts::NoexceptMoveConstructible<E>)
 		requires concepts::MoveConstructible<E>
-			: ResultData(std::move(error.m_error)) {
+			: ResultData(std::move(error.m_error))
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			  ,
+			  m_origin(error.origin())
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		{
 		}
 		/// @brief Constructs a `Result` from an `Ok`
 		///
@@ -299,17 +342,36 @@ namespace hyperion {
 		requires concepts::MoveConstructible<T>
 			: ResultData(std::move(ok.m_ok)) {
 		}
+		/// @brief Trivial Copy Constructor, used when both `T` and `E` are trivially copyable
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		constexpr Result(const Result& result) noexcept
+		requires result::TrivialResult<ResultData>
+		= default;
+		/// @brief Trivial Move Constructor, used when both `T` and `E` are trivially copyable
+		///
+		/// Unlike the non-trivial move constructor, this leaves `result` unchanged
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		constexpr Result(Result && result) noexcept
+		requires result::TrivialResult<ResultData>
+		= default;
 		/// @brief Copy Constructor
 		/// @ingroup result
 		/// @headerfile "Hyperion/Result.h"
 		constexpr Result(const Result& result) noexcept(
 			concepts::NoexceptCopyConstructible<ResultData>)
 		requires concepts::CopyConstructible<ResultData>
+				 && (!result::TrivialResult<ResultData>)
 			: ResultData(static_cast<const ResultData&>(result))
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			  ,
 			  m_handled(result.m_handled)
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			  ,
+			  m_origin(result.m_origin)
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 		{
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			result.m_handled = true;
@@ -320,12 +382,16 @@ namespace hyperion {
 		/// @ingroup result
 		/// @headerfile "Hyperion/Result.h"
 		constexpr Result(Result && result) noexcept(concepts::NoexceptMoveConstructible<ResultData>)
-		requires concepts::MoveConstructible<ResultData>
+		requires concepts::MoveConstructible<ResultData> && (!result::TrivialResult<ResultData>)
 			: ResultData(static_cast<ResultData&&>(result))
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			  ,
 			  m_handled(result.m_handled)
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			  ,
+			  m_origin(result.m_origin)
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 		{
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			result.m_handled = true;
@@ -337,7 +403,7 @@ namespace hyperion {
 		/// @ingroup result
 		/// @headerfile "Hyperion/Result.h"
 		constexpr ~Result() noexcept(concepts::NoexceptDestructible<ResultData>) {
-			if(!m_handled && !this->is_empty()) {
+			if(!m_handled && !this->is_empty()) [[unlikely]] {
 				m_handled = true;
 				panic("Unhandled Result that must be handled being destroyed, terminating");
 			}
@@ -349,6 +415,25 @@ namespace hyperion {
 		constexpr ~Result() noexcept(concepts::NoexceptDestructible<ResultData>) = default;
 	#endif
 
+		/// @brief Returns where the error contained in this `Result` originated
+		///
+		/// The origin is recorded when the error is first created (see
+		/// `HYPERION_RESULT_TRACKS_ERROR_ORIGIN`), and is carried along when the error is
+		/// propagated by copying or moving this `Result`, or through its error-preserving
+		/// combinators (`map`, `map_err`, `and_then`). It's unknown if this is `Ok`, if the error
+		/// was constructed in place, or if origin tracking is disabled.
+		///
+		/// @return The origin of the contained error
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		[[nodiscard]] constexpr auto error_origin() const noexcept -> const result::ErrorOrigin& {
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			return m_origin;
+	#else
+			return result::UNKNOWN_ERROR_ORIGIN;
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		}
+
 		/// @brief Returns whether this `Result` is the `Ok` variant
 		///
 		/// @return true if this is `Ok`, otherwise `false`
@@ -384,7 +469,7 @@ namespace hyperion {
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
-			if(!is_ok()) {
+			if(!is_ok()) [[unlikely]] {
 				panic("Result::as_ref called on an Error result, terminating");
 			}
 
@@ -402,7 +487,7 @@ namespace hyperion {
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
-			if(!is_ok()) {
+			if(!is_ok()) [[unlikely]] {
 				panic("Result::as_cref called on an Error result, terminating");
 			}
 
@@ -427,7 +512,7 @@ namespace hyperion {
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
-			if(!is_ok()) {
+			if(!is_ok()) [[unlikely]] {
 				panic("Result::unwrap called on an Error result, terminating");
 			}
 
@@ -539,7 +624,7 @@ namespace hyperion {
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
-			if(!is_ok()) {
+			if(!is_ok()) [[unlikely]] {
 				panic("{}", std::forward<U>(panic_message));
 			}
 
@@ -559,7 +644,7 @@ namespace hyperion {
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
-			if(!is_err()) {
+			if(!is_err()) [[unlikely]] {
 				panic("Result::unwrap_err called on an Ok result, terminating");
 			}
 
@@ -630,19 +715,51 @@ namespace hyperion {
 		requires concepts::InvocableWithReturn<U, F, ok_const_reference>
 				 && concepts::NoexceptMovable<U>
 				 && concepts::NoexceptCopyable<E>
-				 [[nodiscard]] inline auto map(F && map_func) const noexcept -> Result<U, E> {
+				 [[nodiscard]] inline auto map(F && map_func) const& noexcept -> Result<U, E> {
 			// the invocable checks above are probably redundant because of the inferred template
 			// parameters, but we'll keep them for completeness’ sake and clarity of requirements
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			if(!is_ok()) {
-				return hyperion::Err<E>(this->get_err());
+				return hyperion::Err<E>(this->get_err(), error_origin());
 			}
 
 			return hyperion::Ok<U>(std::forward<F>(map_func)(this->get()));
 		}
 
+		/// @brief Maps this `Result` to another one with a potentially different `Ok` type,
+		/// consuming this `Result`.
+		///
+		/// If this is the `Ok` variant, invokes `map_func` with the contained value moved out of
+		/// this and returns the result in a new `Result`. Otherwise, moves the error into a new
+		/// `Result`.
+		///
+		/// @tparam F - The type of the invocable that maps `T`
+		/// @tparam U - The type that the invocable `F` maps `T` to. This will be deduced. Don't
+		/// explicitly provide this
+		/// @param map_func - The invocable to perform the mapping
+		///
+		/// @return the result of `map_func` wrapped in another `Result` if this is `Ok`, otherwise
+		/// the error moved into another `Result`
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		template<typename F,
+				 typename U = decltype(std::declval<F>()(std::declval<ok_rvalue_reference>()))>
+		requires concepts::InvocableWithReturn<U, F, ok_rvalue_reference>
+				 && concepts::NoexceptMovable<U>
+				 && concepts::NoexceptMovable<E>
+				 [[nodiscard]] inline auto map(F && map_func) && noexcept -> Result<U, E> {
+	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			m_handled = true;
+	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			if(!is_ok()) {
+				return hyperion::Err<E>(this->extract_err(), error_origin());
+			}
+
+			return hyperion::Ok<U>(std::forward<F>(map_func)(this->extract()));
+		}
+
 		/// @brief Maps this `Result` to a `U`.
 		///
 		/// If this is the `Ok` variant, invokes `map_func` with a const reference to the contained
@@ -658,7 +775,7 @@ namespace hyperion {
 		/// @headerfile "Hyperion/Result.h"
 		template<typename F, typename U>
 		requires concepts::InvocableWithReturn<U, F, ok_const_reference>
-		[[nodiscard]] inline auto map_or(F && map_func, U && default_value) const noexcept -> U {
+		[[nodiscard]] inline auto map_or(F && map_func, U && default_value) const& noexcept -> U {
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
@@ -669,6 +786,32 @@ namespace hyperion {
 			return std::forward<F>(map_func)(this->get());
 		}
 
+		/// @brief Maps this `Result` to a `U`, consuming this `Result`.
+		///
+		/// If this is the `Ok` variant, invokes `map_func` with the contained value moved out of
+		/// this and returns the result. Otherwise, returns `default_value`.
+		///
+		/// @tparam F - The type of the invocable that maps `T` to `U`
+		/// @tparam U - The type to map to
+		/// @param map_func - The invocable to perform the mapping
+		/// @param default_value - The default value to return if this is the `Err` variant
+		///
+		/// @return The result of the mapping if this is `Ok`, otherwise `default_value`
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		template<typename F, typename U>
+		requires concepts::InvocableWithReturn<U, F, ok_rvalue_reference>
+		[[nodiscard]] inline auto map_or(F && map_func, U && default_value) && noexcept -> U {
+	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			m_handled = true;
+	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			if(!is_ok()) {
+				return std::forward<U>(default_value);
+			}
+
+			return std::forward<F>(map_func)(this->extract());
+		}
+
 		/// @brief Maps this `Result` to a `U`.
 		///
 		/// If this is the `Ok` variant, invokes `map_func` with a const reference to the contained
@@ -697,7 +840,7 @@ namespace hyperion {
 		requires concepts::Same<U, V>
 				 && concepts::InvocableWithReturn<U, F, ok_const_reference>
 				 [[nodiscard]] inline auto map_or_else(F && map_func, G && default_generator)
-					 const noexcept -> U {
+					 const& noexcept -> U {
 			// the invocable checks above are probably redundant because of the inferred template
 			// parameters, but we'll keep them for completeness’ sake and clarity of requirements
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
@@ -710,6 +853,45 @@ namespace hyperion {
 			return std::forward<F>(map_func)(this->get());
 		}
 
+		/// @brief Maps this `Result` to a `U`, consuming this `Result`.
+		///
+		/// If this is the `Ok` variant, invokes `map_func` with the contained value moved out of
+		/// this and returns the result. Otherwise, returns the result of invoking
+		/// `default_generator`
+		///
+		/// @tparam F - The type of the invocable that maps `T`
+		/// @tparam G - The type of the invocable that generates the default value
+		/// @tparam U - The type that the invocable `F` maps `T` to. This will be deduced. Don't
+		/// explicitly provide this.
+		/// @tparam V - The type that the invocable `G` generates. This will be deduced. Don't
+		/// explicitly provide this.
+		/// @param map_func - The invocable to perform the mapping
+		/// @param default_generator - The invocable to generate the default value
+		///
+		/// @note `map_func` and `default_generator` must return the same type
+		///
+		/// @return The result of the mapping if this is `Ok`, otherwise the result of invoking
+		/// `default_generator`
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		template<typename F,
+				 concepts::Invocable G,
+				 typename U = decltype(std::declval<F>()(std::declval<ok_rvalue_reference>())),
+				 typename V = decltype(std::declval<G>()())>
+		requires concepts::Same<U, V>
+				 && concepts::InvocableWithReturn<U, F, ok_rvalue_reference>
+				 [[nodiscard]] inline auto map_or_else(F && map_func, G && default_generator)
+					 && noexcept -> U {
+	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			m_handled = true;
+	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			if(!is_ok()) {
+				return std::forward<G>(default_generator)();
+			}
+
+			return std::forward<F>(map_func)(this->extract());
+		}
+
 		/// @brief Maps this `Result` to a another one, with a potentially different `Error` type.
 		///
 		/// If this is the `Ok` variant, copies the contained value into a new `Result`. Otherwise,
@@ -729,7 +911,7 @@ namespace hyperion {
 		requires concepts::InvocableWithReturn<U, F, err_const_reference>
 				 && concepts::NoexceptCopyable<T>
 				 && concepts::NoexceptCopyable<E>
-				 [[nodiscard]] inline auto map_err(F && map_func) const noexcept -> Result<T, U> {
+				 [[nodiscard]] inline auto map_err(F && map_func) const& noexcept -> Result<T, U> {
 			// the invocable checks above are probably redundant because of the inferred template
 			// parameters, but we'll keep them for completeness’ sake and clarity of requirements
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
@@ -739,7 +921,39 @@ namespace hyperion {
 				return hyperion::Ok<T>(this->get());
 			}
 
-			return hyperion::Err<U>(std::forward<F>(map_func)(this->get_err()));
+			return hyperion::Err<U>(std::forward<F>(map_func)(this->get_err()), error_origin());
+		}
+
+		/// @brief Maps this `Result` to a another one, with a potentially different `Error` type,
+		/// consuming this `Result`.
+		///
+		/// If this is the `Ok` variant, moves the contained value into a new `Result`. Otherwise,
+		/// returns the result of invoking `map_func` with the contained error moved out of this.
+		///
+		/// @tparam F - The type of the invocable that maps `E`
+		/// @tparam U - The type that the invocable `F` maps `E` to. This will be deduced. Don't
+		/// explicitly provide this.
+		/// @param map_func - The function to perform the mapping
+		///
+		/// @return the contained value moved into a new `Result` if this is `Ok`. Otherwise,
+		/// the result of the mapping
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		template<typename F,
+				 typename U = decltype(std::declval<F>()(std::declval<err_rvalue_reference>()))>
+		requires concepts::InvocableWithReturn<U, F, err_rvalue_reference>
+				 && concepts::NoexceptMovable<T>
+				 && concepts::NoexceptMovable<U>
+				 [[nodiscard]] inline auto map_err(F && map_func) && noexcept -> Result<T, U> {
+	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			m_handled = true;
+	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+			if(!is_err()) {
+				return hyperion::Ok<T>(this->extract());
+			}
+
+			return hyperion::Err<U>(std::forward<F>(map_func)(this->extract_err()),
+								error_origin());
 		}
 
 		/// @brief Matches this `Result` to a consuming function, depending on whether it is the
@@ -811,7 +1025,7 @@ namespace hyperion {
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			if(!is_ok()) {
-				return hyperion::Err<E>(this->extract_err());
+				return hyperion::Err<E>(this->extract_err(), error_origin());
 			}
 
 			return hyperion::Ok<R>(std::forward<F>(func)(this->extract()));
@@ -848,7 +1062,7 @@ namespace hyperion {
 			m_handled = true;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			if(!is_ok()) {
-				return hyperion::Err<E>(this->extract_err());
+				return hyperion::Err<E>(this->extract_err(), error_origin());
 			}
 
 			return std::forward<F>(func)(this->extract());
@@ -937,19 +1151,39 @@ namespace hyperion {
 			return is_ok();
 		}
 
+		/// @brief Trivial copy assignment operator, used when both `T` and `E` are trivially
+		/// copyable
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		constexpr auto operator=(const Result& result) noexcept->Result&
+		requires result::TrivialResult<ResultData>
+		= default;
+		/// @brief Trivial move assignment operator, used when both `T` and `E` are trivially
+		/// copyable
+		///
+		/// Unlike the non-trivial move assignment operator, this leaves `result` unchanged
+		/// @ingroup result
+		/// @headerfile "Hyperion/Result.h"
+		constexpr auto operator=(Result&& result) noexcept->Result&
+		requires result::TrivialResult<ResultData>
+		= default;
+
 		/// @brief Copy assignment operator
 		/// @ingroup result
 		/// @headerfile "Hyperion/Result.h"
 		constexpr auto operator=(const Result& result) noexcept(
 			concepts::NoexceptCopyAssignable<ResultData>)
 			->Result&
-		requires concepts::CopyAssignable<ResultData>
+		requires concepts::CopyAssignable<ResultData> && (!result::TrivialResult<ResultData>)
 		{
 			if(this == &result) {
 				return *this;
 			}
 
 			ResultData::operator=(static_cast<const ResultData&>(result));
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			m_origin = result.m_origin;
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			this->m_handled = result.m_handled;
@@ -965,13 +1199,16 @@ namespace hyperion {
 		constexpr auto operator=(Result&& result) noexcept(
 			concepts::NoexceptMoveAssignable<ResultData>)
 			->Result&
-		requires concepts::MoveAssignable<ResultData>
+		requires concepts::MoveAssignable<ResultData> && (!result::TrivialResult<ResultData>)
 		{
 			if(this == &result) {
 				return *this;
 			}
 
 			ResultData::operator=(static_cast<ResultData&&>(result));
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			m_origin = result.m_origin;
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 
 	#if HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
 			this->m_handled = result.m_handled;
@@ -986,6 +1223,11 @@ namespace hyperion {
 		/// whether this `Result` has been handled
 		mutable bool m_handled = false;
 	#endif // HYPERION_RESULT_PANICS_ON_DESTRUCTION_IF_UNHANDLED
+	#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+	  private:
+		/// where the contained error originated
+		result::ErrorOrigin m_origin = {};
+	#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 	};
 	IGNORE_PADDING_STOP
 } // namespace hyperion
@@ -29,11 +29,16 @@
 #include <Hyperion/BasicTypes.h>
 #include <Hyperion/Concepts.h>
 #include <Hyperion/HyperionDef.h>
-#include <Hyperion/Memory.h>
 #include <Hyperion/Option.h>
-#include <gsl/gsl>
+#include <Hyperion/Span.h>
+#include <Hyperion/ringbuffer/detail.h>
+#include <algorithm>
+#include <bit>
+#include <cstring>
 #include <iterator>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace hyperion {
 
@@ -56,18 +61,25 @@ namespace hyperion {
 	/// - insert, emplace: only the element at the position inserted/emplaced
 	/// - pop_back: the element removed and `end()`
 	/// - pop_front: the element removed and `begin()`
+	/// - push_range: as `push_back`, for each element pushed
+	/// - pop_range: as `pop_front`, for each element removed
 	///
-	/// @tparam T - The type to store in the `RingBuffer`. Must Be Default Constructible.
+	/// # Storage
+	/// Elements live in raw, uninitialized storage obtained from `Allocator`. The capacity is
+	/// always a power of two, so mapping a `RingBuffer` index to a slot is a single mask, and
+	/// a slot holds a live element exactly when it is one of the `size()` slots following the
+	/// front of the `RingBuffer`. No separate per-slot bookkeeping is kept.
+	///
+	/// @tparam T - The type to store in the `RingBuffer`.
 	/// Does not currently support `T` of array types (eg, `T` = `U[]` or `T` = `U[N]`)
 	template<typename T, template<typename ElementType> typename Allocator = std::allocator>
 	class RingBuffer {
 	  public:
 		/// Default capacity of `RingBuffer`
 		static const constexpr usize DEFAULT_CAPACITY = 16;
+		static_assert(std::has_single_bit(DEFAULT_CAPACITY),
+					  "RingBuffer capacities must be powers of two");
 		using allocator_traits = std::allocator_traits<Allocator<T>>;
-		using unique_pointer
-			= decltype(allocate_unique<T[]>(std::declval<Allocator<T[]>>(), // NOLINT
-											DEFAULT_CAPACITY));
 
 		/// @brief Random-Access Bidirectional iterator for `RingBuffer`
 		/// @note All navigation operators are checked such that any movement past `begin()` or
@@ -119,14 +131,14 @@ namespace hyperion {
 			}
 
 			inline constexpr auto operator++() noexcept -> Iterator& {
-				m_current_index++;
-				if(m_current_index >= m_container_ptr->capacity()) {
-					m_current_index = m_container_ptr->capacity();
-					m_ptr = m_container_ptr->end().m_ptr;
-				}
-				else {
-					m_ptr = &(*m_container_ptr)[m_current_index];
+				if(m_current_index >= m_container_ptr->size()) {
+					return *this;
 				}
+
+				// walk the current contiguous segment directly, only wrapping back to the
+				// start of the storage when we step off its end
+				m_current_index++;
+				m_ptr = m_container_ptr->next_slot(m_ptr);
 				return *this;
 			}
 
@@ -142,7 +154,7 @@ namespace hyperion {
 				}
 
 				m_current_index--;
-				m_ptr = &(*m_container_ptr)[m_current_index];
+				m_ptr = m_container_ptr->previous_slot(m_ptr);
 				return *this;
 			}
 
@@ -162,8 +174,8 @@ namespace hyperion {
 
 				auto temp = *this;
 				temp.m_current_index += diff;
-				if(temp.m_current_index > temp.m_container_ptr->capacity()) {
-					temp.m_current_index = temp.m_container_ptr->capacity();
+				if(temp.m_current_index > temp.m_container_ptr->size()) {
+					temp.m_current_index = temp.m_container_ptr->size();
 					temp.m_ptr = temp.m_container_ptr->end().m_ptr;
 				}
 				else {
@@ -284,14 +296,14 @@ namespace hyperion {
 			}
 
 			inline constexpr auto operator++() noexcept -> ConstIterator& {
-				m_current_index++;
-				if(m_current_index >= m_container_ptr->capacity()) {
-					m_current_index = m_container_ptr->capacity();
-					m_ptr = m_container_ptr->end().m_ptr;
-				}
-				else {
-					m_ptr = &(*m_container_ptr)[m_current_index];
+				if(m_current_index >= m_container_ptr->size()) {
+					return *this;
 				}
+
+				// walk the current contiguous segment directly, only wrapping back to the
+				// start of the storage when we step off its end
+				m_current_index++;
+				m_ptr = m_container_ptr->next_slot(m_ptr);
 				return *this;
 			}
 
@@ -307,7 +319,7 @@ namespace hyperion {
 				}
 
 				m_current_index--;
-				m_ptr = &(*m_container_ptr)[m_current_index];
+				m_ptr = m_container_ptr->previous_slot(m_ptr);
 				return *this;
 			}
 
@@ -326,8 +338,8 @@ namespace hyperion {
 
 				auto temp = *this;
 				temp.m_current_index += diff;
-				if(temp.m_current_index > temp.m_container_ptr->capacity()) {
-					temp.m_current_index = temp.m_container_ptr->capacity();
+				if(temp.m_current_index > temp.m_container_ptr->size()) {
+					temp.m_current_index = temp.m_container_ptr->size();
 					temp.m_ptr = temp.m_container_ptr->end().m_ptr;
 				}
 				else {
@@ -404,123 +416,90 @@ namespace hyperion {
 		constexpr RingBuffer() noexcept = default;
 
 		/// @brief Creates a `RingBuffer` with (at least) the given initial capacity
+		/// @note The capacity is rounded up to the next power of two
 		///
 		/// @param initial_capacity - The initial capacity of the `RingBuffer`
 		constexpr explicit RingBuffer(usize initial_capacity) noexcept
-			: m_buffer(allocate_unique<T[]>(m_allocator, initial_capacity + 1)), // NOLINT
-			  m_capacity(initial_capacity + 1) {
-			if(!std::is_trivially_destructible_v<T>) {
-				m_constructed = ConstructedChecker<T, Allocator>(m_capacity, m_allocator);
-			}
+			: m_capacity(round_capacity(initial_capacity)),
+			  m_buffer(allocator_traits::allocate(m_allocator, m_capacity)) {
 		}
 
-		/// @brief Constructs a new `RingBuffer` with the given initial capacity and
-		/// fills it with `default_value`
+		/// @brief Constructs a new `RingBuffer` with (at least) the given initial capacity and
+		/// fills it with `initial_capacity` copies of `default_value`
+		/// @note The capacity is rounded up to the next power of two
 		///
 		/// @param initial_capacity - The initial capacity of the `RingBuffer`
 		/// @param default_value - The value to fill the `RingBuffer` with
 		constexpr RingBuffer(usize initial_capacity,
 							 const T& default_value) noexcept
 		requires concepts::NoexceptCopyConstructible<T>
-		: m_buffer(allocate_unique<T[]>(m_allocator, // NOLINT
-										initial_capacity + 1,
-										default_value)),
-		  m_write_index(initial_capacity),
-		  m_start_index(0_usize), // NOLINT
-		  m_capacity(initial_capacity + 1) {
+		: m_capacity(round_capacity(initial_capacity)),
+		  m_buffer(allocator_traits::allocate(m_allocator, m_capacity)),
+		  m_size(initial_capacity) {
 
-			if(!std::is_trivially_destructible_v<T>) {
-				m_constructed = ConstructedChecker<T, Allocator>(m_capacity, m_allocator);
-			}
-
-			for(auto index = m_start_index; index < m_write_index; ++index) {
+			for(auto index = 0_usize; index < m_size; ++index) {
 				allocator_traits::construct(m_allocator,
-											std::addressof(m_buffer[index]),
+											std::addressof(m_buffer[index]), // NOLINT
 											default_value);
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					m_constructed.set_constructed(index, true);
-				}
 			}
 		}
 
 		constexpr RingBuffer(std::initializer_list<T> values) noexcept
-		requires concepts::NoexceptMoveAssignable<T>
-		: m_buffer(allocate_unique<T[]>(m_allocator, // NOLINT
-										values.size() + 1)),
-		  m_write_index(values.size()),
-		  m_capacity(values.size() + 1) {
-
-			if(!std::is_trivially_destructible_v<T>) {
-				m_constructed = ConstructedChecker<T, Allocator>(m_capacity, m_allocator);
-			}
+		requires concepts::NoexceptCopyConstructible<T>
+		: m_capacity(round_capacity(values.size())),
+		  m_buffer(allocator_traits::allocate(m_allocator, m_capacity)),
+		  m_size(values.size()) {
 
-			auto index = m_start_index;
-			for(auto&& val : values) {
+			auto index = 0_usize;
+			for(const auto& val : values) {
 				allocator_traits::construct(m_allocator,
-											std::addressof(m_buffer[index]),
-											std::move(val));
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					m_constructed.set_constructed(index, true);
-				}
+											std::addressof(m_buffer[index]), // NOLINT
+											val);
 				index++;
 			}
 		}
 
 		constexpr RingBuffer(const RingBuffer& buffer) noexcept
 		requires concepts::NoexceptCopyConstructible<T>
-		: m_buffer(allocate_unique<T[]>(m_allocator, buffer.m_capacity)), // NOLINT
-		  m_write_index(buffer.size()),									  // NOLINT
-		  m_start_index(0_usize),										  // NOLINT
-		  m_capacity(buffer.m_capacity) {
+		: m_allocator(allocator_traits::select_on_container_copy_construction(buffer.m_allocator)),
+		  m_capacity(buffer.m_capacity),
+		  m_buffer(allocator_traits::allocate(m_allocator, m_capacity)),
+		  m_size(buffer.m_size) {
 
-			if(!std::is_trivially_destructible_v<T>) {
-				m_constructed = ConstructedChecker<T, Allocator>(m_capacity, m_allocator);
-			}
-
-			const auto size = m_buffer.size();
-			for(auto index = 0_usize; index < size; ++index) {
-				allocator_traits::construct(m_allocator,
-											std::addressof(m_buffer[index]),
-											buffer[index]);
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					m_constructed.set_constructed(index, true);
-				}
+			for(auto index = 0_usize; index < m_size; ++index) {
+				allocator_traits::construct(
+					m_allocator,
+					std::addressof(m_buffer[index]), // NOLINT
+					buffer.m_buffer[buffer.get_adjusted_internal_index(index)]);
 			}
 		}
 
 		constexpr RingBuffer(RingBuffer&& buffer) noexcept
 			: m_allocator(buffer.m_allocator),
-			  m_buffer(std::move(buffer.m_buffer)),
-			  m_write_index(buffer.m_write_index),
-			  m_start_index(buffer.m_start_index),
 			  m_capacity(buffer.m_capacity),
-			  m_constructed(std::move(buffer.m_constructed)) {
+			  m_buffer(buffer.m_buffer),
+			  m_start_index(buffer.m_start_index),
+			  m_size(buffer.m_size) {
 			buffer.m_capacity = 0_usize;
-			buffer.m_write_index = 0_usize;
-			buffer.m_start_index = 0_usize;
 			buffer.m_buffer = nullptr;
+			buffer.m_start_index = 0_usize;
+			buffer.m_size = 0_usize;
 		}
 
 		~RingBuffer() noexcept
 		requires concepts::NoexceptDestructible<T>
 		{
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				for(auto index = 0_usize; index < size(); ++index) {
-					const auto internal = get_adjusted_internal_index(index);
-					if(m_constructed.is_constructed(internal)) {
-						allocator_traits::destroy(m_allocator, std::addressof(m_buffer[internal]));
-					}
-				}
-			}
+			destroy_elements();
+			deallocate();
 		}
 
 		/// @brief Returns the element at the given index.
 		/// @note This is not checked in the same manner as STL containers:
-		/// if index >= capacity, the element at capacity - 1 is returned.
+		/// if index >= capacity, it wraps around to the beginning of the `RingBuffer`
 		///
 		/// @param index - The index of the desired element
 		///
-		/// @return The element at the given index, or at capacity - 1 if index >= capacity
+		/// @return The element at the given index, modulo capacity
 		[[nodiscard]] inline constexpr auto at(concepts::Integral auto index) noexcept -> T& {
 			auto _index = get_adjusted_internal_index(index);
 
@@ -548,33 +527,34 @@ namespace hyperion {
 		}
 
 		/// @brief Returns a pointer to the underlying data in the `RingBuffer`.
-		/// @note This is not sorted in any way to match the representation used by the `RingBuffer`
+		/// @note This is not sorted in any way to match the representation used by the
+		/// `RingBuffer`, and only the `size()` slots starting at the internal index of `front()`
+		/// (wrapping around at `capacity()`) hold live elements
 		///
 		/// @return A pointer to the underlying data
 		[[nodiscard]] inline constexpr auto data() noexcept -> T* {
-			return m_buffer;
+			return std::to_address(m_buffer);
 		}
 
 		/// @brief Returns whether the `RingBuffer` is empty
 		///
 		/// @return `true` if the `RingBuffer` is empty, `false` otherwise
 		[[nodiscard]] inline constexpr auto empty() const noexcept -> bool {
-			return m_write_index == m_start_index;
+			return m_size == 0_usize;
 		}
 
 		/// @brief Returns whether the `RingBuffer` is full
 		///
 		/// @return `true` if the `RingBuffer` is full, `false` otherwise
 		[[nodiscard]] inline constexpr auto full() const noexcept -> bool {
-			return size() == m_capacity - 1;
+			return m_size == m_capacity;
 		}
 
 		/// @brief Returns the current number of elements in the `RingBuffer`
 		///
 		/// @return The current number of elements
 		[[nodiscard]] inline constexpr auto size() const noexcept -> usize {
-			return m_write_index >= m_start_index ? (m_write_index - m_start_index) :
-													(m_capacity - (m_start_index - m_write_index));
+			return m_size;
 		}
 
 		/// @brief Returns the maximum possible number of elements this `RingBuffer` could store
@@ -582,20 +562,21 @@ namespace hyperion {
 		///
 		/// @return The maximum possible number of storable elements
 		[[nodiscard]] inline constexpr auto max_size() const noexcept -> usize {
-			return allocator_traits::max_size(m_allocator) - 1;
+			return std::bit_floor(static_cast<usize>(allocator_traits::max_size(m_allocator)));
 		}
 
 		/// @brief Returns the current capacity of the `RingBuffer`;
 		/// the number of elements it can currently store
+		/// @note This is always a power of two
 		///
 		/// @return The current capacity
 		[[nodiscard]] inline constexpr auto capacity() const noexcept -> usize {
-			return m_capacity - 1;
+			return m_capacity;
 		}
 
 		/// @brief Reserves more storage for the `RingBuffer`. If `new_capacity` is > capacity,
-		/// then the capacity of the `RingBuffer` will be extended until at least `new_capacity`
-		/// elements can be stored.
+		/// then the capacity of the `RingBuffer` will be extended to the next power of two
+		/// >= `new_capacity`.
 		/// @note Memory contiguity is maintained, so no **elements** will be lost or invalidated.
 		/// However, all iterators and references to elements will be invalidated.
 		///
@@ -603,50 +584,36 @@ namespace hyperion {
 		inline constexpr auto reserve(usize new_capacity) noexcept -> void {
 			// we only need to do anything if `new_capacity` is actually larger than `m_capacity`
 			if(new_capacity > m_capacity) {
-				auto temp
-					= allocate_unique<T[], Allocator<T[]>>(m_allocator, new_capacity + 1); // NOLINT
-				auto span = gsl::make_span(std::addressof(temp[0]), new_capacity + 1);
-
-				const auto size = this->size();
-				for(auto index = 0_usize; index < size; ++index) {
-					allocator_traits::construct(
-						m_allocator,
-						// NOLINTNEXTLINE
-						std::addressof(span[index]),
-						// NOLINTNEXTLINE
-						std::move(m_buffer[get_adjusted_internal_index(index)]));
-				}
-
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					ConstructedChecker<T, Allocator> checker
-						= ConstructedChecker<T, Allocator>(new_capacity, m_allocator);
+				const auto capacity = round_capacity(new_capacity);
+				auto temp = allocator_traits::allocate(m_allocator, capacity);
 
-					for(auto index = 0_usize; index < size; ++index) {
-						const auto internal = get_adjusted_internal_index(index);
-						checker.set_constructed(index, m_constructed.is_constructed(internal));
+				for(auto index = 0_usize; index < m_size; ++index) {
+					auto& elem = m_buffer[get_adjusted_internal_index(index)]; // NOLINT
+					if constexpr(concepts::NoexceptMoveConstructible<T>) {
+						allocator_traits::construct(m_allocator,
+													std::addressof(temp[index]), // NOLINT
+													std::move(elem));
+					}
+					else {
+						allocator_traits::construct(m_allocator,
+													std::addressof(temp[index]), // NOLINT
+													elem);
 					}
-
-					m_constructed = std::move(checker);
 				}
-				m_buffer = std::move(temp);
-				m_start_index = 0;
-				m_write_index = m_capacity - 1;
-				m_capacity = new_capacity + 1;
+
+				destroy_elements();
+				deallocate();
+				m_buffer = temp;
+				m_start_index = 0_usize;
+				m_capacity = capacity;
 			}
 		}
 
 		/// @brief Erases all elements from the `RingBuffer`
 		inline constexpr auto clear() noexcept -> void {
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				for(auto index = 0_usize; index < size(); ++index) {
-					const auto internal = get_adjusted_internal_index(index);
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-					allocator_traits::destroy(m_allocator, std::addressof(m_buffer[internal]));
-					m_constructed.set_constructed(index, false);
-				}
-			}
-			m_start_index = 0;
-			m_write_index = 0;
+			destroy_elements();
+			m_start_index = 0_usize;
+			m_size = 0_usize;
 		}
 
 		/// @brief Inserts the given element at the end of the `RingBuffer`
@@ -658,29 +625,13 @@ namespace hyperion {
 				 inline constexpr auto push_back(U&& value) noexcept -> void
 				 requires concepts::NoexceptConstructibleFrom<T, U>
 		{
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				if(m_constructed.is_constructed(m_write_index)) {
-					allocator_traits::destroy(
-						m_allocator,
-						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-						std::addressof(m_buffer[m_write_index]));
-				}
-			}
-
-			allocator_traits::construct(
-				m_allocator,
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				std::addressof(m_buffer[m_write_index]),
-				std::forward<U>(value));
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				m_constructed.set_constructed(m_write_index, true);
-			}
-
-			increment_indices();
+			emplace_back(std::forward<U>(value));
 		}
 
 		/// @brief Constructs the given element in place at the end of the `RingBuffer`
-		/// @note if `size() == capacity()` then this loops and overwrites `front()`
+		/// @note if `size() == capacity()` then this loops and overwrites `front()`.
+		/// `args` may refer to elements of the `RingBuffer` (including `front()`), unless `T` is
+		/// not nothrow move constructible, in which case they must not refer to `front()`
 		///
 		/// @tparam Args - The types of the element's constructor arguments
 		/// @param args - The constructor arguments for the element
@@ -689,31 +640,42 @@ namespace hyperion {
 		template<typename... Args>
 		requires concepts::NoexceptConstructibleFrom<T, Args...>
 		inline constexpr auto emplace_back(Args&&... args) noexcept -> T& {
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				if(m_constructed.is_constructed(m_write_index)) {
-					allocator_traits::destroy(
-						m_allocator,
-						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-						std::addressof(m_buffer[m_write_index]));
-				}
-			}
+			const auto index = get_adjusted_internal_index(m_size);
 
-			allocator_traits::construct(m_allocator,
-										std::addressof(m_buffer[m_write_index]), // NOLINT
-										std::forward<Args>(args)...);
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				m_constructed.set_constructed(m_write_index, true);
-			}
+			if(!full()) {
+				allocator_traits::construct(m_allocator,
+											std::addressof(m_buffer[index]), // NOLINT
+											std::forward<Args>(args)...);
+				m_size++;
 
-			auto index = m_write_index;
+				return m_buffer[index]; // NOLINT
+			}
 
-			increment_indices();
+			// when we're full the slot one past the back is `front()`, so it's live and
+			// has to be destroyed before we can reuse it. `args` may alias `front()`, so
+			// build the new element before evicting the old one
+			if constexpr(concepts::NoexceptMoveConstructible<T>) {
+				T value(std::forward<Args>(args)...);
+				destroy_at(index);
+				increment_start();
+				allocator_traits::construct(m_allocator,
+											std::addressof(m_buffer[index]), // NOLINT
+											std::move(value));
+			}
+			else {
+				destroy_at(index);
+				increment_start();
+				allocator_traits::construct(m_allocator,
+											std::addressof(m_buffer[index]), // NOLINT
+											std::forward<Args>(args)...);
+			}
 
 			return m_buffer[index]; // NOLINT
 		}
 
 		/// @brief Constructs the given element in place at the location
-		/// indicated by the `Iterator` `position`
+		/// indicated by the `Iterator` `position`, replacing the element currently there
+		/// @note if `position` is `end()`, this is equivalent to `emplace_back`
 		///
 		/// @tparam Args - The types of the element's constructor arguments
 		/// @param position - `Iterator` indicating where in the `RingBuffer` to construct the
@@ -724,31 +686,12 @@ namespace hyperion {
 		template<typename... Args>
 		requires concepts::NoexceptConstructibleFrom<T, Args...>
 		inline constexpr auto emplace(const Iterator& position, Args&&... args) noexcept -> T& {
-			auto index = get_adjusted_internal_index(position.get_index());
-
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				if(m_constructed.is_constructed(index)) {
-					allocator_traits::destroy(
-						m_allocator,
-						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-						std::addressof(m_buffer[m_write_index]));
-				}
-			}
-
-			allocator_traits::construct(
-				m_allocator,
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				std::addressof(m_buffer[index]),
-				std::forward<Args>(args)...);
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				m_constructed.set_constructed(index, true);
-			}
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
 
 		/// @brief Constructs the given element in place at the location
-		/// indicated by the `ConstIterator` `position`
+		/// indicated by the `ConstIterator` `position`, replacing the element currently there
+		/// @note if `position` is `cend()`, this is equivalent to `emplace_back`
 		///
 		/// @tparam Args - The types of the element's constructor arguments
 		/// @param position - `ConstIterator` indicating where in the `RingBuffer` to construct the
@@ -757,31 +700,11 @@ namespace hyperion {
 		///
 		/// @return A reference to the element constructed at the location indicated by `position`
 		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
 		inline constexpr auto
 		emplace(const ConstIterator& position, Args&&... args) noexcept -> T& {
-			auto index = get_adjusted_internal_index(position.get_index());
-
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				if(m_constructed.is_constructed(index)) {
-					allocator_traits::destroy(
-						m_allocator,
-						// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-						std::addressof(m_buffer[m_write_index]));
-				}
-			}
-
-			allocator_traits::construct(
-				m_allocator,
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-				std::addressof(m_buffer[index]),
-				std::forward<Args>(args)...);
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				m_constructed.set_constructed(index, true);
-			}
-
-			return m_buffer[index]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return emplace_internal(position.get_index(), std::forward<Args>(args)...);
 		}
-
 		/// @brief Assigns the given element to the position indicated
 		/// by the `Iterator` `position`
 		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
@@ -919,15 +842,12 @@ namespace hyperion {
 		[[nodiscard]] inline constexpr auto pop_back() noexcept -> hyperion::Option<T>
 		requires concepts::NoexceptMoveConstructible<T>
 		{
-			if(size() > 0) {
-				const auto index = get_adjusted_internal_index(size() - 1);
-				auto ret = Some(std::move(m_buffer[index]));
-
-				decrement_write();
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					allocator_traits::destroy(m_allocator, std::addressof(m_buffer[m_write_index]));
-					m_constructed.set_constructed(m_write_index, false);
-				}
+			if(m_size > 0) {
+				const auto index = get_adjusted_internal_index(m_size - 1);
+				auto ret = Some(std::move(m_buffer[index])); // NOLINT
+
+				destroy_at(index);
+				m_size--;
 
 				return ret;
 			}
@@ -941,14 +861,12 @@ namespace hyperion {
 		[[nodiscard]] inline constexpr auto pop_front() noexcept -> hyperion::Option<T>
 		requires concepts::NoexceptMoveConstructible<T>
 		{
-			if(size() > 0) {
-				auto ret = Some(std::move(m_buffer[m_start_index]));
+			if(m_size > 0) {
+				auto ret = Some(std::move(m_buffer[m_start_index])); // NOLINT
 
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					allocator_traits::destroy(m_allocator, std::addressof(m_buffer[m_start_index]));
-					m_constructed.set_constructed(m_start_index, false);
-				}
+				destroy_at(m_start_index);
 				increment_start();
+				m_size--;
 
 				return ret;
 			}
@@ -956,6 +874,104 @@ namespace hyperion {
 			return None();
 		}
 
+		/// @brief Returns the (up to) two contiguous segments of storage holding the elements of
+		/// the `RingBuffer`, in order.
+		/// The first segment starts at `front()`. The second segment is only non-empty when the
+		/// elements wrap around the end of the underlying storage, in which case it ends at
+		/// `back()`.
+		///
+		/// @return The contiguous segments making up the `RingBuffer`, as `Span`s
+		[[nodiscard]] inline constexpr auto as_spans() noexcept -> std::pair<Span<T>, Span<T>> {
+			return detail::ringbuffer::segments(data(), m_start_index, m_size, m_capacity);
+		}
+
+		/// @brief Returns the (up to) two contiguous segments of storage holding the elements of
+		/// the `RingBuffer`, in order.
+		/// The first segment starts at `front()`. The second segment is only non-empty when the
+		/// elements wrap around the end of the underlying storage, in which case it ends at
+		/// `back()`.
+		///
+		/// @return The contiguous segments making up the `RingBuffer`, as read-only `Span`s
+		[[nodiscard]] inline constexpr auto
+		as_spans() const noexcept -> std::pair<Span<const T>, Span<const T>> {
+			const T* slots = std::to_address(m_buffer);
+			return detail::ringbuffer::segments(slots, m_start_index, m_size, m_capacity);
+		}
+
+		/// @brief Copies the given elements onto the end of the `RingBuffer`, in (at most) two
+		/// block copies. For trivially copyable `T`, these are `memcpy`s.
+		/// @note Like `push_back`, if this would exceed `capacity()`, elements are dropped from
+		/// the front of the `RingBuffer`. If `values` itself holds more than `capacity()`
+		/// elements, only the last `capacity()` of them are kept. `values` may refer to elements
+		/// of the `RingBuffer` itself.
+		///
+		/// @param values - The elements to append
+		template<typename U>
+		requires concepts::Same<T, std::remove_const_t<U>>
+		inline constexpr auto push_range(Span<U> values) noexcept -> void
+		requires concepts::NoexceptCopyConstructible<T>
+		{
+			const auto [drop, skip]
+				= detail::ringbuffer::plan_push(m_size, values.size(), m_capacity);
+			if(drop != 0
+			   && detail::ringbuffer::overlaps(static_cast<const T*>(data()),
+											   m_capacity,
+											   static_cast<const T*>(values.data()),
+											   values.size()))
+			{
+				// `values` aliases this `RingBuffer`, so dropping from the front first would
+				// destroy elements before they're copied. Copy them out of the way first
+				auto staged = RingBuffer(m_capacity);
+				staged.push_range(values);
+				push_range(staged.as_spans().first);
+				return;
+			}
+			drop_front(drop);
+
+			const auto count = values.size() - skip;
+			IGNORE_UNSAFE_BUFFER_WARNINGS_START
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto* const first = static_cast<const T*>(values.data()) + skip;
+			detail::ringbuffer::construct_wrapped(m_allocator,
+												  data(),
+												  m_capacity,
+												  get_adjusted_internal_index(m_size),
+												  first,
+												  count);
+			IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+
+			m_size += count;
+		}
+
+		/// @brief Moves (at most) `destination.size()` elements from the front of the
+		/// `RingBuffer` into `destination`, removing them from the `RingBuffer`.
+		/// For trivially copyable `T`, this is (at most) two `memcpy`s.
+		///
+		/// @param destination - Where to move the elements to
+		///
+		/// @return The number of elements moved into `destination`
+		[[nodiscard]] inline constexpr auto pop_range(Span<T> destination) noexcept -> usize
+		requires concepts::NoexceptMoveAssignable<T>
+		{
+			const auto count = detail::ringbuffer::transfer_to(destination, as_spans());
+			drop_front(count);
+
+			return count;
+		}
+
+		/// @brief Copies (at most) `destination.size()` elements from the front of the
+		/// `RingBuffer` into `destination`, leaving the `RingBuffer` unchanged.
+		/// For trivially copyable `T`, this is (at most) two `memcpy`s.
+		///
+		/// @param destination - Where to copy the elements to
+		///
+		/// @return The number of elements copied into `destination`
+		[[nodiscard]] inline constexpr auto copy_to(Span<T> destination) const noexcept -> usize
+		requires concepts::CopyAssignable<T>
+		{
+			return detail::ringbuffer::transfer_to(destination, as_spans());
+		}
+
 		/// @brief Returns a Random Access Bidirectional iterator over the `RingBuffer`,
 		/// at the beginning
 		///
@@ -975,7 +991,7 @@ namespace hyperion {
 		/// @return The iterator, at the end
 		[[nodiscard]] inline constexpr auto end() -> Iterator {
 			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-			T* ptr = std::addressof(m_buffer[m_write_index]);
+			T* ptr = std::addressof(m_buffer[get_adjusted_internal_index(m_size)]);
 
 			return Iterator(ptr, this, size());
 		}
@@ -997,7 +1013,7 @@ namespace hyperion {
 		/// @return The iterator, at the end
 		[[nodiscard]] inline constexpr auto cend() -> ConstIterator {
 			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-			T* ptr = std::addressof(m_buffer[m_write_index]);
+			T* ptr = std::addressof(m_buffer[get_adjusted_internal_index(m_size)]);
 
 			return ConstIterator(ptr, this, size());
 		}
@@ -1020,127 +1036,62 @@ namespace hyperion {
 			if(this == &buffer) {
 				return *this;
 			}
-			auto temp = allocate_unique<T[]>(m_allocator, buffer.m_capacity); // NOLINT
-			const auto size = buffer.size();
-			auto constructed = ConstructedChecker<T, Allocator>(buffer.m_capacity, m_allocator);
 
-			for(auto index = 0_usize; index < size; ++index) {
-				if constexpr(!std::is_trivially_destructible_v<T>) {
-					const auto internal = buffer.get_adjusted_internal_index(index);
-					if(buffer.m_constructed.is_constructed(internal)) {
-						allocator_traits::construct(m_allocator,
-													std::addressof(temp[index]),
-													buffer[index]);
-						constructed.set_constructed(index, true);
-					}
-				}
-				else {
-					const auto internal = buffer.get_adjusted_internal_index(index);
-					allocator_traits::construct(m_allocator,
-												std::addressof(temp[index]),
-												buffer[index]);
-				}
+			destroy_elements();
+			if(m_capacity != buffer.m_capacity) {
+				deallocate();
+				m_capacity = buffer.m_capacity;
+				m_buffer = allocator_traits::allocate(m_allocator, m_capacity);
 			}
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				for(auto index = 0_usize; index < m_capacity; ++index) {
-					if(m_constructed.is_constructed(index)) {
-						allocator_traits::destroy(m_allocator, std::addressof(m_buffer[index]));
-					}
-				}
+
+			for(auto index = 0_usize; index < buffer.m_size; ++index) {
+				allocator_traits::construct(
+					m_allocator,
+					std::addressof(m_buffer[index]), // NOLINT
+					buffer.m_buffer[buffer.get_adjusted_internal_index(index)]);
 			}
-			m_buffer = std::move(temp);
-			m_constructed = std::move(constructed);
-			m_capacity = buffer.m_capacity;
 			m_start_index = 0_usize;
-			m_write_index = size;
+			m_size = buffer.m_size;
 			return *this;
 		}
+
 		constexpr auto operator=(RingBuffer&& buffer) noexcept -> RingBuffer& {
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				for(auto index = 0_usize; index < m_capacity; ++index) {
-					if(m_constructed.is_constructed(index)) {
-						allocator_traits::destroy(m_allocator, std::addressof(m_buffer[index]));
-					}
-				}
+			if(this == &buffer) {
+				return *this;
 			}
+
+			destroy_elements();
+			deallocate();
 			m_allocator = buffer.m_allocator;
-			m_buffer = std::move(buffer.m_buffer);
-			m_write_index = buffer.m_write_index;
-			m_start_index = buffer.m_start_index;
 			m_capacity = buffer.m_capacity;
+			m_buffer = buffer.m_buffer;
+			m_start_index = buffer.m_start_index;
+			m_size = buffer.m_size;
+			buffer.m_capacity = 0_usize;
 			buffer.m_buffer = nullptr;
-			buffer.m_write_index = 0_usize;
 			buffer.m_start_index = 0_usize;
-			buffer.m_capacity = 0_usize;
+			buffer.m_size = 0_usize;
 			return *this;
 		}
 
 	  private:
-		template<typename U, template<typename ElementType> typename UAlloc = std::allocator>
-		class ConstructedChecker;
-
-		template<typename U, template<typename ElementType> typename UAlloc>
-		requires(std::is_trivially_destructible_v<T>)
-		class ConstructedChecker<U, UAlloc> {
-		  public:
-			using Alloc = UAlloc<bool>;
-			explicit ConstructedChecker([[maybe_unused]] usize size,
-										[[maybe_unused]] Alloc alloc = Alloc()) noexcept {
-			}
-
-			ConstructedChecker(const ConstructedChecker&) noexcept = default;
-			ConstructedChecker(ConstructedChecker&&) noexcept = default;
-			~ConstructedChecker() noexcept = default;
-
-			inline auto set_constructed([[maybe_unused]] usize index,
-										[[maybe_unused]] bool constructed) noexcept -> void {
-				// if std::is_trivially_destructible_v<T>, then we do nothing
-			}
-			inline auto is_constructed([[maybe_unused]] usize index) noexcept -> bool {
-				return false;
-			}
-
-			auto operator=(const ConstructedChecker&) noexcept -> ConstructedChecker& = default;
-			auto operator=(ConstructedChecker&&) noexcept -> ConstructedChecker& = default;
-		};
-
-		template<typename U, template<typename ElementType> typename UAlloc>
-		requires(!std::is_trivially_destructible_v<T>)
-		class ConstructedChecker<U, UAlloc> {
-		  public:
-			using Alloc = UAlloc<bool>;
-
-			explicit ConstructedChecker(usize size, Alloc alloc = Alloc()) noexcept
-				: m_flags(size, false, alloc) {
-			}
-
-			ConstructedChecker(const ConstructedChecker&) noexcept = default;
-			ConstructedChecker(ConstructedChecker&&) noexcept = default;
-			~ConstructedChecker() noexcept = default;
-
-			inline auto set_constructed(usize index, bool constructed) noexcept -> void {
-				m_flags[index] = constructed;
-			}
-			inline auto is_constructed(usize index) noexcept -> bool {
-				return m_flags[index];
-			}
-
-			auto operator=(const ConstructedChecker&) noexcept -> ConstructedChecker& = default;
-			auto operator=(ConstructedChecker&&) noexcept -> ConstructedChecker& = default;
+		using pointer = typename allocator_traits::pointer;
 
-		  private:
-			std::vector<bool, Alloc> m_flags;
-		};
-
-		static const constexpr usize DEFAULT_CAPACITY_INTERNAL = DEFAULT_CAPACITY + 1;
 		[[HYPERION_NO_UNIQUE_ADDRESS]] Allocator<T> m_allocator = Allocator<T>();
-		unique_pointer m_buffer
-			= allocate_unique<T[]>(m_allocator, DEFAULT_CAPACITY_INTERNAL); // NOLINT
-		usize m_write_index = 0_usize;
+		usize m_capacity = DEFAULT_CAPACITY;
+		pointer m_buffer = allocator_traits::allocate(m_allocator, DEFAULT_CAPACITY);
 		usize m_start_index = 0_usize;
-		usize m_capacity = DEFAULT_CAPACITY_INTERNAL;
-		[[HYPERION_NO_UNIQUE_ADDRESS]] ConstructedChecker<T, Allocator> m_constructed
-			= ConstructedChecker<T, Allocator>(DEFAULT_CAPACITY_INTERNAL, m_allocator);
+		usize m_size = 0_usize;
+
+		/// @brief Rounds the requested capacity up to the power of two actually used
+		///
+		/// @param requested - The requested capacity
+		///
+		/// @return The capacity to allocate
+		[[nodiscard]] static inline constexpr auto
+		round_capacity(usize requested) noexcept -> usize {
+			return std::bit_ceil(requested);
+		}
 
 		/// @brief Converts the given `RingBuffer` index into the corresponding index into then
 		/// underlying `T` array
@@ -1150,55 +1101,165 @@ namespace hyperion {
 		/// @return The corresponding index into the underlying `T` array
 		[[nodiscard]] inline constexpr auto
 		get_adjusted_internal_index(concepts::Integral auto index) const noexcept -> usize {
-			auto _index = static_cast<usize>(index);
-			return (m_start_index + _index) % m_capacity;
+			return detail::ringbuffer::adjusted_index(m_start_index,
+													  static_cast<usize>(index),
+													  m_capacity);
 		}
 
-		/// @brief Used to increment the start and write indices into the underlying `T` array,
-		/// and the size property, after pushing an element at the back,
-		/// maintaining the logical `RingBuffer` structure
-		inline constexpr auto increment_indices() noexcept -> void {
-			m_write_index = (m_write_index + 1) % m_capacity;
+		/// @brief Used to increment the start index into the underlying `T` array
+		/// after popping or overwriting the element at the front
+		inline constexpr auto increment_start() noexcept -> void {
+			m_start_index = (m_start_index + 1) & (m_capacity - 1);
+		}
 
-			// if write index is at start, we need to push start forward to maintain
-			// the "invalid" spacer element for this.end()
-			if(m_write_index == m_start_index) {
-				m_start_index = (m_start_index + 1) % m_capacity;
+		/// @brief Destroys the element at the given internal index.
+		/// The slot must be live, ie. correspond to a `RingBuffer` index in [0, `size()`)
+		///
+		/// @param internal_index - The index into the underlying `T` array
+		inline constexpr auto destroy_at(usize internal_index) noexcept -> void {
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				allocator_traits::destroy(m_allocator,
+										  std::addressof(m_buffer[internal_index])); // NOLINT
 			}
 		}
 
-		/// @brief Used to increment the start index into the underlying `T` array
-		/// and the size property after popping an element from the front,
-		/// maintaining the logical `RingBuffer` structure
-		inline constexpr auto increment_start() noexcept -> void {
-			if(m_start_index != m_write_index) {
-				m_start_index = (m_start_index + 1) % m_capacity;
+		/// @brief Destroys all live elements, without modifying the indices
+		inline constexpr auto destroy_elements() noexcept -> void {
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				for(auto index = 0_usize; index < m_size; ++index) {
+					destroy_at(get_adjusted_internal_index(index));
+				}
 			}
 		}
 
-		/// @brief Used to decrement the write index into the underlying `T` array
-		/// when popping an element from the back
-		inline constexpr auto decrement_write() noexcept -> void {
-			if(m_write_index == 0_usize) {
-				m_write_index = m_capacity - 1;
+		/// @brief Returns the underlying storage to the allocator
+		inline constexpr auto deallocate() noexcept -> void {
+			if(m_buffer != nullptr) {
+				allocator_traits::deallocate(m_allocator, m_buffer, m_capacity);
+				m_buffer = nullptr;
+			}
+		}
+
+		/// @brief Returns the slot after `slot` in the underlying storage, wrapping around to
+		/// the start of the storage at its end
+		template<typename Pointer>
+		[[nodiscard]] inline constexpr auto next_slot(Pointer slot) const noexcept -> Pointer {
+			auto* const storage = std::to_address(m_buffer);
+
+			IGNORE_UNSAFE_BUFFER_WARNINGS_START
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			slot++;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return slot == storage + m_capacity ? storage : slot;
+			IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+		}
+
+		/// @brief Returns the slot before `slot` in the underlying storage, wrapping around to
+		/// the end of the storage at its start
+		template<typename Pointer>
+		[[nodiscard]] inline constexpr auto previous_slot(Pointer slot) const noexcept -> Pointer {
+			IGNORE_UNSAFE_BUFFER_WARNINGS_START
+			if(slot == std::to_address(m_buffer)) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+				slot += m_capacity;
+			}
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return slot - 1;
+			IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+		}
+
+		/// @brief Destroys the first `count` elements, advancing the front of the `RingBuffer`
+		/// past them
+		inline constexpr auto drop_front(usize count) noexcept -> void {
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				for(auto index = 0_usize; index < count; ++index) {
+					destroy_at(get_adjusted_internal_index(index));
+				}
+			}
+
+			m_size -= count;
+			// once empty, rewind to the start of the storage so the next elements are contiguous
+			m_start_index = m_size == 0 ? 0_usize : get_adjusted_internal_index(count);
+		}
+
+		/// @brief Moves the element at internal index `source` into the live slot at internal
+		/// index `destination`
+		inline constexpr auto move_assign(usize destination, usize source) noexcept -> void {
+			if constexpr(concepts::NoexceptMoveAssignable<T>) {
+				m_buffer[destination] = std::move(m_buffer[source]); // NOLINT
 			}
 			else {
-				m_write_index--;
+				m_buffer[destination] = m_buffer[source]; // NOLINT
 			}
 		}
 
-		inline constexpr auto
-		decrement_write_n(concepts::UnsignedIntegral auto n) noexcept -> void {
-			auto amount_to_decrement = static_cast<usize>(n);
-			if(amount_to_decrement > m_write_index) {
-				amount_to_decrement -= m_write_index;
-				m_write_index = (m_capacity - 1) - amount_to_decrement;
+		/// @brief Moves the element at internal index `source` into the dead slot at internal
+		/// index `destination`
+		inline constexpr auto move_construct(usize destination, usize source) noexcept -> void {
+			if constexpr(concepts::NoexceptMoveConstructible<T>) {
+				allocator_traits::construct(m_allocator,
+											std::addressof(m_buffer[destination]), // NOLINT
+											std::move(m_buffer[source]));			// NOLINT
 			}
 			else {
-				m_write_index -= amount_to_decrement;
+				allocator_traits::construct(m_allocator,
+											std::addressof(m_buffer[destination]), // NOLINT
+											m_buffer[source]);						// NOLINT
 			}
 		}
 
+		/// @brief Shifts the elements in [`external_index`, `size()`) back by one, leaving the slot
+		/// at `external_index` dead and ready to be constructed into
+		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
+		///
+		/// @param external_index - The user-facing index to open a slot at. Must be < `size()`
+		///
+		/// @return The internal index of the opened slot
+		[[nodiscard]] inline constexpr auto open_slot(usize external_index) noexcept -> usize {
+			if(full()) {
+				destroy_at(get_adjusted_internal_index(m_size - 1));
+				m_size--;
+			}
+
+			if(external_index < m_size) {
+				move_construct(get_adjusted_internal_index(m_size),
+							   get_adjusted_internal_index(m_size - 1));
+				for(auto index = m_size - 1; index > external_index; --index) {
+					move_assign(get_adjusted_internal_index(index),
+								get_adjusted_internal_index(index - 1));
+				}
+				destroy_at(get_adjusted_internal_index(external_index));
+			}
+			m_size++;
+
+			return get_adjusted_internal_index(external_index);
+		}
+
+		/// @brief Constructs the given element in place at `external_index`, replacing the element
+		/// currently there
+		///
+		/// @param external_index - The user-facing index into the `RingBuffer` to construct the
+		/// element at
+		/// @param args - The arguments to the constructor for the element
+		///
+		/// @return A reference to the constructed element
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline constexpr auto
+		emplace_internal(usize external_index, Args&&... args) noexcept -> T& {
+			if(external_index >= m_size) {
+				return emplace_back(std::forward<Args>(args)...);
+			}
+
+			const auto index = get_adjusted_internal_index(external_index);
+			destroy_at(index);
+			allocator_traits::construct(m_allocator,
+										std::addressof(m_buffer[index]), // NOLINT
+										std::forward<Args>(args)...);
+
+			return m_buffer[index]; // NOLINT
+		}
+
 		/// @brief Inserts the given element at the position indicated
 		/// by the `external_index`
 		/// @note if `size() == capacity()` this drops the last element out of the `RingBuffer`
@@ -1208,78 +1269,16 @@ namespace hyperion {
 		/// @param elem - The element to store in the `RingBuffer`
 		template<typename U>
 		requires concepts::NoexceptConstructibleFrom<T, U>
-		inline constexpr auto
-		insert_internal(usize external_index, U&& elem) noexcept -> void { // NOLINT
-			auto index = get_adjusted_internal_index(external_index);
-
-			if(index == m_write_index) {
-				emplace_back(elem);
+		inline constexpr auto insert_internal(usize external_index, U&& elem) noexcept -> void {
+			if(external_index >= m_size) {
+				emplace_back(std::forward<U>(elem));
+				return;
 			}
-			else {
-				const auto size_ = size();
-				auto num_to_move = size_ - external_index;
-				auto source_index = num_to_move - 1;
-
-				// if we're full, drop the last element in the buffer
-				if(size_ == m_capacity - 1) [[likely]] { // NOLINT
-					--num_to_move;
-					--source_index;
-					index++;
-				}
 
-				for(auto i = 0_usize; i < num_to_move; ++i, --source_index) {
-					const auto destination = get_adjusted_internal_index(size_ - i);
-					const auto source = get_adjusted_internal_index(external_index + source_index);
-					if(!m_constructed.is_constructed(destination)) {
-						if(m_constructed.is_constructed(source)) {
-							if constexpr(concepts::NoexceptMoveAssignable<T>) {
-								allocator_traits::construct(m_allocator,
-															std::addressof(m_buffer[destination]),
-															std::move(m_buffer[source]));
-							}
-							else {
-								allocator_traits::construct(m_allocator,
-															std::addressof(m_buffer[destination]),
-															m_buffer[source]);
-							}
-
-							m_constructed.set_constructed(destination, true);
-
-							if(!std::is_trivially_destructible_v<T>) {
-								allocator_traits::destroy(m_allocator,
-														  std::addressof(m_buffer[source]));
-								m_constructed.set_constructed(source, false);
-							}
-						}
-					}
-					else {
-						if(m_constructed.is_constructed(source)) {
-							if constexpr(concepts::NoexceptMoveAssignable<T>) {
-								m_buffer[destination] = std::move(m_buffer[source]);
-							}
-							else {
-								m_buffer[destination] = m_buffer[source];
-							}
-							if(!std::is_trivially_destructible_v<T>) {
-								allocator_traits::destroy(m_allocator,
-														  std::addressof(m_buffer[source]));
-								m_constructed.set_constructed(source, false);
-							}
-						}
-					}
-				}
-
-				if(m_constructed.is_constructed(index)) [[unlikely]] {
-					m_buffer[index] = std::forward<U>(elem);
-				}
-				else {
-					allocator_traits::construct(m_allocator,
-												std::addressof(m_buffer[index]),
-												std::forward<U>(elem));
-					m_constructed.set_constructed(index, true);
-				}
-				increment_indices();
-			}
+			const auto index = open_slot(external_index);
+			allocator_traits::construct(m_allocator,
+										std::addressof(m_buffer[index]), // NOLINT
+										std::forward<U>(elem));
 		}
 
 		/// @brief Constructs the given element at the insertion position indicated
@@ -1293,79 +1292,17 @@ namespace hyperion {
 		template<typename... Args>
 		requires concepts::ConstructibleFrom<T, Args...>
 		inline constexpr auto
-		insert_emplace_internal(usize external_index, Args&&... args) noexcept -> T& { // NOLINT
-			auto index = get_adjusted_internal_index(external_index);
-
-			if(index == m_write_index) {
+		insert_emplace_internal(usize external_index, Args&&... args) noexcept -> T& {
+			if(external_index >= m_size) {
 				return emplace_back(std::forward<Args>(args)...);
 			}
 
-			const auto size_ = size();
-			auto num_to_move = size_ - external_index;
-			auto source_index = num_to_move - 1;
-
-			// if we're full, drop the last element in the buffer
-			if(size_ == m_capacity - 1) [[likely]] { // NOLINT
-				--num_to_move;
-				--source_index;
-				index++;
-			}
-
-			for(auto i = 0_usize; i < num_to_move; ++i, --source_index) {
-				const auto destination = get_adjusted_internal_index(size_ - i);
-				const auto source = get_adjusted_internal_index(external_index + source_index);
-				if(!m_constructed.is_constructed(destination)) {
-					if(m_constructed.is_constructed(source)) {
-						if constexpr(concepts::NoexceptMoveAssignable<T>) {
-							allocator_traits::construct(m_allocator,
-														std::addressof(m_buffer[destination]),
-														std::move(m_buffer[source]));
-						}
-						else {
-							allocator_traits::construct(m_allocator,
-														std::addressof(m_buffer[destination]),
-														m_buffer[source]);
-						}
-
-						m_constructed.set_constructed(destination, true);
-
-						if(!std::is_trivially_destructible_v<T>) {
-							allocator_traits::destroy(m_allocator,
-													  std::addressof(m_buffer[source]));
-							m_constructed.set_constructed(source, false);
-						}
-					}
-				}
-				else {
-					if(m_constructed.is_constructed(source)) {
-						if constexpr(concepts::NoexceptMoveAssignable<T>) {
-							m_buffer[destination] = std::move(m_buffer[source]);
-						}
-						else {
-							m_buffer[destination] = m_buffer[source];
-						}
-						if(!std::is_trivially_destructible_v<T>) {
-							allocator_traits::destroy(m_allocator,
-													  std::addressof(m_buffer[source]));
-							m_constructed.set_constructed(source, false);
-						}
-					}
-				}
-			}
-
-			if(m_constructed.is_constructed(index)) [[unlikely]] {
-				allocator_traits::destroy(m_allocator, std::addressof(m_buffer[index]));
-			}
-			else {
-				m_constructed.set_constructed(index, true);
-			}
-
+			const auto index = open_slot(external_index);
 			allocator_traits::construct(m_allocator,
-										std::addressof(m_buffer[index]),
+										std::addressof(m_buffer[index]), // NOLINT
 										std::forward<Args>(args)...);
 
-			increment_indices();
-			return m_buffer[index];
+			return m_buffer[index]; // NOLINT
 		}
 
 		/// @brief Erases the element at the given index, returning an `Iterator` to the element
@@ -1376,63 +1313,19 @@ namespace hyperion {
 		///
 		/// @return `Iterator` pointing to the element after the one removed
 		[[nodiscard]] inline constexpr auto
-		erase_internal(usize external_index) noexcept -> Iterator { // NOLINT
-			const auto index = get_adjusted_internal_index(external_index);
-
-			if(index == m_write_index) [[unlikely]] { // NOLINT
+		erase_internal(usize external_index) noexcept -> Iterator {
+			if(external_index >= m_size) [[unlikely]] { // NOLINT
 				return end();
 			}
-			else {
-				const auto size_ = size();
-				auto num_to_move = (size_ - 1) - external_index;
-				const auto pos_to_move = external_index + 1;
-				const auto pos_to_replace = external_index;
-				for(auto i = 0_usize; i < num_to_move; ++i) {
-					const auto destination = get_adjusted_internal_index(pos_to_replace + i);
-					const auto source = get_adjusted_internal_index(pos_to_move + i);
-					if(!m_constructed.is_constructed(destination)) {
-						if(m_constructed.is_constructed(source)) {
-							if constexpr(concepts::NoexceptMoveAssignable<T>) {
-								allocator_traits::construct(m_allocator,
-															std::addressof(m_buffer[destination]),
-															std::move(m_buffer[source]));
-							}
-							else {
-								allocator_traits::construct(m_allocator,
-															std::addressof(m_buffer[destination]),
-															m_buffer[source]);
-							}
-
-							m_constructed.set_constructed(destination, true);
-
-							if(!std::is_trivially_destructible_v<T>) {
-								allocator_traits::destroy(m_allocator,
-														  std::addressof(m_buffer[source]));
-								m_constructed.set_constructed(source, false);
-							}
-						}
-					}
-					else {
-						if(m_constructed.is_constructed(source)) {
-							if constexpr(concepts::NoexceptMoveAssignable<T>) {
-								m_buffer[destination] = std::move(m_buffer[source]);
-							}
-							else {
-								m_buffer[destination] = m_buffer[source];
-							}
-							if(!std::is_trivially_destructible_v<T>) {
-								allocator_traits::destroy(m_allocator,
-														  std::addressof(m_buffer[source]));
-								m_constructed.set_constructed(source, false);
-							}
-						}
-					}
-				}
-
-				decrement_write();
 
-				return begin() + external_index;
+			for(auto index = external_index; index < m_size - 1; ++index) {
+				move_assign(get_adjusted_internal_index(index),
+							get_adjusted_internal_index(index + 1));
 			}
+			destroy_at(get_adjusted_internal_index(m_size - 1));
+			m_size--;
+
+			return begin() + external_index;
 		}
 
 		/// @brief Erases the range of elements in [`first`, `last`)
@@ -1445,75 +1338,21 @@ namespace hyperion {
 		///
 		/// @return `Iterator` pointing to the element after the last one erased
 		[[nodiscard]] inline constexpr auto
-		erase_internal(usize first, usize last) noexcept -> Iterator { // NOLINT
-			const auto size_ = size();
-			const auto last_internal = get_adjusted_internal_index(last);
-			const auto num_to_remove = (last - first);
-
-			if(last_internal > m_write_index) {
-				if(m_write_index > m_start_index) {
-					decrement_write_n(num_to_remove);
-				}
-				else if(m_write_index < m_start_index) {
-					auto num_after_start_index
-						= (m_write_index > num_to_remove ? m_write_index - num_to_remove : 0_usize);
-					auto num_before_start_index = num_to_remove - num_after_start_index;
-					if(num_after_start_index > 0) {
-						num_after_start_index--;
-						m_write_index = (m_capacity - 1) - num_after_start_index;
-					}
-					else {
-						decrement_write_n(num_before_start_index);
-					}
-				}
-				return end();
+		erase_internal(usize first, usize last) noexcept -> Iterator {
+			last = std::min(last, m_size);
+			if(first >= last) {
+				return begin() + first;
 			}
 
-			const auto num_to_move = size_ - last;
-			const auto pos_to_move = last;
-			const auto pos_to_replace = first;
-			for(auto i = 0_usize; i < num_to_move; ++i) {
-				const auto destination = get_adjusted_internal_index(pos_to_replace + i);
-				const auto source = get_adjusted_internal_index(pos_to_move + i);
-				if(!m_constructed.is_constructed(destination)) {
-					if(m_constructed.is_constructed(source)) {
-						if constexpr(concepts::NoexceptMoveAssignable<T>) {
-							allocator_traits::construct(m_allocator,
-														std::addressof(m_buffer[destination]),
-														std::move(m_buffer[source]));
-						}
-						else {
-							allocator_traits::construct(m_allocator,
-														std::addressof(m_buffer[destination]),
-														m_buffer[source]);
-						}
-
-						m_constructed.set_constructed(destination, true);
-
-						if(!std::is_trivially_destructible_v<T>) {
-							allocator_traits::destroy(m_allocator,
-													  std::addressof(m_buffer[source]));
-							m_constructed.set_constructed(source, false);
-						}
-					}
-				}
-				else {
-					if(m_constructed.is_constructed(source)) {
-						if constexpr(concepts::NoexceptMoveAssignable<T>) {
-							m_buffer[destination] = std::move(m_buffer[source]);
-						}
-						else {
-							m_buffer[destination] = m_buffer[source];
-						}
-						if(!std::is_trivially_destructible_v<T>) {
-							allocator_traits::destroy(m_allocator,
-													  std::addressof(m_buffer[source]));
-							m_constructed.set_constructed(source, false);
-						}
-					}
-				}
+			const auto num_to_remove = last - first;
+			for(auto index = last; index < m_size; ++index) {
+				move_assign(get_adjusted_internal_index(index - num_to_remove),
+							get_adjusted_internal_index(index));
+			}
+			for(auto index = m_size - num_to_remove; index < m_size; ++index) {
+				destroy_at(get_adjusted_internal_index(index));
 			}
-			decrement_write_n(num_to_remove);
+			m_size -= num_to_remove;
 
 			return begin() + first;
 		}
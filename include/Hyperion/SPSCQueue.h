@@ -0,0 +1,339 @@
+/// @file SPSCQueue.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Wait-free single-producer, single-consumer queue with batched publish and consume
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Platform.h>
+#include <Hyperion/Span.h>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A bounded, wait-free queue for handing elements from exactly one producer thread
+	/// to exactly one consumer thread.
+	///
+	/// Unlike `LockFreeQueue`, which supports any number of producers and so pays for several
+	/// atomic read-modify-writes per push, `SPSCQueue` has each index written by only one side:
+	/// the producer owns the write index and the consumer owns the read index, so publishing
+	/// or consuming is a single release store. Each side also keeps a cached copy of the other
+	/// side's index and only reloads it (an acquire load, and a cache-line transfer) when the
+	/// cached value says the queue is full (or empty), so in steady state neither side touches
+	/// the other's cache line.
+	///
+	/// `push_batch` and `pop_batch` move whole batches through the queue with a single index
+	/// publication, amortizing the synchronization cost over the batch.
+	///
+	/// Exactly one thread may call the producer functions (`push_back`, `try_push_back`,
+	/// `emplace_back`, `try_emplace_back`, `push_batch`) and exactly one thread may call the
+	/// consumer functions (`pop_front`, `pop_batch`) at any given time. The capacity is rounded
+	/// up to a power of two. Elements are only constructed while they're in the queue.
+	///
+	/// @tparam T - The type to store in the `SPSCQueue`
+	/// @tparam Allocator - The allocator to allocate the queue's storage with
+	/// @ingroup utils
+	/// @headerfile "Hyperion/SPSCQueue.h"
+	template<typename T, template<typename ElementType> typename Allocator = std::allocator>
+	class SPSCQueue {
+	  public:
+		/// Default capacity of `SPSCQueue`
+		static const constexpr usize DEFAULT_CAPACITY = 16;
+		using allocator_traits = std::allocator_traits<Allocator<T>>;
+
+		/// @brief Creates an `SPSCQueue` with default capacity
+		SPSCQueue() noexcept : SPSCQueue(DEFAULT_CAPACITY) {
+		}
+
+		/// @brief Creates an `SPSCQueue` with (at least) the given capacity
+		///
+		/// @param capacity - The capacity of the `SPSCQueue`. Rounded up to a power of two
+		explicit SPSCQueue(usize capacity) noexcept
+			: m_capacity(std::bit_ceil(std::max(capacity, 1_usize))),
+			  m_buffer(allocator_traits::allocate(m_allocator, m_capacity)) {
+		}
+		SPSCQueue(const SPSCQueue&) = delete;
+		SPSCQueue(SPSCQueue&&) = delete;
+
+		~SPSCQueue() noexcept
+		requires concepts::NoexceptDestructible<T>
+		{
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				const auto write = m_write.load(std::memory_order_acquire);
+				for(auto read = m_read.load(std::memory_order_acquire); read != write; ++read) {
+					std::destroy_at(slot(read));
+				}
+			}
+			allocator_traits::deallocate(m_allocator, m_buffer, m_capacity);
+		}
+
+		/// @brief Returns whether the `SPSCQueue` is empty
+		/// @note When used concurrently, this is only a snapshot
+		///
+		/// @return `true` if the `SPSCQueue` is empty, `false` otherwise
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return size() == 0;
+		}
+
+		/// @brief Returns whether the `SPSCQueue` is full
+		/// @note When used concurrently, this is only a snapshot
+		///
+		/// @return `true` if the `SPSCQueue` is full, `false` otherwise
+		[[nodiscard]] inline auto full() const noexcept -> bool {
+			return size() == m_capacity;
+		}
+
+		/// @brief Returns the current number of elements in the `SPSCQueue`
+		/// @note When used concurrently, this is only a snapshot
+		///
+		/// @return The current number of elements
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			// load the read index first: the write index never falls behind it, so this can't
+			// underflow
+			const auto read = m_read.load(std::memory_order_acquire);
+			const auto write = m_write.load(std::memory_order_acquire);
+			return std::min(write - read, m_capacity);
+		}
+
+		/// @brief Returns the capacity of the `SPSCQueue`
+		///
+		/// @return The capacity
+		[[nodiscard]] inline auto capacity() const noexcept -> usize {
+			return m_capacity;
+		}
+
+		/// @brief Inserts the given element at the end of the `SPSCQueue`
+		/// @note if `size() == capacity()` then this blocks until an element has been removed
+		/// (opening up a space for the to-be-pushed entry)
+		///
+		/// @param value - the element to insert
+		template<typename U>
+		requires concepts::Same<T, std::remove_cvref_t<U>>
+		inline auto push_back(U&& value) noexcept -> void
+		requires concepts::NoexceptConstructibleFrom<T, U>
+		{
+			emplace_back(std::forward<U>(value));
+		}
+
+		/// @brief Inserts the given element at the end of the `SPSCQueue` if the queue is not
+		/// full
+		///
+		/// @param value - the element to insert
+		///
+		/// @return `true` if successfully pushed, `false` if the queue was full
+		template<typename U>
+		requires concepts::Same<T, std::remove_cvref_t<U>>
+		inline auto try_push_back(U&& value) noexcept -> bool
+		requires concepts::NoexceptConstructibleFrom<T, U>
+		{
+			return try_emplace_back(std::forward<U>(value));
+		}
+
+		/// @brief Constructs the given element in place at the end of the `SPSCQueue`
+		/// @note if `size() == capacity()` then this blocks until an element has been removed
+		/// (opening up a space for the to-be-pushed entry)
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline auto emplace_back(Args&&... args) noexcept -> void {
+			while(writable(1_usize) == 0) {
+				// block until we won't overwrite
+			}
+
+			publish_one(std::forward<Args>(args)...);
+		}
+
+		/// @brief Constructs the given element in place at the end of the `SPSCQueue` if the
+		/// queue was not full
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		///
+		/// @return `true` if successfully pushed, `false` if the queue was full
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline auto try_emplace_back(Args&&... args) noexcept -> bool {
+			if(writable(1_usize) == 0) {
+				return false;
+			}
+
+			publish_one(std::forward<Args>(args)...);
+			return true;
+		}
+
+		/// @brief Copies as many of the given elements onto the end of the `SPSCQueue` as
+		/// currently fit, and publishes them to the consumer all at once
+		///
+		/// @param values - The elements to push
+		///
+		/// @return The number of elements pushed (a prefix of `values`)
+		template<typename U>
+		requires concepts::Same<T, std::remove_const_t<U>>
+		[[nodiscard]] inline auto push_batch(Span<U> values) noexcept -> usize
+		requires concepts::NoexceptCopyConstructible<T>
+		{
+			const auto count = std::min(values.size(), writable(values.size()));
+			const auto write = m_write.load(std::memory_order_relaxed);
+			for(auto index = 0_usize; index < count; ++index) {
+				std::construct_at(slot(write + index), values[index]);
+			}
+
+			m_write.store(write + count, std::memory_order_release);
+			return count;
+		}
+
+		/// @brief Removes the first element in the `SPSCQueue` and returns it
+		///
+		/// @return The first element in the `SPSCQueue`, or `None` if it is empty
+		[[nodiscard]] inline auto pop_front() noexcept -> hyperion::Option<T>
+		requires concepts::NoexceptMoveConstructible<T>
+		{
+			if(readable(1_usize) == 0) {
+				return None();
+			}
+
+			const auto read = m_read.load(std::memory_order_relaxed);
+			auto* element = slot(read);
+			auto ret = Some(std::move(*element));
+			std::destroy_at(element);
+			m_read.store(read + 1, std::memory_order_release);
+			return ret;
+		}
+
+		/// @brief Moves (at most) `destination.size()` elements from the front of the
+		/// `SPSCQueue` into `destination`, releasing their slots to the producer all at once
+		///
+		/// @param destination - Where to move the elements to
+		///
+		/// @return The number of elements moved into `destination`
+		[[nodiscard]] inline auto pop_batch(Span<T> destination) noexcept -> usize
+		requires concepts::NoexceptMoveAssignable<T>
+		{
+			return pop_batch(
+				[&destination, index = 0_usize](T&& element) mutable noexcept {
+					destination[index++] = std::move(element);
+				},
+				destination.size());
+		}
+
+		/// @brief Passes (at most) `max_count` elements from the front of the `SPSCQueue` to
+		/// `consumer`, in order, then releases their slots to the producer all at once
+		/// @note The slots are released only after `consumer` has been called for every element
+		/// in the batch, so `max_count` bounds how long the producer may see those slots as
+		/// occupied
+		///
+		/// @param consumer - The function to call with each element
+		/// @param max_count - The maximum number of elements to consume
+		///
+		/// @return The number of elements consumed
+		template<typename F>
+		requires std::is_nothrow_invocable_v<F, T&&>
+		inline auto
+		pop_batch(F&& consumer,
+				  usize max_count = std::numeric_limits<usize>::max()) noexcept -> usize {
+			const auto count = std::min(max_count, readable(std::min(max_count, m_capacity)));
+			const auto read = m_read.load(std::memory_order_relaxed);
+			for(auto index = 0_usize; index < count; ++index) {
+				auto* element = slot(read + index);
+				std::invoke(consumer, std::move(*element));
+				std::destroy_at(element);
+			}
+
+			m_read.store(read + count, std::memory_order_release);
+			return count;
+		}
+
+		auto operator=(const SPSCQueue&) -> SPSCQueue& = delete;
+		auto operator=(SPSCQueue&&) -> SPSCQueue& = delete;
+
+	  private:
+		[[HYPERION_NO_UNIQUE_ADDRESS]] Allocator<T> m_allocator = Allocator<T>();
+		usize m_capacity;
+		typename allocator_traits::pointer m_buffer;
+
+		// producer-owned: the next position to write, and the producer's last view of `m_read`
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<usize> m_write = 0_usize;
+		usize m_cached_read = 0_usize;
+		// consumer-owned: the next position to read, and the consumer's last view of `m_write`
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<usize> m_read = 0_usize;
+		usize m_cached_write = 0_usize;
+
+		/// @brief Returns the storage for the element at `position`
+		[[nodiscard]] inline auto slot(usize position) const noexcept -> T* {
+			IGNORE_UNSAFE_BUFFER_WARNINGS_START
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return std::to_address(m_buffer) + (position & (m_capacity - 1));
+			IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+		}
+
+		/// @brief Returns the number of free slots, reloading the consumer's index only if
+		/// the cached view doesn't show at least `wanted` free slots. Producer-only
+		[[nodiscard]] inline auto writable(usize wanted) noexcept -> usize {
+			const auto write = m_write.load(std::memory_order_relaxed);
+			auto free = m_capacity - (write - m_cached_read);
+			if(free < wanted) {
+				m_cached_read = m_read.load(std::memory_order_acquire);
+				free = m_capacity - (write - m_cached_read);
+			}
+
+			return free;
+		}
+
+		/// @brief Returns the number of published elements, reloading the producer's index
+		/// only if the cached view doesn't show at least `wanted` elements. Consumer-only
+		[[nodiscard]] inline auto readable(usize wanted) noexcept -> usize {
+			const auto read = m_read.load(std::memory_order_relaxed);
+			auto available = m_cached_write - read;
+			if(available < wanted) {
+				m_cached_write = m_write.load(std::memory_order_acquire);
+				available = m_cached_write - read;
+			}
+
+			return available;
+		}
+
+		/// @brief Constructs an element in the next free slot, which must exist, and publishes
+		/// it. Producer-only
+		template<typename... Args>
+		inline auto publish_one(Args&&... args) noexcept -> void {
+			const auto write = m_write.load(std::memory_order_relaxed);
+			std::construct_at(slot(write), std::forward<Args>(args)...);
+			m_write.store(write + 1, std::memory_order_release);
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
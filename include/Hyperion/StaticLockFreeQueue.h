@@ -0,0 +1,343 @@
+/// @file StaticLockFreeQueue.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fixed-capacity lock-free queue with inline storage
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Platform.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <memory>
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A fixed-capacity, lock-free queue with its storage held inline.
+	/// `StaticLockFreeQueue` offers the same push/pop API as `LockFreeQueue`, but never allocates:
+	/// its `Capacity` slots live directly in the object, so it can be placed in static storage
+	/// or in shared memory. `Capacity` must be a power of two, so all index arithmetic reduces
+	/// to masking by a compile-time constant.
+	///
+	/// Each slot carries a sequence number recording whether it is ready to be written or read
+	/// for a given lap around the queue. Producers and consumers claim positions with a single
+	/// compare-exchange and then publish through the slot's sequence number, so any number of
+	/// producers and consumers may use the queue concurrently. Elements are only constructed
+	/// while they're in the queue; `T` need not be default constructible.
+	///
+	/// @tparam T - The type to store in the `StaticLockFreeQueue`
+	/// @tparam Capacity - The number of elements the `StaticLockFreeQueue` can hold.
+	/// Must be a power of two
+	/// @ingroup utils
+	/// @headerfile "Hyperion/StaticLockFreeQueue.h"
+	template<typename T, usize Capacity>
+	class StaticLockFreeQueue {
+		static_assert(std::has_single_bit(Capacity),
+					  "StaticLockFreeQueue's Capacity must be a power of two");
+
+		/// @brief Storage for a single, possibly not-yet-constructed, element, and the sequence
+		/// number tracking its state
+		struct Slot {
+			constexpr Slot() noexcept : m_empty() {
+			}
+			Slot(const Slot&) = delete;
+			Slot(Slot&&) = delete;
+			// NOLINTNEXTLINE(modernize-use-equals-default)
+			constexpr ~Slot() noexcept {
+			}
+			auto operator=(const Slot&) -> Slot& = delete;
+			auto operator=(Slot&&) -> Slot& = delete;
+
+			std::atomic<usize> m_sequence = 0_usize;
+			struct Empty { };
+			union {
+				Empty m_empty;
+				T m_value;
+			};
+		};
+
+		static constexpr usize MASK = Capacity - 1;
+
+	  public:
+		/// @brief Creates an empty `StaticLockFreeQueue`
+		StaticLockFreeQueue() noexcept {
+			for(auto index = 0_usize; index < Capacity; ++index) {
+				m_slots[index].m_sequence.store(index, std::memory_order_relaxed);
+			}
+		}
+		StaticLockFreeQueue(const StaticLockFreeQueue&) = delete;
+		StaticLockFreeQueue(StaticLockFreeQueue&&) = delete;
+
+		~StaticLockFreeQueue() noexcept
+		requires concepts::NoexceptDestructible<T>
+		{
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				const auto write = m_write.load(std::memory_order_acquire);
+				for(auto read = m_read.load(std::memory_order_acquire); read != write; ++read) {
+					std::destroy_at(std::addressof(m_slots[read & MASK].m_value));
+				}
+			}
+		}
+
+		/// @brief Returns whether the `StaticLockFreeQueue` is empty
+		/// @note When used concurrently, this is only a snapshot
+		///
+		/// @return `true` if the `StaticLockFreeQueue` is empty, `false` otherwise
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return size() == 0;
+		}
+
+		/// @brief Returns whether the `StaticLockFreeQueue` is full
+		/// @note When used concurrently, this is only a snapshot
+		///
+		/// @return `true` if the `StaticLockFreeQueue` is full, `false` otherwise
+		[[nodiscard]] inline auto full() const noexcept -> bool {
+			return size() == Capacity;
+		}
+
+		/// @brief Returns the current number of elements in the `StaticLockFreeQueue`
+		/// @note When used concurrently, this is only a snapshot, and may count elements that
+		/// are still being pushed or popped
+		///
+		/// @return The current number of elements
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			const auto read = m_read.load(std::memory_order_acquire);
+			const auto write = m_write.load(std::memory_order_acquire);
+			// the two loads aren't taken atomically together, so clamp the difference
+			return write > read ? std::min(write - read, Capacity) : 0_usize;
+		}
+
+		/// @brief Returns the capacity of the `StaticLockFreeQueue`
+		///
+		/// @return `Capacity`
+		[[nodiscard]] static inline constexpr auto capacity() noexcept -> usize {
+			return Capacity;
+		}
+
+		/// @brief Inserts the given element at the end of the `StaticLockFreeQueue`
+		/// @note if `size() == capacity()` then this blocks until an element has been removed
+		/// (opening up a space for the to-be-pushed entry)
+		///
+		/// @param value - the element to insert
+		template<typename U>
+		requires concepts::Same<T, std::remove_cvref_t<U>>
+		inline auto push_back(U&& value) noexcept -> void
+		requires concepts::NoexceptConstructibleFrom<T, U>
+		{
+			emplace_back(std::forward<U>(value));
+		}
+
+		/// @brief Inserts the given element at the end of the `StaticLockFreeQueue` if the queue
+		/// is not full
+		///
+		/// @param value - the element to insert
+		///
+		/// @return `true` if successfully pushed, `false` if the queue was full
+		template<typename U>
+		requires concepts::Same<T, std::remove_cvref_t<U>>
+		inline auto try_push_back(U&& value) noexcept -> bool
+		requires concepts::NoexceptConstructibleFrom<T, U>
+		{
+			return try_emplace_back(std::forward<U>(value));
+		}
+
+		/// @brief Inserts the given element at the end of the `StaticLockFreeQueue`, dropping the
+		/// element at the front of the queue if it is full
+		///
+		/// @param value - the element to insert
+		template<typename U>
+		requires concepts::Same<T, std::remove_cvref_t<U>>
+		inline auto force_push_back(U&& value) noexcept -> void
+		requires concepts::NoexceptConstructibleFrom<T, U>
+		{
+			force_emplace_back(std::forward<U>(value));
+		}
+
+		/// @brief Constructs the given element in place at the end of the `StaticLockFreeQueue`
+		/// @note if `size() == capacity()` then this blocks until an element has been removed
+		/// (opening up a space for the to-be-pushed entry)
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline auto emplace_back(Args&&... args) noexcept -> void {
+			auto* slot = claim_write();
+			while(slot == nullptr) {
+				// block until we won't overwrite
+				slot = claim_write();
+			}
+
+			publish(slot, std::forward<Args>(args)...);
+		}
+
+		/// @brief Constructs the given element in place at the end of the `StaticLockFreeQueue`
+		/// if the queue was not full
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		///
+		/// @return `true` if successfully pushed, `false` if the queue was full
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline auto try_emplace_back(Args&&... args) noexcept -> bool {
+			auto* slot = claim_write();
+			if(slot == nullptr) {
+				return false;
+			}
+
+			publish(slot, std::forward<Args>(args)...);
+			return true;
+		}
+
+		/// @brief Constructs the given element in place at the end of the `StaticLockFreeQueue`,
+		/// dropping the element at the front of the queue if it is full
+		/// @note Unlike `LockFreeQueue::force_emplace_back`, which overwrites the most recently
+		/// pushed element, this keeps the newest elements and discards the oldest
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline auto force_emplace_back(Args&&... args) noexcept -> void {
+			auto* slot = claim_write();
+			while(slot == nullptr) {
+				discard_front();
+				slot = claim_write();
+			}
+
+			publish(slot, std::forward<Args>(args)...);
+		}
+
+		/// @brief Removes the first element in the `StaticLockFreeQueue` and returns it
+		///
+		/// @return The first element in the `StaticLockFreeQueue`
+		[[nodiscard]] inline auto pop_front() noexcept -> hyperion::Option<T>
+		requires concepts::NoexceptMoveConstructible<T>
+		{
+			auto read = 0_usize;
+			auto* slot = claim_read(read);
+			if(slot == nullptr) {
+				return None();
+			}
+
+			auto ret = Some(std::move(slot->m_value));
+			release(slot, read);
+			return ret;
+		}
+
+		auto operator=(const StaticLockFreeQueue&) -> StaticLockFreeQueue& = delete;
+		auto operator=(StaticLockFreeQueue&&) -> StaticLockFreeQueue& = delete;
+
+	  private:
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<usize> m_write = 0_usize;
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<usize> m_read = 0_usize;
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::array<Slot, Capacity> m_slots;
+
+		/// @brief Claims the next position to write to.
+		/// A slot is writable for position `p` once its sequence number is `p`
+		///
+		/// @return The claimed slot, or `nullptr` if the queue is full
+		[[nodiscard]] inline auto claim_write() noexcept -> Slot* {
+			auto write = m_write.load(std::memory_order_relaxed);
+			while(true) {
+				auto& slot = m_slots[write & MASK];
+				const auto sequence = slot.m_sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<i64>(sequence - write);
+				if(difference == 0) {
+					if(m_write.compare_exchange_weak(write,
+													 write + 1,
+													 std::memory_order_relaxed))
+					{
+						return std::addressof(slot);
+					}
+				}
+				else if(difference < 0) {
+					// the slot still holds the element from the previous lap
+					return nullptr;
+				}
+				else {
+					write = m_write.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// @brief Constructs the element in the claimed `slot` and makes it visible to readers
+		template<typename... Args>
+		inline auto publish(Slot* slot, Args&&... args) noexcept -> void {
+			const auto write = slot->m_sequence.load(std::memory_order_relaxed);
+			std::construct_at(std::addressof(slot->m_value), std::forward<Args>(args)...);
+			slot->m_sequence.store(write + 1, std::memory_order_release);
+		}
+
+		/// @brief Claims the next position to read from.
+		/// A slot is readable for position `p` once its sequence number is `p + 1`
+		///
+		/// @param read - Set to the claimed position
+		///
+		/// @return The claimed slot, or `nullptr` if the queue is empty
+		[[nodiscard]] inline auto claim_read(usize& read) noexcept -> Slot* {
+			read = m_read.load(std::memory_order_relaxed);
+			while(true) {
+				auto& slot = m_slots[read & MASK];
+				const auto sequence = slot.m_sequence.load(std::memory_order_acquire);
+				const auto difference = static_cast<i64>(sequence - (read + 1));
+				if(difference == 0) {
+					if(m_read.compare_exchange_weak(read, read + 1, std::memory_order_relaxed)) {
+						return std::addressof(slot);
+					}
+				}
+				else if(difference < 0) {
+					// nothing has been published to this position yet
+					return nullptr;
+				}
+				else {
+					read = m_read.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// @brief Destroys the element in the claimed `slot` and hands it back to writers for
+		/// the next lap
+		inline auto release(Slot* slot, usize read) noexcept -> void {
+			std::destroy_at(std::addressof(slot->m_value));
+			slot->m_sequence.store(read + Capacity, std::memory_order_release);
+		}
+
+		/// @brief Drops the element at the front of the queue, if any
+		inline auto discard_front() noexcept -> void {
+			auto read = 0_usize;
+			if(auto* slot = claim_read(read); slot != nullptr) {
+				release(slot, read);
+			}
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
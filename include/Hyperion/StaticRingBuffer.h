@@ -0,0 +1,639 @@
+/// @file StaticRingBuffer.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fixed-capacity ring-buffer with inline storage
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Span.h>
+#include <Hyperion/ringbuffer/detail.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A fixed-capacity Ring Buffer with its storage held inline.
+	/// `StaticRingBuffer` mirrors the non-resizing parts of `RingBuffer`'s API, but never
+	/// allocates: its `Capacity` slots live directly in the object, so it can be placed in
+	/// static storage, on the stack, or in shared memory. `Capacity` must be a power of two, so
+	/// all index arithmetic reduces to masking by a compile-time constant.
+	///
+	/// Like `RingBuffer`, slots are uninitialized until an element is pushed into them, and a
+	/// slot holds a live element exactly when it is one of the `size()` slots following the
+	/// front of the buffer.
+	///
+	/// # Iterator Invalidation
+	/// - Read-only operations: never
+	/// - clear: always
+	/// - push_back, emplace_back, push_range: only `end()` until `capacity()` is reached,
+	///   then `begin()` and `end()`
+	/// - pop_back: the element removed and `end()`
+	/// - pop_front, pop_range: the element(s) removed and `begin()`
+	///
+	/// @tparam T - The type to store in the `StaticRingBuffer`
+	/// @tparam Capacity - The number of elements the `StaticRingBuffer` can hold.
+	/// Must be a power of two
+	/// @ingroup utils
+	/// @headerfile "Hyperion/StaticRingBuffer.h"
+	template<typename T, usize Capacity>
+	class StaticRingBuffer {
+		static_assert(std::has_single_bit(Capacity),
+					  "StaticRingBuffer's Capacity must be a power of two");
+
+		/// @brief Storage for a single, possibly not-yet-constructed, element
+		union Slot {
+			constexpr Slot() noexcept : m_empty() {
+			}
+			Slot(const Slot&) = delete;
+			Slot(Slot&&) = delete;
+			// NOLINTNEXTLINE(modernize-use-equals-default)
+			constexpr ~Slot() noexcept {
+			}
+			auto operator=(const Slot&) -> Slot& = delete;
+			auto operator=(Slot&&) -> Slot& = delete;
+
+			struct Empty { };
+			Empty m_empty;
+			T m_value;
+		};
+
+		static_assert(sizeof(Slot) == sizeof(T),
+					  "StaticRingBuffer's slots must be laid out exactly like an array of T");
+
+	  public:
+		/// @brief Random-Access Bidirectional iterator for `StaticRingBuffer`
+		/// @note All navigation operators are checked such that any movement past `begin()` or
+		/// `end()` is ignored.
+		///
+		/// @tparam Element - `T` for a mutable iterator, `const T` for a read-only one
+		template<typename Element>
+		class BasicIterator {
+		  public:
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type = std::ptrdiff_t;
+			using value_type = T;
+			using pointer = Element*;
+			using reference = Element&;
+			using container = std::conditional_t<std::is_const_v<Element>,
+												 const StaticRingBuffer,
+												 StaticRingBuffer>;
+
+			constexpr BasicIterator(container* container_ptr, usize current_index) noexcept
+				: m_container_ptr(container_ptr), m_current_index(current_index) {
+			}
+
+			/// @brief Returns the index in the `StaticRingBuffer` that corresponds
+			/// to the element this iterator points to
+			///
+			/// @return The index corresponding with the element this points to
+			[[nodiscard]] inline constexpr auto get_index() const noexcept -> usize {
+				return m_current_index;
+			}
+
+			inline constexpr auto operator==(const BasicIterator& rhs) const noexcept -> bool {
+				return m_current_index == rhs.m_current_index
+					   && m_container_ptr == rhs.m_container_ptr;
+			}
+
+			inline constexpr auto operator*() const noexcept -> reference {
+				return (*m_container_ptr)[m_current_index];
+			}
+
+			inline constexpr auto operator->() const noexcept -> pointer {
+				return std::addressof((*m_container_ptr)[m_current_index]);
+			}
+
+			inline constexpr auto operator++() noexcept -> BasicIterator& {
+				if(m_current_index < m_container_ptr->size()) {
+					m_current_index++;
+				}
+				return *this;
+			}
+
+			inline constexpr auto operator++(int) noexcept -> BasicIterator {
+				BasicIterator temp = *this;
+				++(*this);
+				return temp;
+			}
+
+			inline constexpr auto operator--() noexcept -> BasicIterator& {
+				if(m_current_index != 0) {
+					m_current_index--;
+				}
+				return *this;
+			}
+
+			inline constexpr auto operator--(int) noexcept -> BasicIterator {
+				BasicIterator temp = *this;
+				--(*this);
+				return temp;
+			}
+
+			inline constexpr auto
+			operator+(difference_type rhs) const noexcept -> BasicIterator {
+				const auto index = static_cast<difference_type>(m_current_index) + rhs;
+				const auto size = static_cast<difference_type>(m_container_ptr->size());
+				return BasicIterator(m_container_ptr,
+									 static_cast<usize>(std::clamp(index,
+																   difference_type(0),
+																   size)));
+			}
+
+			inline constexpr auto operator+=(difference_type rhs) noexcept -> BasicIterator& {
+				*this = *this + rhs;
+				return *this;
+			}
+
+			inline constexpr auto
+			operator-(difference_type rhs) const noexcept -> BasicIterator {
+				return *this + -rhs;
+			}
+
+			inline constexpr auto operator-=(difference_type rhs) noexcept -> BasicIterator& {
+				*this = *this - rhs;
+				return *this;
+			}
+
+			inline constexpr auto
+			operator-(const BasicIterator& rhs) const noexcept -> difference_type {
+				return static_cast<difference_type>(m_current_index)
+					   - static_cast<difference_type>(rhs.m_current_index);
+			}
+
+			inline constexpr auto operator[](difference_type index) const noexcept -> reference {
+				return *(*this + index);
+			}
+
+			inline constexpr auto
+			operator<=>(const BasicIterator& rhs) const noexcept -> std::partial_ordering {
+				if(m_container_ptr != rhs.m_container_ptr) {
+					return std::partial_ordering::unordered;
+				}
+
+				return m_current_index <=> rhs.m_current_index;
+			}
+
+		  private:
+			container* m_container_ptr = nullptr;
+			usize m_current_index = 0;
+		};
+
+		using Iterator = BasicIterator<T>;
+		using ConstIterator = BasicIterator<const T>;
+
+		/// @brief Creates an empty `StaticRingBuffer`
+		constexpr StaticRingBuffer() noexcept = default;
+
+		constexpr StaticRingBuffer(std::initializer_list<T> values) noexcept
+		requires concepts::NoexceptCopyConstructible<T>
+		{
+			// only the last `Capacity` values fit
+			const auto skip = values.size() > Capacity ? values.size() - Capacity : 0_usize;
+			auto index = 0_usize;
+			for(const auto& val : values) {
+				if(index++ >= skip) {
+					push_back(val);
+				}
+			}
+		}
+
+		constexpr StaticRingBuffer(const StaticRingBuffer& buffer) noexcept
+		requires concepts::NoexceptCopyConstructible<T>
+		{
+			for(const auto& val : buffer) {
+				push_back(val);
+			}
+		}
+
+		constexpr StaticRingBuffer(StaticRingBuffer&& buffer) noexcept
+		requires concepts::NoexceptMoveConstructible<T>
+		{
+			for(auto& val : buffer) {
+				emplace_back(std::move(val));
+			}
+			buffer.clear();
+		}
+
+		constexpr ~StaticRingBuffer() noexcept
+		requires concepts::NoexceptDestructible<T>
+		{
+			clear();
+		}
+
+		/// @brief Returns the element at the given index.
+		/// @note This is not checked in the same manner as STL containers:
+		/// if index >= capacity, it wraps around to the beginning of the `StaticRingBuffer`
+		///
+		/// @param index - The index of the desired element
+		///
+		/// @return The element at the given index, modulo capacity
+		[[nodiscard]] inline constexpr auto at(usize index) noexcept -> T& {
+			return slot(get_adjusted_internal_index(index));
+		}
+
+		/// @brief Returns the element at the given index.
+		/// @note This is not checked in the same manner as STL containers:
+		/// if index >= capacity, it wraps around to the beginning of the `StaticRingBuffer`
+		///
+		/// @param index - The index of the desired element
+		///
+		/// @return The element at the given index, modulo capacity
+		[[nodiscard]] inline constexpr auto at(usize index) const noexcept -> const T& {
+			return slot(get_adjusted_internal_index(index));
+		}
+
+		/// @brief Returns the first element in the `StaticRingBuffer`
+		///
+		/// @return The first element
+		[[nodiscard]] inline constexpr auto front() noexcept -> T& {
+			return slot(m_start_index);
+		}
+
+		/// @brief Returns the last element in the `StaticRingBuffer`
+		/// @note If <= 1 elements are in the `StaticRingBuffer`, this will be the same as `front`
+		///
+		/// @return The last element
+		[[nodiscard]] inline constexpr auto back() noexcept -> T& {
+			return slot(get_adjusted_internal_index(m_size - 1));
+		}
+
+		/// @brief Returns whether the `StaticRingBuffer` is empty
+		///
+		/// @return `true` if the `StaticRingBuffer` is empty, `false` otherwise
+		[[nodiscard]] inline constexpr auto empty() const noexcept -> bool {
+			return m_size == 0_usize;
+		}
+
+		/// @brief Returns whether the `StaticRingBuffer` is full
+		///
+		/// @return `true` if the `StaticRingBuffer` is full, `false` otherwise
+		[[nodiscard]] inline constexpr auto full() const noexcept -> bool {
+			return m_size == Capacity;
+		}
+
+		/// @brief Returns the current number of elements in the `StaticRingBuffer`
+		///
+		/// @return The current number of elements
+		[[nodiscard]] inline constexpr auto size() const noexcept -> usize {
+			return m_size;
+		}
+
+		/// @brief Returns the capacity of the `StaticRingBuffer`
+		///
+		/// @return `Capacity`
+		[[nodiscard]] static inline constexpr auto capacity() noexcept -> usize {
+			return Capacity;
+		}
+
+		/// @brief Erases all elements from the `StaticRingBuffer`
+		inline constexpr auto clear() noexcept -> void {
+			drop_front(m_size);
+		}
+
+		/// @brief Inserts the given element at the end of the `StaticRingBuffer`
+		/// @note if `size() == capacity()` then this loops and overwrites `front()`
+		///
+		/// @param value - the element to insert
+		template<typename U>
+		requires concepts::Same<T, std::remove_cvref_t<U>>
+		inline constexpr auto push_back(U&& value) noexcept -> void
+		requires concepts::NoexceptConstructibleFrom<T, U>
+		{
+			emplace_back(std::forward<U>(value));
+		}
+
+		/// @brief Constructs the given element in place at the end of the `StaticRingBuffer`
+		/// @note if `size() == capacity()` then this loops and overwrites `front()`.
+		/// `args` may refer to elements of the `StaticRingBuffer` (including `front()`), unless
+		/// `T` is not nothrow move constructible, in which case they must not refer to `front()`
+		///
+		/// @tparam Args - The types of the element's constructor arguments
+		/// @param args - The constructor arguments for the element
+		///
+		/// @return A reference to the element constructed at the end of the `StaticRingBuffer`
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		inline constexpr auto emplace_back(Args&&... args) noexcept -> T& {
+			const auto index = get_adjusted_internal_index(m_size);
+			auto* const element = std::addressof(m_slots[index].m_value); // NOLINT
+
+			if(!full()) {
+				m_size++;
+				return *std::construct_at(element, std::forward<Args>(args)...);
+			}
+
+			// when we're full the slot one past the back is `front()`, so it's live and
+			// has to be destroyed before we can reuse it. `args` may alias `front()`, so
+			// build the new element before evicting the old one
+			if constexpr(concepts::NoexceptMoveConstructible<T>) {
+				T value(std::forward<Args>(args)...);
+				std::destroy_at(element);
+				m_start_index = get_adjusted_internal_index(1);
+				return *std::construct_at(element, std::move(value));
+			}
+			else {
+				std::destroy_at(element);
+				m_start_index = get_adjusted_internal_index(1);
+				return *std::construct_at(element, std::forward<Args>(args)...);
+			}
+		}
+
+		/// @brief Removes the last element in the `StaticRingBuffer` and returns it
+		///
+		/// @return The last element in the `StaticRingBuffer`
+		[[nodiscard]] inline constexpr auto pop_back() noexcept -> hyperion::Option<T>
+		requires concepts::NoexceptMoveConstructible<T>
+		{
+			if(m_size == 0) {
+				return None();
+			}
+
+			auto& elem = back();
+			auto ret = Some(std::move(elem));
+			std::destroy_at(std::addressof(elem));
+			m_size--;
+
+			return ret;
+		}
+
+		/// @brief Removes the first element in the `StaticRingBuffer` and returns it
+		///
+		/// @return The first element in the `StaticRingBuffer`
+		[[nodiscard]] inline constexpr auto pop_front() noexcept -> hyperion::Option<T>
+		requires concepts::NoexceptMoveConstructible<T>
+		{
+			if(m_size == 0) {
+				return None();
+			}
+
+			auto ret = Some(std::move(front()));
+			drop_front(1);
+
+			return ret;
+		}
+
+		/// @brief Returns the (up to) two contiguous segments of storage holding the elements of
+		/// the `StaticRingBuffer`, in order.
+		///
+		/// @return The contiguous segments making up the `StaticRingBuffer`, as `Span`s
+		[[nodiscard]] inline constexpr auto as_spans() noexcept -> std::pair<Span<T>, Span<T>> {
+			return detail::ringbuffer::segments(storage(), m_start_index, m_size, Capacity);
+		}
+
+		/// @brief Returns the (up to) two contiguous segments of storage holding the elements of
+		/// the `StaticRingBuffer`, in order.
+		///
+		/// @return The contiguous segments making up the `StaticRingBuffer`, as read-only `Span`s
+		[[nodiscard]] inline constexpr auto
+		as_spans() const noexcept -> std::pair<Span<const T>, Span<const T>> {
+			return detail::ringbuffer::segments(storage(), m_start_index, m_size, Capacity);
+		}
+
+		/// @brief Copies the given elements onto the end of the `StaticRingBuffer`, in (at most)
+		/// two block copies. For trivially copyable `T`, these are `memcpy`s.
+		/// @note Like `push_back`, if this would exceed `capacity()`, elements are dropped from
+		/// the front of the `StaticRingBuffer`. If `values` itself holds more than `capacity()`
+		/// elements, only the last `capacity()` of them are kept. `values` may refer to elements
+		/// of the `StaticRingBuffer` itself.
+		///
+		/// @param values - The elements to append
+		template<typename U>
+		requires concepts::Same<T, std::remove_const_t<U>>
+		inline constexpr auto push_range(Span<U> values) noexcept -> void
+		requires concepts::NoexceptCopyConstructible<T>
+		{
+			const auto [drop, skip]
+				= detail::ringbuffer::plan_push(m_size, values.size(), Capacity);
+			if(drop != 0
+			   && detail::ringbuffer::overlaps(static_cast<const T*>(storage()),
+											   Capacity,
+											   static_cast<const T*>(values.data()),
+											   values.size()))
+			{
+				// `values` aliases this `StaticRingBuffer`, so dropping from the front first would
+				// destroy elements before they're copied. Copy them out of the way first
+				auto staged = StaticRingBuffer();
+				staged.push_range(values);
+				push_range(staged.as_spans().first);
+				return;
+			}
+			drop_front(drop);
+
+			const auto count = values.size() - skip;
+			auto allocator = std::allocator<T>();
+			IGNORE_UNSAFE_BUFFER_WARNINGS_START
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			const auto* const first = static_cast<const T*>(values.data()) + skip;
+			detail::ringbuffer::construct_wrapped(allocator,
+												  storage(),
+												  Capacity,
+												  get_adjusted_internal_index(m_size),
+												  first,
+												  count);
+			IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+
+			m_size += count;
+		}
+
+		/// @brief Moves (at most) `destination.size()` elements from the front of the
+		/// `StaticRingBuffer` into `destination`, removing them from the `StaticRingBuffer`.
+		/// For trivially copyable `T`, this is (at most) two `memcpy`s.
+		///
+		/// @param destination - Where to move the elements to
+		///
+		/// @return The number of elements moved into `destination`
+		[[nodiscard]] inline constexpr auto pop_range(Span<T> destination) noexcept -> usize
+		requires concepts::NoexceptMoveAssignable<T>
+		{
+			const auto count = detail::ringbuffer::transfer_to(destination, as_spans());
+			drop_front(count);
+
+			return count;
+		}
+
+		/// @brief Copies (at most) `destination.size()` elements from the front of the
+		/// `StaticRingBuffer` into `destination`, leaving the `StaticRingBuffer` unchanged.
+		/// For trivially copyable `T`, this is (at most) two `memcpy`s.
+		///
+		/// @param destination - Where to copy the elements to
+		///
+		/// @return The number of elements copied into `destination`
+		[[nodiscard]] inline constexpr auto copy_to(Span<T> destination) const noexcept -> usize
+		requires concepts::CopyAssignable<T>
+		{
+			return detail::ringbuffer::transfer_to(destination, as_spans());
+		}
+
+		/// @brief Returns a Random Access Bidirectional iterator over the `StaticRingBuffer`,
+		/// at the beginning
+		///
+		/// @return The iterator, at the beginning
+		[[nodiscard]] inline constexpr auto begin() noexcept -> Iterator {
+			return Iterator(this, 0_usize);
+		}
+
+		/// @brief Returns a Random Access Bidirectional iterator over the `StaticRingBuffer`,
+		/// at the end
+		///
+		/// @return The iterator, at the end
+		[[nodiscard]] inline constexpr auto end() noexcept -> Iterator {
+			return Iterator(this, m_size);
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the beginning
+		///
+		/// @return The iterator, at the beginning
+		[[nodiscard]] inline constexpr auto begin() const noexcept -> ConstIterator {
+			return ConstIterator(this, 0_usize);
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the end
+		///
+		/// @return The iterator, at the end
+		[[nodiscard]] inline constexpr auto end() const noexcept -> ConstIterator {
+			return ConstIterator(this, m_size);
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the beginning
+		///
+		/// @return The iterator, at the beginning
+		[[nodiscard]] inline constexpr auto cbegin() const noexcept -> ConstIterator {
+			return begin();
+		}
+
+		/// @brief Returns a Random Access Bidirectional read-only iterator over the
+		/// `StaticRingBuffer`, at the end
+		///
+		/// @return The iterator, at the end
+		[[nodiscard]] inline constexpr auto cend() const noexcept -> ConstIterator {
+			return end();
+		}
+
+		/// @brief Unchecked access-by-index operator
+		///
+		/// @param index - The index to get the corresponding element for
+		///
+		/// @return - The element at index
+		[[nodiscard]] inline constexpr auto operator[](usize index) noexcept -> T& {
+			return at(index);
+		}
+
+		/// @brief Unchecked access-by-index operator
+		///
+		/// @param index - The index to get the corresponding element for
+		///
+		/// @return - The element at index
+		[[nodiscard]] inline constexpr auto operator[](usize index) const noexcept -> const T& {
+			return at(index);
+		}
+
+		constexpr auto operator=(const StaticRingBuffer& buffer) noexcept -> StaticRingBuffer&
+		requires concepts::NoexceptCopyConstructible<T>
+		{
+			if(this == &buffer) {
+				return *this;
+			}
+
+			clear();
+			for(const auto& val : buffer) {
+				push_back(val);
+			}
+			return *this;
+		}
+
+		constexpr auto operator=(StaticRingBuffer&& buffer) noexcept -> StaticRingBuffer&
+		requires concepts::NoexceptMoveConstructible<T>
+		{
+			if(this == &buffer) {
+				return *this;
+			}
+
+			clear();
+			for(auto& val : buffer) {
+				emplace_back(std::move(val));
+			}
+			buffer.clear();
+			return *this;
+		}
+
+	  private:
+		std::array<Slot, Capacity> m_slots = {};
+		usize m_start_index = 0_usize;
+		usize m_size = 0_usize;
+
+		/// @brief Converts the given `StaticRingBuffer` index into the corresponding index into
+		/// the underlying storage
+		[[nodiscard]] inline constexpr auto
+		get_adjusted_internal_index(usize index) const noexcept -> usize {
+			return detail::ringbuffer::adjusted_index(m_start_index, index, Capacity);
+		}
+
+		/// @brief Returns the underlying storage, viewed as an array of `T`
+		[[nodiscard]] inline constexpr auto storage() noexcept -> T* {
+			return std::addressof(m_slots[0].m_value); // NOLINT
+		}
+
+		/// @brief Returns the underlying storage, viewed as an array of `T`
+		[[nodiscard]] inline constexpr auto storage() const noexcept -> const T* {
+			return std::addressof(m_slots[0].m_value); // NOLINT
+		}
+
+		/// @brief Returns the (live) element in the slot at the given internal index
+		[[nodiscard]] inline constexpr auto slot(usize internal_index) noexcept -> T& {
+			return m_slots[internal_index].m_value; // NOLINT
+		}
+
+		/// @brief Returns the (live) element in the slot at the given internal index
+		[[nodiscard]] inline constexpr auto
+		slot(usize internal_index) const noexcept -> const T& {
+			return m_slots[internal_index].m_value; // NOLINT
+		}
+
+		/// @brief Destroys the first `count` elements, advancing the front of the
+		/// `StaticRingBuffer` past them
+		inline constexpr auto drop_front(usize count) noexcept -> void {
+			if constexpr(!std::is_trivially_destructible_v<T>) {
+				for(auto index = 0_usize; index < count; ++index) {
+					std::destroy_at(std::addressof(slot(get_adjusted_internal_index(index))));
+				}
+			}
+
+			m_size -= count;
+			m_start_index = m_size == 0 ? 0_usize : get_adjusted_internal_index(count);
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
@@ -41,9 +41,12 @@
 #include <Hyperion/Logger.h>
 #include <Hyperion/MPL.h>
 #include <Hyperion/Memory.h>
+#include <Hyperion/NonZero.h>
 #include <Hyperion/Option.h>
 #include <Hyperion/Result.h>
 #include <Hyperion/RingBuffer.h>
 #include <Hyperion/Span.h>
+#include <Hyperion/StaticRingBuffer.h>
 #include <Hyperion/Synchronization.h>
 #include <Hyperion/TypeTraits.h>
+#include <Hyperion/WindowedStats.h>
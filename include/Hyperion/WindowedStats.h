@@ -0,0 +1,463 @@
+/// @file WindowedStats.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Sliding-window statistics maintained incrementally over a `RingBuffer`
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/Error.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Ignore.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Result.h>
+#include <Hyperion/RingBuffer.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <vector>
+
+namespace hyperion {
+
+	IGNORE_PADDING_START
+	/// @brief A mergeable, relative-accuracy quantile sketch.
+	/// Values are counted in logarithmically sized buckets, so any quantile estimate is within
+	/// `relative_accuracy` of a value actually in the sketch. Values can be removed as well as
+	/// added, which lets the sketch track a sliding window, and two sketches created with the
+	/// same parameters can be merged by adding their bucket counts.
+	///
+	/// Values <= `MIN_INDEXABLE_VALUE` (including zero and negative values) share a single
+	/// bucket and are estimated as `0`. Values too large for the last bucket are counted in it.
+	/// @ingroup utils
+	/// @headerfile "Hyperion/WindowedStats.h"
+	class QuantileSketch {
+	  public:
+		/// The default bound on the relative error of quantile estimates
+		static constexpr f64 DEFAULT_RELATIVE_ACCURACY = 0.01;
+		/// The default number of buckets
+		static constexpr usize DEFAULT_NUM_BUCKETS = 4096;
+		/// The smallest value that is given its own bucket
+		static constexpr f64 MIN_INDEXABLE_VALUE = 1.0e-9;
+
+		/// @brief Constructs an empty `QuantileSketch`
+		///
+		/// @param relative_accuracy - The bound on the relative error of quantile estimates.
+		/// Must be in (0, 1)
+		/// @param num_buckets - The number of buckets to use. With the defaults, this covers
+		/// values up to ~1e26
+		explicit QuantileSketch(f64 relative_accuracy = DEFAULT_RELATIVE_ACCURACY,
+								usize num_buckets = DEFAULT_NUM_BUCKETS) noexcept
+			: m_relative_accuracy(relative_accuracy),
+			  m_log_gamma(std::log1p(2.0 * relative_accuracy / (1.0 - relative_accuracy))),
+			  m_min_key(key_unclamped(MIN_INDEXABLE_VALUE)),
+			  m_buckets(num_buckets, 0_u64) {
+		}
+
+		/// @brief Counts `value` in the sketch
+		///
+		/// @param value - The value to add
+		inline auto add(f64 value) noexcept -> void {
+			m_buckets[index_of(value)]++;
+			m_count++;
+		}
+
+		/// @brief Removes one count of `value` from the sketch.
+		/// `value` must have previously been added
+		///
+		/// @param value - The value to remove
+		inline auto remove(f64 value) noexcept -> void {
+			auto& bucket = m_buckets[index_of(value)];
+			if(bucket != 0) {
+				bucket--;
+				m_count--;
+			}
+		}
+
+		/// @brief Adds the counts of `sketch` into this one
+		///
+		/// @param sketch - The sketch to merge into this one
+		///
+		/// @return `Ok` on success
+		///
+		/// # Errors
+		/// Returns an `EINVAL` `SystemError` if `sketch` was created with different parameters
+		[[nodiscard]] inline auto merge(const QuantileSketch& sketch) noexcept -> Result<None> {
+			// NOLINTNEXTLINE(clang-diagnostic-float-equal)
+			if(sketch.m_relative_accuracy != m_relative_accuracy
+			   || sketch.m_buckets.size() != m_buckets.size())
+			{
+				return Err(error::SystemError(EINVAL));
+			}
+
+			std::transform(m_buckets.begin(),
+						   m_buckets.end(),
+						   sketch.m_buckets.begin(),
+						   m_buckets.begin(),
+						   [](u64 lhs, u64 rhs) noexcept { return lhs + rhs; });
+			m_count += sketch.m_count;
+
+			return Ok();
+		}
+
+		/// @brief Estimates the `quantile`th quantile of the values in the sketch
+		///
+		/// @param quantile - The quantile to estimate, in [0, 1] (e.g. `0.99` for p99)
+		///
+		/// @return The estimate, or `None` if the sketch is empty
+		[[nodiscard]] inline auto quantile(f64 quantile) const noexcept -> Option<f64> {
+			if(m_count == 0) {
+				return None();
+			}
+
+			const auto rank = static_cast<u64>(std::clamp(quantile, 0.0, 1.0)
+											   * static_cast<f64>(m_count - 1));
+			auto seen = 0_u64;
+			for(auto index = 0_usize; index < m_buckets.size(); ++index) {
+				seen += m_buckets[index];
+				if(seen > rank) {
+					return Some(value_of(index));
+				}
+			}
+
+			return Some(value_of(m_buckets.size() - 1));
+		}
+
+		/// @brief Returns the number of values in the sketch
+		///
+		/// @return The number of values
+		[[nodiscard]] inline auto count() const noexcept -> u64 {
+			return m_count;
+		}
+
+		/// @brief Returns the bound on the relative error of quantile estimates
+		///
+		/// @return The relative accuracy
+		[[nodiscard]] inline auto relative_accuracy() const noexcept -> f64 {
+			return m_relative_accuracy;
+		}
+
+		/// @brief Removes all values from the sketch
+		inline auto clear() noexcept -> void {
+			std::fill(m_buckets.begin(), m_buckets.end(), 0_u64);
+			m_count = 0_u64;
+		}
+
+	  private:
+		f64 m_relative_accuracy;
+		f64 m_log_gamma;
+		i64 m_min_key;
+		std::vector<u64> m_buckets;
+		u64 m_count = 0_u64;
+
+		[[nodiscard]] inline auto key_unclamped(f64 value) const noexcept -> i64 {
+			return static_cast<i64>(std::ceil(std::log(value) / m_log_gamma));
+		}
+
+		/// @brief Returns the bucket `value` is counted in. Bucket 0 holds all values
+		/// <= `MIN_INDEXABLE_VALUE`
+		[[nodiscard]] inline auto index_of(f64 value) const noexcept -> usize {
+			if(!(value > MIN_INDEXABLE_VALUE)) {
+				return 0_usize;
+			}
+
+			const auto index = key_unclamped(value) - m_min_key;
+			return std::min(static_cast<usize>(std::max(index, 1_i64)), m_buckets.size() - 1);
+		}
+
+		/// @brief Returns the value representing the bucket at `index`, which is within
+		/// `relative_accuracy` of every value counted in it
+		[[nodiscard]] inline auto value_of(usize index) const noexcept -> f64 {
+			if(index == 0) {
+				return 0.0;
+			}
+
+			const auto key = static_cast<f64>(static_cast<i64>(index) + m_min_key);
+			// the bucket for `key` covers (gamma^(key - 1), gamma^key]
+			return 2.0 * std::exp(key * m_log_gamma) / (1.0 + std::exp(m_log_gamma));
+		}
+	};
+
+	/// @brief Whether a `WindowedStats` should maintain a `QuantileSketch` for its window
+	/// @ingroup utils
+	/// @headerfile "Hyperion/WindowedStats.h"
+	enum class QuantileTracking : u8 {
+		Disabled = 0,
+		Enabled
+	};
+
+	/// @brief Statistics over a sliding window of the most recent samples.
+	/// `WindowedStats` keeps the last `window_size()` samples in a `RingBuffer` and updates its
+	/// aggregates as samples enter and leave the window, so every query is O(1):
+	/// - sum, mean and variance are maintained incrementally (variance via Welford's method)
+	/// - min and max are maintained with monotonic deques, so each sample is pushed into and
+	///   popped from each deque at most once
+	/// - quantiles, if enabled, are estimated from a `QuantileSketch` that samples are added to
+	///   and removed from as the window slides. Querying a quantile walks the sketch's buckets,
+	///   which is independent of the window size
+	///
+	/// Example:
+	/// @code {.cpp}
+	/// auto latencies = WindowedStats<f64>(1000, QuantileTracking::Enabled);
+	/// latencies.push(measured_latency);
+	/// if(latencies.quantile(0.99).unwrap_or(0.0) > threshold) {
+	/// 	throttle();
+	/// }
+	/// @endcode
+	///
+	/// @tparam T - The sample type
+	/// @ingroup utils
+	/// @headerfile "Hyperion/WindowedStats.h"
+	template<concepts::Numeric T = f64>
+	class WindowedStats {
+	  public:
+		/// @brief Constructs an empty `WindowedStats` over a window of `window_size` samples
+		///
+		/// @param window_size - The number of most recent samples to aggregate over
+		/// @param tracking - Whether to maintain a quantile sketch
+		/// @param relative_accuracy - The relative accuracy of the quantile sketch, if enabled
+		explicit WindowedStats(
+			usize window_size,
+			QuantileTracking tracking = QuantileTracking::Disabled,
+			f64 relative_accuracy = QuantileSketch::DEFAULT_RELATIVE_ACCURACY) noexcept
+			: m_window_size(std::max(window_size, 1_usize)),
+			  m_samples(m_window_size),
+			  m_min(m_window_size),
+			  m_max(m_window_size),
+			  m_tracking(tracking),
+			  m_sketch(relative_accuracy,
+					   tracking == QuantileTracking::Enabled ? QuantileSketch::DEFAULT_NUM_BUCKETS :
+															   0_usize) {
+		}
+
+		/// @brief Adds `sample` to the window, evicting the oldest sample if the window is full
+		///
+		/// @param sample - The sample to add
+		inline auto push(T sample) noexcept -> void {
+			if(full()) {
+				evict(m_samples.front());
+				ignore(m_samples.pop_front());
+			}
+
+			m_samples.push_back(sample);
+			const auto value = static_cast<f64>(sample);
+			m_sum += value;
+			const auto delta = value - m_mean;
+			m_mean += delta / static_cast<f64>(m_samples.size());
+			m_m2 += delta * (value - m_mean);
+
+			push_extremum(m_min, sample, [](T lhs, T rhs) noexcept { return lhs <= rhs; });
+			push_extremum(m_max, sample, [](T lhs, T rhs) noexcept { return lhs >= rhs; });
+
+			if(m_tracking == QuantileTracking::Enabled) {
+				m_sketch.add(value);
+			}
+			m_pushed++;
+		}
+
+		/// @brief Returns the number of samples currently in the window
+		///
+		/// @return The number of samples
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			return m_samples.size();
+		}
+
+		/// @brief Returns the maximum number of samples in the window
+		///
+		/// @return The window size
+		[[nodiscard]] inline auto window_size() const noexcept -> usize {
+			return m_window_size;
+		}
+
+		/// @brief Returns whether the window holds no samples
+		///
+		/// @return `true` if empty, `false` otherwise
+		[[nodiscard]] inline auto empty() const noexcept -> bool {
+			return m_samples.empty();
+		}
+
+		/// @brief Returns whether the window holds `window_size()` samples
+		///
+		/// @return `true` if full, `false` otherwise
+		[[nodiscard]] inline auto full() const noexcept -> bool {
+			return m_samples.size() == m_window_size;
+		}
+
+		/// @brief Returns the sum of the samples in the window
+		///
+		/// @return The sum
+		[[nodiscard]] inline auto sum() const noexcept -> f64 {
+			return m_sum;
+		}
+
+		/// @brief Returns the mean of the samples in the window
+		///
+		/// @return The mean, or `0` if the window is empty
+		[[nodiscard]] inline auto mean() const noexcept -> f64 {
+			return m_mean;
+		}
+
+		/// @brief Returns the population variance of the samples in the window
+		///
+		/// @return The variance, or `0` if the window is empty
+		[[nodiscard]] inline auto variance() const noexcept -> f64 {
+			return empty() ? 0.0 : std::max(m_m2, 0.0) / static_cast<f64>(size());
+		}
+
+		/// @brief Returns the sample variance (with Bessel's correction) of the samples in the
+		/// window
+		///
+		/// @return The sample variance, or `0` if the window holds fewer than two samples
+		[[nodiscard]] inline auto sample_variance() const noexcept -> f64 {
+			return size() < 2 ? 0.0 : std::max(m_m2, 0.0) / static_cast<f64>(size() - 1);
+		}
+
+		/// @brief Returns the population standard deviation of the samples in the window
+		///
+		/// @return The standard deviation, or `0` if the window is empty
+		[[nodiscard]] inline auto standard_deviation() const noexcept -> f64 {
+			return std::sqrt(variance());
+		}
+
+		/// @brief Returns the smallest sample in the window
+		///
+		/// @return The minimum, or `None` if the window is empty
+		[[nodiscard]] inline auto min() const noexcept -> Option<T> {
+			if(m_min.empty()) {
+				return None();
+			}
+
+			return Some(m_min.as_spans().first.front().m_value);
+		}
+
+		/// @brief Returns the largest sample in the window
+		///
+		/// @return The maximum, or `None` if the window is empty
+		[[nodiscard]] inline auto max() const noexcept -> Option<T> {
+			if(m_max.empty()) {
+				return None();
+			}
+
+			return Some(m_max.as_spans().first.front().m_value);
+		}
+
+		/// @brief Estimates the `quantile`th quantile of the samples in the window
+		///
+		/// @param quantile - The quantile to estimate, in [0, 1] (e.g. `0.99` for p99)
+		///
+		/// @return The estimate, or `None` if the window is empty or quantile tracking is
+		/// disabled
+		[[nodiscard]] inline auto quantile(f64 quantile) const noexcept -> Option<f64> {
+			if(m_tracking == QuantileTracking::Disabled) {
+				return None();
+			}
+
+			return m_sketch.quantile(quantile);
+		}
+
+		/// @brief Returns the quantile sketch for the window, e.g. to merge windows from
+		/// several sources
+		///
+		/// @return The sketch. Empty if quantile tracking is disabled
+		[[nodiscard]] inline auto sketch() const noexcept -> const QuantileSketch& {
+			return m_sketch;
+		}
+
+		/// @brief Returns the samples currently in the window, oldest first
+		///
+		/// @return The samples
+		[[nodiscard]] inline auto samples() const noexcept -> const RingBuffer<T>& {
+			return m_samples;
+		}
+
+		/// @brief Removes all samples from the window
+		inline auto clear() noexcept -> void {
+			m_samples.clear();
+			m_min.clear();
+			m_max.clear();
+			m_sketch.clear();
+			m_sum = 0.0;
+			m_mean = 0.0;
+			m_m2 = 0.0;
+		}
+
+	  private:
+		/// @brief An entry in a monotonic deque: a sample and its position in the stream of
+		/// all samples pushed so far
+		struct Extremum {
+			usize m_position;
+			T m_value;
+		};
+
+		usize m_window_size;
+		RingBuffer<T> m_samples;
+		RingBuffer<Extremum> m_min;
+		RingBuffer<Extremum> m_max;
+		QuantileTracking m_tracking;
+		QuantileSketch m_sketch;
+		usize m_pushed = 0_usize;
+		f64 m_sum = 0.0;
+		f64 m_mean = 0.0;
+		f64 m_m2 = 0.0;
+
+		/// @brief Removes `sample`, the oldest sample in the window, from the running aggregates
+		inline auto evict(T sample) noexcept -> void {
+			const auto value = static_cast<f64>(sample);
+			const auto remaining = static_cast<f64>(m_samples.size() - 1);
+			m_sum -= value;
+			if(remaining == 0.0) {
+				m_mean = 0.0;
+				m_m2 = 0.0;
+			}
+			else {
+				const auto delta = value - m_mean;
+				m_mean -= delta / remaining;
+				m_m2 -= delta * (value - m_mean);
+			}
+
+			if(m_tracking == QuantileTracking::Enabled) {
+				m_sketch.remove(value);
+			}
+		}
+
+		/// @brief Pushes `sample` into the monotonic deque `deque`.
+		/// Entries that have left the window are dropped from the front, and entries that
+		/// `sample` dominates (per `dominates`) are dropped from the back, so the front of the
+		/// deque is always the extremum of the window
+		template<typename Dominates>
+		inline auto
+		push_extremum(RingBuffer<Extremum>& deque, T sample, Dominates&& dominates) noexcept
+			-> void {
+			while(!deque.empty() && deque.front().m_position + m_window_size <= m_pushed) {
+				ignore(deque.pop_front());
+			}
+			while(!deque.empty() && dominates(sample, deque.back().m_value)) {
+				ignore(deque.pop_back());
+			}
+
+			deque.push_back(Extremum{m_pushed, sample});
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
@@ -1,6 +1,7 @@
 /// @file Backtrace.h
 /// @author Braxton Salyer <braxtonsalyer@gmail.com>
-/// @brief Wrap Boost::stacktrace and provide fmtlib formatter for it
+/// @brief Lightweight, lazily symbolized backtraces built on Boost::stacktrace, and a fmtlib
+/// formatter for them
 /// @version 0.1
 /// @date 2022-06-15
 ///
@@ -27,8 +28,13 @@
 
 #pragma once
 
-#include <Hyperion/HyperionDef.h>
+#include <Hyperion/BasicTypes.h>
 #include <Hyperion/Fmt.h>
+#include <Hyperion/HyperionDef.h>
+#include <array>
+#include <iterator>
+#include <string>
+#include <string_view>
 
 #if HYPERION_PLATFORM_COMPILER_CLANG
 _Pragma("GCC diagnostic push")
@@ -54,8 +60,15 @@ _Pragma("GCC diagnostic pop")
 #endif
 
 namespace hyperion {
-	/// @brief `backtrace` provides a full backtrace of the current call stack it its point of
-	/// construction
+	/// @brief `backtrace` captures the current call stack at its point of construction
+	///
+	/// Construction only records the raw return addresses of the active frames into a
+	/// fixed-size, inline buffer: it doesn't allocate, doesn't resolve any symbols, and is
+	/// async-signal-safe on platforms where Boost::stacktrace's capture is. Symbolization is
+	/// deferred until the backtrace is printed, and resolved symbols are kept in a process-wide
+	/// address -> symbol cache, so printing many backtraces through the same code paths only pays
+	/// for resolving each distinct frame once. This makes capturing a backtrace cheap enough to
+	/// attach one to errors and log entries, instead of only when panicking.
 	///
 	/// Example:
 	/// @code {.cpp}
@@ -71,11 +84,163 @@ namespace hyperion {
 	/// @endcode
 	/// @ingroup hyperion::error
 	/// @headerfile "Hyperion/error/Backtrace.h"
-	using backtrace = boost::stacktrace::stacktrace;
+	class backtrace {
+	  public:
+		/// @brief The type of a resolvable stack frame
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		using frame_type = boost::stacktrace::frame;
+		/// @brief The type of a raw frame address
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		using address_type = boost::stacktrace::frame::native_frame_ptr_t;
+
+		/// @brief The maximum number of frames a `backtrace` records. Deeper frames are dropped.
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		static constexpr usize MAX_FRAMES = 62;
+
+		/// @brief Captures the current call stack
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		BOOST_FORCEINLINE backtrace() noexcept // NOLINT(hicpp-member-init)
+			: m_size(capture(0_usize)) {
+		}
+
+		/// @brief Captures the current call stack, omitting the innermost `skip` frames
+		///
+		/// @param skip - The number of innermost frames to omit
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		BOOST_FORCEINLINE explicit backtrace(usize skip) noexcept // NOLINT(hicpp-member-init)
+			: m_size(capture(skip)) {
+		}
+
+		constexpr backtrace(const backtrace& trace) noexcept = default;
+		constexpr backtrace(backtrace&& trace) noexcept = default;
+		constexpr ~backtrace() noexcept = default;
+
+		/// @brief Returns a `backtrace` containing no frames, without capturing the call stack
+		///
+		/// @return An empty `backtrace`
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] static constexpr auto empty_trace() noexcept -> backtrace {
+			return backtrace(empty_tag{});
+		}
+
+		/// @brief Returns the number of captured frames
+		///
+		/// @return The number of frames
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] constexpr auto size() const noexcept -> usize {
+			return m_size;
+		}
+
+		/// @brief Returns whether no frames were captured
+		///
+		/// @return whether this is empty
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool {
+			return m_size == 0;
+		}
+
+		/// @brief Returns the raw address of the frame at `index`
+		///
+		/// @param index - The index of the frame, `0` being the innermost
+		/// @return The address of the frame
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] constexpr auto address(usize index) const noexcept -> address_type {
+			return m_frames[index]; // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+		}
+
+		/// @brief Returns the frame at `index`, which can be used to resolve its symbol
+		/// information directly (bypassing the symbol cache)
+		///
+		/// @param index - The index of the frame, `0` being the innermost
+		/// @return The frame
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] constexpr auto operator[](usize index) const noexcept -> frame_type {
+			return frame_type(address(index));
+		}
+
+		/// @brief Returns the description (symbol name and source location, if available) of
+		/// the frame at `index`
+		///
+		/// The description is resolved at most once per distinct address for the lifetime of
+		/// the process, and is valid for the lifetime of the process.
+		///
+		/// @param index - The index of the frame, `0` being the innermost
+		/// @return The description of the frame
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] inline auto symbol(usize index) const -> std::string_view {
+			return symbolize(address(index));
+		}
+
+		/// @brief Resolves the description (symbol name and source location, if available) of
+		/// the frame at `address` through the process-wide symbol cache
+		///
+		/// Thread-safe. Not async-signal-safe.
+		///
+		/// @param address - The address of the frame
+		/// @return The description of the frame, valid for the lifetime of the process
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] static auto symbolize(address_type address) -> std::string_view;
+
+		/// @brief Returns the number of distinct frame addresses currently held in the
+		/// process-wide symbol cache
+		///
+		/// @return The number of cached symbols
+		/// @ingroup hyperion::error
+		/// @headerfile "Hyperion/error/Backtrace.h"
+		[[nodiscard]] static auto cached_symbols() noexcept -> usize;
+
+		constexpr auto operator=(const backtrace& trace) noexcept -> backtrace& = default;
+		constexpr auto operator=(backtrace&& trace) noexcept -> backtrace& = default;
+
+	  private:
+		struct empty_tag { };
+
+		constexpr explicit backtrace([[maybe_unused]] empty_tag tag) noexcept
+			: m_frames(), m_size(0_usize) {
+		}
+
+		// one more than `MAX_FRAMES`, for the terminating null frame `safe_dump_to` writes
+		std::array<address_type, MAX_FRAMES + 1> m_frames;
+		usize m_size;
+
+		BOOST_FORCEINLINE auto capture(usize skip) noexcept -> usize {
+			return boost::stacktrace::safe_dump_to(skip, m_frames.data(), sizeof(m_frames));
+		}
+	};
+
+	/// @brief Symbolizes and formats the given `backtrace` as a string, with one frame per line
+	///
+	/// @param trace - The backtrace to format
+	/// @return The formatted backtrace
+	/// @ingroup hyperion::error
+	/// @headerfile "Hyperion/error/Backtrace.h"
+	[[nodiscard]] inline auto to_string(const backtrace& trace) -> std::string {
+		auto str = std::string();
+		for(auto index = 0_usize; index < trace.size(); ++index) {
+			fmt::format_to(std::back_inserter(str), "{:>2}# {}\n", index, trace.symbol(index));
+		}
+
+		return str;
+	}
 } // namespace hyperion
 
 /// @brief Specialize `fmt::formatter` for `hyperion::backtrace` so it can be used with fmtlib
 /// formatting functions
+///
+/// Frames are symbolized lazily through the process-wide symbol cache and written directly to
+/// the output, without building an intermediate string.
 /// @ingroup hyperion::error
 /// @headerfile "Hyperion/error/Backtrace.h"
 template<>
@@ -88,6 +253,11 @@ struct fmt::formatter<hyperion::backtrace> {
 	template<typename FormatContext>
 	[[nodiscard]] inline auto
 	format(const hyperion::backtrace& trace, FormatContext& ctx) -> decltype(ctx.out()) {
-		return fmt::format_to(ctx.out(), "{}", to_string(trace));
+		auto out = ctx.out();
+		for(auto index = hyperion::usize(0); index < trace.size(); ++index) {
+			out = fmt::format_to(out, "{:>2}# {}\n", index, trace.symbol(index));
+		}
+
+		return out;
 	}
 };
@@ -0,0 +1,116 @@
+/// @file CrashReporter.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Async-signal-safe crash reporting for fatal signals
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <string_view>
+
+namespace hyperion::error {
+	/// @brief Writes a report to a file descriptor when the process receives a fatal signal
+	/// (`SIGSEGV`, `SIGABRT`, `SIGBUS`, `SIGFPE` or `SIGILL`)
+	///
+	/// Fatal signals often arrive when the heap is corrupted or a lock is held by the crashed
+	/// thread. The report therefore only uses async-signal-safe operations. Its header is
+	/// formatted when the reporter is installed. The file descriptor is opened up front by the
+	/// caller. The backtrace is written as raw frame addresses, to be symbolized offline (e.g.
+	/// with `addr2line`). Nothing allocates, locks, or goes through `stdio` while reporting.
+	///
+	/// After the report is written, the signal is handed on to whatever `sigaction` was
+	/// installed for it before the reporter, so handlers installed earlier (e.g. by other crash
+	/// handling libraries) still run. If there was none (or the signal was ignored), the
+	/// signal's default disposition is restored instead, so the process still terminates (and
+	/// dumps core) as it otherwise would. A signal sent by a process (e.g. by `abort`) is
+	/// re-raised to reach that disposition; a hardware fault reaches it when the faulting
+	/// instruction is retried.
+	///
+	/// A panic handled by the default panic handler ends in `std::terminate`, and so in
+	/// `SIGABRT`. Such a panic is reported too, after the panic hooks and the handler have run.
+	///
+	/// Crash reporting is only supported on POSIX platforms.
+	///
+	/// # Example
+	/// @code {.cpp}
+	/// auto log_fd = open("crash.log", O_WRONLY | O_CREAT | O_APPEND, 0644);
+	/// hyperion::error::CrashReporter::install(log_fd, fmt::format("my_app {} crashed", VERSION));
+	/// @endcode
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/CrashReporter.h"
+	class CrashReporter {
+	  public:
+		/// @brief The maximum length of the report header. Longer headers are truncated
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/CrashReporter.h"
+		static constexpr usize MAX_HEADER_SIZE = 512;
+
+		/// @brief The size of the alternate stack the signal handlers run on, so that stack
+		/// overflows on the thread that installed the reporter can still be reported
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/CrashReporter.h"
+		static constexpr usize SIGNAL_STACK_SIZE = 64_usize * 1024_usize; // NOLINT
+
+		/// @brief Installs the crash reporter, writing reports to `fd` with `header` as the
+		/// first line
+		///
+		/// Installing again replaces the file descriptor and header. The alternate signal stack
+		/// is installed for the calling thread only. Installation is not thread-safe, so the
+		/// reporter should be installed once, early in `main`.
+		///
+		/// @param fd - The open, writable file descriptor to write reports to
+		/// @param header - The first line of every report (e.g. the program name and version)
+		///
+		/// @return Whether the signal handlers were installed
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/CrashReporter.h"
+		static auto install(i32 fd, std::string_view header) noexcept -> bool;
+
+		/// @brief Uninstalls the crash reporter, restoring the signal handlers that were
+		/// installed before it
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/CrashReporter.h"
+		static auto uninstall() noexcept -> void;
+
+		/// @brief Returns whether the crash reporter is installed
+		///
+		/// @return Whether the crash reporter is installed
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/CrashReporter.h"
+		[[nodiscard]] static auto is_installed() noexcept -> bool;
+
+		/// @brief Writes a crash report for `signal` to the installed file descriptor
+		///
+		/// This is what the signal handlers call. It's async-signal-safe, and can also be called
+		/// directly to record the state of the process without crashing it. Does nothing if the
+		/// crash reporter isn't installed.
+		///
+		/// @param signal - The number of the signal being reported
+		/// @param address - The faulting address, if any
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/CrashReporter.h"
+		static auto write_report(i32 signal, const void* address = nullptr) noexcept -> void;
+	};
+} // namespace hyperion::error
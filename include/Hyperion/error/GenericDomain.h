@@ -28,7 +28,9 @@
 
 #include <Hyperion/Ignore.h>
 #include <Hyperion/error/StatusCode.h>
+#include <array>
 #include <cerrno>
+#include <limits>
 
 namespace hyperion::error {
 
@@ -123,6 +125,128 @@ namespace hyperion::error {
 		Unknown = -1
 	};
 
+	/// @brief `GenericCodeTable` is a dense, `constexpr` mapping from the status code values in
+	/// `[First, First + Size)` of a `StatusCodeDomain` to their `Errno` equivalents
+	///
+	/// Domains use a `GenericCodeTable` to make converting their codes to `Errno` (and thus
+	/// checking semantic equivalence across domains) a single array lookup, instead of
+	/// evaluating their conversion function every time.
+	///
+	/// @tparam Value - The value type of the domain
+	/// @tparam First - The first value covered by the table
+	/// @tparam Size - The number of values covered by the table
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/GenericDomain.h"
+	template<typename Value, i64 First, usize Size>
+	class GenericCodeTable {
+	  public:
+		/// @brief Constructs a `GenericCodeTable` by evaluating `to_errno` for every value it
+		/// covers
+		///
+		/// @param to_errno - The function converting a `Value` to its `Errno` equivalent
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/GenericDomain.h"
+		template<typename F>
+		requires concepts::InvocableWithReturn<Errno, F, Value>
+		explicit consteval GenericCodeTable(F&& to_errno) noexcept {
+			for(auto index = 0_usize; index < Size; ++index) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+				m_codes[index] = to_errno(static_cast<Value>(First + static_cast<i64>(index)));
+			}
+		}
+
+		/// @brief Returns whether `value` is covered by this table
+		///
+		/// @param value - The value to check
+		/// @return Whether `value` is in `[First, First + Size)`
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/GenericDomain.h"
+		[[nodiscard]] inline constexpr auto contains(Value value) const noexcept -> bool {
+			const auto code = static_cast<i64>(value);
+			return code >= First && code - First < static_cast<i64>(Size);
+		}
+
+		/// @brief Returns the `Errno` equivalent of `value`
+		///
+		/// @param value - The value to convert. Must be covered by this table
+		/// @return The `Errno` equivalent of `value`
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/GenericDomain.h"
+		[[nodiscard]] inline constexpr auto operator[](Value value) const noexcept -> Errno {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			return m_codes[static_cast<usize>(static_cast<i64>(value) - First)];
+		}
+
+	  private:
+		std::array<Errno, Size> m_codes = {};
+	};
+
+	/// @brief Requires that `Value` is a status code value type with few enough possible values
+	/// that a `GenericCodeTable` can cover all of them
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/GenericDomain.h"
+	template<typename Value>
+	concept DenseStatusCodeValue = (std::is_integral_v<Value> || std::is_enum_v<Value>)
+								   && sizeof(Value) == 1;
+
+	/// @brief Makes a `GenericCodeTable` covering every possible value of `Value`, from
+	/// `to_generic_code`, a function converting a `Value` to a `GenericStatusCode`
+	///
+	/// Used by `STATUS_CODE_DOMAIN`, which passes along its (possibly omitted) generic code
+	/// conversion function.
+	///
+	/// @tparam Value - The value type of the domain
+	/// @param to_generic_code - The function converting a `Value` to a `GenericStatusCode`
+	/// @return The table
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/GenericDomain.h"
+	template<DenseStatusCodeValue Value, typename... F>
+	requires(sizeof...(F) == 1)
+	[[nodiscard]] consteval auto make_generic_code_table(F&&... to_generic_code) noexcept {
+		using underlying_type = std::conditional_t<std::is_enum_v<Value>,
+												   std::underlying_type<Value>,
+												   std::type_identity<Value>>::type;
+		constexpr auto first = static_cast<i64>(std::numeric_limits<underlying_type>::min());
+		constexpr auto size = usize(1) << (sizeof(Value) * 8_usize);
+		return GenericCodeTable<Value, first, size>([&](Value value) noexcept -> Errno {
+			return (to_generic_code(value), ...).code();
+		});
+	}
+
+	/// @brief Requires that `Domain` is a `StatusCodeDomain` that can convert its values directly
+	/// to `Errno`, via `to_generic_errno`, without going through a `GenericStatusCode`
+	///
+	/// Semantic equivalence between two codes of such domains only takes a conversion of each
+	/// code and an integer comparison.
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/GenericDomain.h"
+	template<typename Domain>
+	concept StatusCodeDomainWithGenericErrno
+		= StatusCodeDomain<Domain>
+		  && requires(const Domain& domain, const typename Domain::value_type& value) {
+				 { domain.to_generic_errno(value) } noexcept -> concepts::Same<Errno>;
+			 };
+
+	/// @brief Returns whether `lhs` and `rhs` are semantically equivalent, by converting both
+	/// directly to `Errno`
+	///
+	/// Codes converting to `Errno::Unknown` are never equivalent.
+	///
+	/// @param lhs - The first status code to compare
+	/// @param rhs - The second status code to compare
+	/// @return Whether `lhs` and `rhs` are semantically equivalent
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/GenericDomain.h"
+	template<StatusCodeDomainWithGenericErrno LhsDomain,
+			 StatusCodeDomainWithGenericErrno RhsDomain>
+	[[nodiscard]] inline constexpr auto
+	are_equivalent_via_errno(const StatusCode<LhsDomain>& lhs,
+							 const StatusCode<RhsDomain>& rhs) noexcept -> bool {
+		const auto lhs_code = lhs.domain().to_generic_errno(lhs.code());
+		const auto rhs_code = rhs.domain().to_generic_errno(rhs.code());
+		return lhs_code == rhs_code && lhs_code != Errno::Unknown;
+	}
+
 	/// @brief `GenericDomain` is the `StatusCodeDomain` that covers status codes matching those
 	/// strictly required by POSIX (those represented by `Errno`).
 	///
@@ -223,6 +347,33 @@ namespace hyperion::error {
 			return to_posix_message(code.code());
 		}
 
+		/// @brief Returns the textual message associated with the given status code, without
+		/// allocating. `GenericDomain`'s messages are string literals, so this is the same as
+		/// `message`
+		///
+		/// @param code - The status code to get the message for
+		///
+		/// @return the message associated with the code
+		/// @ingroup error
+		[[nodiscard]] inline constexpr auto message_view(value_type code) // NOLINT
+			const noexcept -> std::string_view {
+
+			return to_posix_message(code);
+		}
+
+		/// @brief Returns the textual message associated with the given status code, without
+		/// allocating
+		///
+		/// @param code - The status code to get the message for
+		///
+		/// @return the message associated with the code
+		/// @ingroup error
+		[[nodiscard]] inline constexpr auto message_view(const GenericStatusCode& code) // NOLINT
+			const noexcept -> std::string_view {
+
+			return to_posix_message(code.code());
+		}
+
 		/// @brief Returns whether the given status code represents an error
 		///
 		/// @param code - The status code to check
@@ -260,7 +411,10 @@ namespace hyperion::error {
 		[[nodiscard]] inline constexpr auto are_equivalent(const GenericStatusCode& lhs,
 														   const StatusCode<Domain>& rhs)
 			const noexcept -> bool {
-			if constexpr(ConvertibleToGenericStatusCode<StatusCode<Domain>>) {
+			if constexpr(StatusCodeDomainWithGenericErrno<Domain>) {
+				return are_equivalent_via_errno(lhs, rhs);
+			}
+			else if constexpr(ConvertibleToGenericStatusCode<StatusCode<Domain>>) {
 				const auto as_generic = rhs.as_generic_code();
 				const auto lhs_code = lhs.code();
 				const auto as_generic_code = as_generic.code();
@@ -289,6 +443,17 @@ namespace hyperion::error {
 			return code.domain().as_generic_code(code);
 		}
 
+		/// @brief Converts the given value to its `Errno` equivalent. `GenericDomain`'s values
+		/// already are `Errno`s, so this returns `code` unchanged
+		///
+		/// @param code - The value to convert
+		/// @return `code`
+		/// @ingroup error
+		[[nodiscard]] static inline constexpr auto
+		to_generic_errno(value_type code) noexcept -> Errno {
+			return code;
+		}
+
 		/// @brief Returns the value indicating success for this domain
 		///
 		/// @return The domain's success value
@@ -438,6 +603,8 @@ namespace hyperion::error {
 				case Errno::WrongProtocolType: return "Wrong protocol type for socket.";
 				case Errno::Unknown: return "Unknown error occurred.";
 			}
+
+			return "Unknown error occurred.";
 		}
 	};
 } // namespace hyperion::error
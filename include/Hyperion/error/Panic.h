@@ -56,6 +56,7 @@ namespace std { // NOLINT
 #include <Hyperion/error/Backtrace.h>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 
 namespace hyperion::error {
 	/// @brief Panic manages the active panic handler called when a panic occurs
@@ -137,23 +138,135 @@ namespace hyperion::error {
 			return &default_handler;
 		}
 
+		/// @brief Alias of the panic hook type
+		///
+		/// A panic hook should take the signature `void()` and should persist any buffered
+		/// state (e.g. pending log entries) that would otherwise be lost when the process
+		/// terminates. Panic hooks are called while panicking, so they should complete within a
+		/// bounded amount of time and must not panic themselves.
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		using hook_type = void (*)() noexcept;
+
+		/// @brief Alias of the flush hook type. Flush hooks are panic hooks
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		using flush_hook_type = hook_type;
+
+		/// @brief The maximum number of panic hooks that can be registered at once
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static constexpr usize MAX_HOOKS = 16;
+
+		/// @brief The order hooks are registered with if none is given
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static constexpr i32 DEFAULT_HOOK_ORDER = 0;
+
+		/// @brief The order the flush hook runs at. Flushing runs after hooks registered with the
+		/// default order, so that anything those hooks log while panicking is persisted
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static constexpr i32 FLUSH_HOOK_ORDER = 100;
+
+		/// @brief Registers a hook to be called when a panic occurs, before the panic handler is
+		/// invoked
+		///
+		/// Hooks run in ascending `order`, and hooks with equal `order` run in the order they
+		/// were registered. Registering a hook that is already registered moves it to `order`.
+		/// Hooks are stored in a fixed-size table, so that running them while panicking never
+		/// allocates.
+		///
+		/// @param hook - The hook to call when a panic occurs
+		/// @param order - Where to run `hook` relative to the other registered hooks
+		///
+		/// @return Whether `hook` is registered. This is `false` if `hook` is `nullptr` or
+		/// `MAX_HOOKS` other hooks are already registered
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static auto register_hook(hook_type hook, i32 order = DEFAULT_HOOK_ORDER) noexcept -> bool;
+
+		/// @brief Removes `hook` from the registered panic hooks
+		///
+		/// @param hook - The hook to remove
+		///
+		/// @return Whether `hook` was registered
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static auto unregister_hook(hook_type hook) noexcept -> bool;
+
+		/// @brief Returns the number of registered panic hooks
+		///
+		/// @return The number of registered hooks
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		[[nodiscard]] static auto registered_hooks() noexcept -> usize;
+
+		/// @brief Registers the flush hook, replacing the previously registered one
+		///
+		/// This is used by subsystems that buffer data asynchronously (e.g. the global logger)
+		/// to make sure that data is persisted before the process is terminated. The flush hook
+		/// is a panic hook registered at `FLUSH_HOOK_ORDER`. Passing `nullptr` removes the
+		/// currently registered flush hook.
+		///
+		/// @param hook - The flush hook to call when a panic occurs
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static auto set_flush_hook(flush_hook_type hook) noexcept -> void;
+
+		/// @brief Returns the currently registered flush hook, if any
+		///
+		/// @return the current flush hook, or `nullptr` if none is registered
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		[[nodiscard]] static inline auto get_flush_hook() noexcept -> flush_hook_type {
+			return flush_hook.load(std::memory_order_seq_cst);
+		}
+
+		/// @brief How long a panic waits for the panic hooks another thread is running to
+		/// finish before giving up on them and moving on to the panic handler
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static constexpr auto CONCURRENT_PANIC_TIMEOUT = std::chrono::milliseconds(2000);
+
+		/// @brief Invokes the registered panic hooks, in order
+		///
+		/// The hooks are never re-entered: a panic occurring while they're running on the same
+		/// thread skips them instead of recursing back into them. A concurrent panic on another
+		/// thread waits (for at most `CONCURRENT_PANIC_TIMEOUT`) for them to finish, so the
+		/// panic handler doesn't terminate the process while they're still persisting state,
+		/// then invokes them itself. Once they've returned, a later panic invokes them again.
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static auto invoke_hooks() noexcept -> void;
+
+		/// @brief Invokes the registered panic hooks, including the flush hook. Equivalent to
+		/// `invoke_hooks`
+		/// @ingroup error
+		/// @headerfile "Hyperion/error/Panic.h"
+		static inline auto invoke_flush_hook() noexcept -> void {
+			invoke_hooks();
+		}
+
 	  private:
-		static std::atomic<handler_type> handler; // NOLINT
+		static std::atomic<handler_type> handler;		// NOLINT
+		static std::atomic<flush_hook_type> flush_hook;	// NOLINT
 
 		IGNORE_INVALID_NORETURN_START
 		[[noreturn]] static inline auto
 		default_handler(const std::string& panic_message,
 						const std::source_location& location,
 						const hyperion::backtrace& backtrace) noexcept -> void {
-			const auto message = fmt::format("Panic occurred at [{}:{}:{}:{}]: {}\nBacktrace:\n {}",
-											 location.file_name(),
-											 location.line(),
-											 location.column(),
-											 location.function_name(),
-											 panic_message,
-											 backtrace);
-
-			eprintln("{}", message);
+			// print directly instead of formatting into temporary strings first, so that
+			// reporting the panic allocates as little as possible
+			fmt::print(stderr,
+					   "Panic occurred at [{}:{}:{}:{}]: {}\nBacktrace:\n {}\n",
+					   location.file_name(),
+					   location.line(),
+					   location.column(),
+					   location.function_name(),
+					   panic_message,
+					   backtrace);
 #if HYPERION_PLATFORM_DEBUG
 			assert(false); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,
 						   // hicpp-no-array-decay)
@@ -176,6 +289,7 @@ namespace hyperion::error {
 
 		const auto message
 			= fmt::format(std::move(format_string), std::forward<Args>(format_args)...);
+		Panic::invoke_hooks();
 		auto handler = Panic::get_handler();
 		if(handler == nullptr) {
 			Panic::get_default_handler()(message, location, backtrace);
@@ -189,15 +303,32 @@ namespace hyperion::error {
 #endif
 	}
 
+	/// @brief The out-of-line body of `panic`. Captures the backtrace and invokes the panic.
+	///
+	/// Formatting the message and capturing the backtrace take a fair amount of code. Doing both
+	/// here, in a cold, never-inlined function, leaves each `panic` call site with just a call.
+	/// This keeps the functions containing them (e.g. `Result::unwrap`) small and the surrounding
+	/// hot code dense
+	template<typename... Args>
+	[[noreturn]] HYPERION_COLD HYPERION_NOINLINE auto
+	cold_panic(fmt::format_string<Args...>&& format_string,
+			   std::source_location location,
+			   Args&&... format_args) noexcept -> void {
+		// skip this frame, so the backtrace starts at the `panic` call site
+		panic_impl(std::move(format_string),
+				   location,
+				   hyperion::backtrace(1_usize),
+				   std::forward<Args>(format_args)...);
+	}
+
 	IGNORE_INVALID_NORETURN_STOP
 
 #define hyperion_panic(format_string, ...) /** NOLINT(cppcoreguidelines-macro-usage, 	   **/ \
 										   /** bugprone-reserved-identifier,  		   **/       \
 										   /** cert-dcl37-c,						   	   **/                 \
 										   /** cert-dcl51-cpp) 					   	   **/               \
-	hyperion::error::panic_impl(format_string,                                               \
-								std::source_location::current(),                             \
-								hyperion::backtrace() __VA_OPT__(, ) __VA_ARGS__)
+	hyperion::error::cold_panic(format_string,                                               \
+								std::source_location::current() __VA_OPT__(, ) __VA_ARGS__)
 
 /// @brief Invokes a panic with the formatted error message
 ///
@@ -29,8 +29,11 @@
 
 #include <Hyperion/error/GenericDomain.h>
 #include <Hyperion/error/StatusCode.h>
+#include <array>
 #include <cstring>
 #include <gsl/gsl>
+#include <string>
+#include <string_view>
 
 namespace hyperion::error {
 
@@ -119,6 +122,10 @@ namespace hyperion::error {
 		[[nodiscard]] auto message(value_type code) // NOLINT
 			const noexcept -> std::string {
 
+			if(in_message_table(code)) {
+				return std::string(message_view(code));
+			}
+
 			return as_string(code);
 		}
 
@@ -131,7 +138,45 @@ namespace hyperion::error {
 		[[nodiscard]] auto message(const PosixStatusCode& code) // NOLINT
 			const noexcept -> std::string {
 
-			return as_string(code.code());
+			return message(code.code());
+		}
+
+		/// @brief Returns the textual message associated with the given status code, without
+		/// allocating
+		///
+		/// Messages are looked up in a table built on first use, so the returned view is valid for
+		/// the lifetime of the program and is null-terminated. Codes outside of
+		/// `[0, MESSAGE_TABLE_SIZE)` get a generic "Unknown error." message
+		///
+		/// @param code - The status code to get the message for
+		///
+		/// @return the message associated with the code
+		/// @ingroup error
+		[[nodiscard]] auto message_view(value_type code) // NOLINT
+			const noexcept -> std::string_view {
+
+			if(!in_message_table(code)) {
+				return UNKNOWN_MESSAGE;
+			}
+
+			const auto& table = message_table();
+			const auto index = static_cast<usize>(code);
+			const auto begin = table.offsets[index];				// NOLINT
+			const auto length = table.offsets[index + 1] - begin - 1; // NOLINT
+			return {table.buffer.data() + begin, length};			// NOLINT
+		}
+
+		/// @brief Returns the textual message associated with the given status code, without
+		/// allocating
+		///
+		/// @param code - The status code to get the message for
+		///
+		/// @return the message associated with the code
+		/// @ingroup error
+		[[nodiscard]] auto message_view(const PosixStatusCode& code) // NOLINT
+			const noexcept -> std::string_view {
+
+			return message_view(code.code());
 		}
 
 		/// @brief Returns whether the given status code represents an error
@@ -171,7 +216,10 @@ namespace hyperion::error {
 		[[nodiscard]] constexpr auto
 		are_equivalent(const PosixStatusCode& lhs, const StatusCode<Domain>& rhs) const noexcept
 			-> bool {
-			if constexpr(ConvertibleToGenericStatusCode<StatusCode<Domain>>) {
+			if constexpr(StatusCodeDomainWithGenericErrno<Domain>) {
+				return are_equivalent_via_errno(lhs, rhs);
+			}
+			else if constexpr(ConvertibleToGenericStatusCode<StatusCode<Domain>>) {
 				return as_generic_code(lhs) == rhs.as_generic_code();
 			}
 			else if(rhs.domain() == *this) {
@@ -198,7 +246,24 @@ namespace hyperion::error {
 		/// @ingroup error
 		[[nodiscard]] constexpr auto as_generic_code(const PosixStatusCode& code) // NOLINT
 			const noexcept -> GenericStatusCode {
-			return make_status_code(to_generic_code(code.code()));
+			return make_status_code(to_generic_errno(code.code()));
+		}
+
+		/// @brief Converts the given value to its `Errno` equivalent
+		///
+		/// Values in `[0, GENERIC_CODE_TABLE_SIZE)` are converted with a lookup in a table built
+		/// at compile time.
+		///
+		/// @param code - The value to convert
+		/// @return The `Errno` equivalent of `code`, or `Errno::Unknown` if there is none
+		/// @ingroup error
+		[[nodiscard]] static inline constexpr auto
+		to_generic_errno(value_type code) noexcept -> Errno {
+			if(generic_code_table.contains(code)) {
+				return generic_code_table[code];
+			}
+
+			return to_generic_code(code);
 		}
 
 		/// @brief Returns the value indicating success for this domain
@@ -254,9 +319,46 @@ namespace hyperion::error {
 		/// @ingroup error
 		constexpr auto operator=(PosixDomain&&) noexcept -> PosixDomain& = default;
 
+		/// @brief The number of codes, starting from 0, with a precomputed message
+		/// @ingroup error
+		static constexpr usize MESSAGE_TABLE_SIZE = 256;
+		/// @brief The number of codes, starting at `0`, whose `Errno` equivalents are looked up
+		/// in a table built at compile time
+		/// @ingroup error
+		static constexpr usize GENERIC_CODE_TABLE_SIZE = 256;
+
 	  private:
 		u64 m_uuid = ID;
 
+		static constexpr std::string_view UNKNOWN_MESSAGE = "Unknown error.";
+
+		/// @brief The messages of every code in `[0, MESSAGE_TABLE_SIZE)`, stored back to back
+		/// (and null-terminated) in a single buffer
+		struct MessageTable {
+			std::string buffer;
+			std::array<usize, MESSAGE_TABLE_SIZE + 1> offsets = {};
+		};
+
+		[[nodiscard]] static inline constexpr auto
+		in_message_table(value_type code) noexcept -> bool {
+			return code >= 0 && static_cast<usize>(code) < MESSAGE_TABLE_SIZE;
+		}
+
+		[[nodiscard]] static inline auto message_table() noexcept -> const MessageTable& {
+			static const MessageTable table = [] {
+				MessageTable messages;
+				for(auto code = 0_usize; code < MESSAGE_TABLE_SIZE; ++code) {
+					messages.offsets[code] = messages.buffer.size(); // NOLINT
+					messages.buffer += as_string(static_cast<value_type>(code));
+					messages.buffer.push_back('\0');
+				}
+				messages.offsets[MESSAGE_TABLE_SIZE] = messages.buffer.size(); // NOLINT
+				return messages;
+			}();
+
+			return table;
+		}
+
 		[[nodiscard]] static inline auto as_string(value_type code) noexcept -> std::string {
 
 			IGNORE_UNSAFE_BUFFER_WARNINGS_START
@@ -267,7 +369,7 @@ namespace hyperion::error {
 			strerror_s(buffer, 1024, gsl::narrow_cast<i32>(code)); // NOLINT
 #elif defined(__gnu_linux__) && !defined(__ANDROID__)
 			char* message = strerror_r(gsl::narrow_cast<i32>(code), buffer, 1024); // NOLINT
-			if(message != nullptr) {
+			if(message != nullptr && message != buffer) {
 				strncpy(buffer, message, 1024); // NOLINT
 				buffer[1023] = 0;				// NOLINT
 			}
@@ -367,8 +469,16 @@ namespace hyperion::error {
 				default: return Errno::Unknown;
 			}
 		}
+
+		using GenericCodes = GenericCodeTable<value_type, 0, GENERIC_CODE_TABLE_SIZE>;
+		// defined after the class, because building it requires `to_generic_code` to be usable
+		// in constant expressions, which it isn't until `PosixDomain` is complete
+		static const GenericCodes generic_code_table;
 	};
 
+	inline constexpr PosixDomain::GenericCodes PosixDomain::generic_code_table
+		= PosixDomain::GenericCodes(&PosixDomain::to_generic_code);
+
 	/// @brief Shorthand alias for `StatusCode`s of `PosixDomain`, ie `StatusCode<PosixDomain>`
 	/// @ingroup error
 	using PosixStatusCode = PosixDomain::PosixStatusCode;
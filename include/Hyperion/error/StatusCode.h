@@ -360,6 +360,20 @@ namespace hyperion::error {
 			return m_domain.message(*this);
 		}
 
+		/// @brief Returns the textual message associated with this `StatusCode`, without
+		/// allocating
+		///
+		/// # Requirements
+		/// * `Domain` must be a `StatusCodeDomainWithMessageView`
+		///
+		/// @return The message associated with the value this `StatusCode` currently represents
+		/// @ingroup error
+		[[nodiscard]] inline constexpr auto message_view() const noexcept -> std::string_view
+		requires StatusCodeDomainWithMessageView<Domain>
+		{
+			return m_domain.message_view(m_code);
+		}
+
 		/// @brief Returns whether this `StatusCode` represents an error
 		///
 		/// # Requirements
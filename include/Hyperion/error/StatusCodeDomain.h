@@ -193,6 +193,37 @@ namespace hyperion::error {
 			  } -> std::same_as<Domain>;
 		  };
 
+	/// @brief Concept that requires that `Domain` provides `message_view`, an allocation-free
+	/// alternative to `message`
+	///
+	/// `domain.message_view(value)` must return a `std::string_view` that remains valid for the
+	/// lifetime of the program (e.g. one referring to a string literal or to a table built once),
+	/// so that formatting or logging an error never has to allocate. The viewed message must also
+	/// be null-terminated (i.e. `view.data()[view.size()] == '\0'`), so that it can be handed to
+	/// C APIs through `Error::message_as_cstr` without copying
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/StatusCodeDomain.h"
+	template<typename Domain>
+	concept StatusCodeDomainWithMessageView
+		= StatusCodeDomain<Domain>
+		  && requires(const Domain& domain, const typename Domain::value_type& value) {
+				 {
+					 domain.message_view(value)
+					 } -> std::same_as<std::string_view>;
+			 };
+
+	/// @brief Concept that requires that the message type, `Message`, of a domain generated by
+	/// `STATUS_CODE_DOMAIN` refers to static storage, so the domain can provide `message_view`.
+	/// This is the case for message functions returning `std::string_view` or `const char*`.
+	/// A message function returning `std::string_view` must only return views of whole string
+	/// literals (or other null-terminated static strings), never substrings of them, to satisfy
+	/// the null-termination requirement of `StatusCodeDomainWithMessageView`
+	/// @ingroup error
+	/// @headerfile "Hyperion/error/StatusCodeDomain.h"
+	template<typename Message>
+	concept StaticMessage = concepts::Same<Message, std::string_view>
+							|| concepts::Same<Message, const char*>;
+
 	namespace detail {
 		/// @brief Parses the semantic numeric value from a character
 		///
@@ -309,9 +340,14 @@ namespace hyperion::error {
 /// @param name_string  The name of the domain, as a string
 /// @param _success_value  The `ValueType` value representing success
 /// @param unknown_value  The `ValueType` value representing an unknown error
-/// @param message_function  function or lambda converting a `ValueType` to a string message
+/// @param message_function  function or lambda converting a `ValueType` to a string message. If it
+/// returns a `std::string_view` or `const char*` (referring to static, null-terminated storage,
+/// e.g. a string literal), the domain also provides the allocation-free `message_view`
 /// @param ...  if `IsConvertibleToGenericStatusCode`, the function or lambda converting a
-/// `ValueType` to the value type of `GenericDomain` (`hyperion::error::Errno`)
+/// `ValueType` to a `GenericStatusCode`. If `ValueType` is a one-byte integer or enum, this must be
+/// usable in constant expressions: it's evaluated for every possible value at compile time to
+/// build a dense table, so converting codes to `Errno` (and checking equivalence with codes of
+/// other domains) is a table lookup
 ///
 /// @ingroup error
 /// @headerfile "Hyperion/error/StatusCodeDomain.h"
@@ -370,6 +406,22 @@ namespace hyperion::error {
 				return message(_code.code());                                                      \
 			}                                                                                      \
                                                                                                    \
+			using message_type = decltype(message_function(std::declval<value_type>()));           \
+                                                                                                   \
+			template<typename Message = message_type>                                              \
+			requires hyperion::error::StaticMessage<Message>                                       \
+			[[nodiscard]] inline auto                                                              \
+			message_view(value_type _code) const noexcept -> std::string_view {                    \
+				return message_function(_code);                                                    \
+			}                                                                                      \
+                                                                                                   \
+			template<typename Message = message_type>                                              \
+			requires hyperion::error::StaticMessage<Message>                                       \
+			[[nodiscard]] inline auto                                                              \
+			message_view(const Category##StatusCode& _code) const noexcept -> std::string_view {   \
+				return message_view<Message>(_code.code());                                        \
+			}                                                                                      \
+                                                                                                   \
 			[[nodiscard]] inline constexpr auto is_error(value_type code) const noexcept -> bool { \
 				return code != _success_value;                                                     \
 			}                                                                                      \
@@ -394,18 +446,25 @@ namespace hyperion::error {
 						   const hyperion::error::StatusCode<Domain>& rhs) const noexcept          \
 				-> bool {                                                                          \
 				if constexpr(IsConvertibleToGenericStatusCode) {                                   \
-					if constexpr(hyperion::error::ConvertibleToGenericStatusCode<                  \
-									 hyperion::error::StatusCode<Domain>>)                         \
+					if constexpr(hyperion::error::StatusCodeDomainWithGenericErrno<Name>           \
+								 && hyperion::error::StatusCodeDomainWithGenericErrno<Domain>)     \
+					{                                                                              \
+						return hyperion::error::are_equivalent_via_errno(lhs, rhs);                \
+					}                                                                              \
+					else if constexpr(hyperion::error::ConvertibleToGenericStatusCode<             \
+										  hyperion::error::StatusCode<Domain>>)                    \
 					{                                                                              \
 						return as_generic_code(lhs) == rhs.as_generic_code();                      \
 					}                                                                              \
 				}                                                                                  \
                                                                                                    \
-				if(rhs.domain() == *this) {                                                        \
-					const auto lhs_code = lhs.code();                                              \
-					const auto rhs_code = rhs.code();                                              \
-					return lhs_code == rhs_code && lhs_code != unknown_value                       \
-						   && rhs_code != unknown_value;                                           \
+				if constexpr(hyperion::concepts::Same<Domain, Name>) {                             \
+					if(rhs.domain() == *this) {                                                    \
+						const auto lhs_code = lhs.code();                                          \
+						const auto rhs_code = rhs.code();                                          \
+						return lhs_code == rhs_code && lhs_code != unknown_value                   \
+							   && rhs_code != unknown_value;                                       \
+					}                                                                              \
 				}                                                                                  \
                                                                                                    \
 				return false;                                                                      \
@@ -423,6 +482,18 @@ namespace hyperion::error {
 				}                                                                                  \
 			}                                                                                      \
                                                                                                    \
+			template<typename V = value_type>                                                      \
+			requires hyperion::concepts::Same<V, value_type> && (IsConvertibleToGenericStatusCode) \
+			[[nodiscard]] inline constexpr auto                                                    \
+			to_generic_errno(const V& _code) const noexcept -> hyperion::error::Errno {            \
+				if constexpr(hyperion::error::DenseStatusCodeValue<V>) {                           \
+					return generic_code_table<V>[_code];                                           \
+				}                                                                                  \
+				else {                                                                             \
+					return ___STATUS_CODE_FIRST(__VA_ARGS__)(_code).code();                        \
+				}                                                                                  \
+			}                                                                                      \
+                                                                                                   \
 			[[nodiscard]] static inline constexpr auto success_value() noexcept -> value_type {    \
 				return _success_value;                                                             \
 			}                                                                                      \
@@ -446,6 +517,10 @@ namespace hyperion::error {
 		  private:                                                                                 \
 			hyperion::u64 m_uuid = ID;                                                             \
                                                                                                    \
+			template<typename V = value_type>                                                      \
+			static constexpr auto generic_code_table /** NOLINT **/                                \
+				= hyperion::error::make_generic_code_table<V>(__VA_ARGS__);                        \
+                                                                                                   \
 			template<typename U = Category##StatusCode>                                            \
 			requires hyperion::concepts::Same<std::remove_const_t<std::remove_reference_t<U>>,     \
 											  Category##StatusCode>                                \
@@ -98,6 +98,10 @@ namespace hyperion::fs {
 
 		using element_type = char;
 		using buffer_type = element_type[]; // NOLINT (c-arrays)
+		/// @brief Owning pointer to a `File`'s user-space buffer. Buffers are allocated with
+		/// `LargePages`, so large ones are backed by huge pages (and placed according to the
+		/// current `LargePageScope`)
+		using buffer_pointer = UniquePtr<buffer_type, LargePageDeleter<element_type>>;
 
 		/// @brief The type of access permission to open a file with
 		/// @ingroup filesystem
@@ -173,7 +177,7 @@ namespace hyperion::fs {
 		/// @param options - The `OpenOptions` the file was opened with
 		/// @ingroup filesystem
 		constexpr File(std::FILE* file,
-					   UniquePtr<buffer_type>&& buffer,
+					   buffer_pointer&& buffer,
 					   OpenOptions options
 					   = {AccessType::ReadWrite, AccessModifier::Truncate}) noexcept
 			: m_file(file), m_buffer(std::move(buffer)), m_options(options) { // NOLINT
@@ -417,7 +421,7 @@ namespace hyperion::fs {
 	  private:
 		UniquePtr<std::FILE, FileDeleter> m_file = nullptr;
 
-		UniquePtr<buffer_type> m_buffer = nullptr;
+		buffer_pointer m_buffer = nullptr;
 
 		OpenOptions m_options = OpenOptions{};
 	};
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Hyperion/Concepts.h>
+#include <atomic>
 #include <cstddef>
 
 #if HYPERION_PLATFORM_WINDOWS
@@ -55,6 +56,87 @@ namespace hyperion::logging {
 		ERROR,
 	};
 
+	/// @brief A `Level` that can be read and changed at runtime from any thread.
+	///
+	/// Loads and stores are relaxed: a level change is not ordered with respect to any other
+	/// memory operation, it only needs to become visible to logging threads eventually. This
+	/// makes checking a level on the logging fast path a single relaxed load.
+	///
+	/// Unlike `std::atomic`, `AtomicLevel` is copyable and movable (copying the currently stored
+	/// `Level`) so that it can be used as a member of copyable or movable types such as sinks.
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Config.h"
+	class AtomicLevel {
+	  public:
+		/// @brief Constructs an `AtomicLevel` storing `Level::DISABLED`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		constexpr AtomicLevel() noexcept = default;
+		/// @brief Constructs an `AtomicLevel` storing the given `Level`
+		///
+		/// @param level - The initial `Level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		constexpr AtomicLevel(Level level) noexcept // NOLINT(hicpp-explicit-conversions)
+			: m_level(level) {
+		}
+		/// @brief Copy constructor. Copies the `Level` currently stored in `level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		AtomicLevel(const AtomicLevel& level) noexcept : m_level(level.load()) {
+		}
+		/// @brief Move constructor. Copies the `Level` currently stored in `level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		AtomicLevel(AtomicLevel&& level) noexcept : m_level(level.load()) {
+		}
+		/// @brief Destructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		constexpr ~AtomicLevel() noexcept = default;
+
+		/// @brief Returns the currently stored `Level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		[[nodiscard]] inline auto load() const noexcept -> Level {
+			return m_level.load(std::memory_order_relaxed);
+		}
+
+		/// @brief Stores the given `Level`
+		///
+		/// @param level - The `Level` to store
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		inline auto store(Level level) noexcept -> void {
+			m_level.store(level, std::memory_order_relaxed);
+		}
+
+		/// @brief Copy-assignment operator. Copies the `Level` currently stored in `level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		auto operator=(const AtomicLevel& level) noexcept -> AtomicLevel& {
+			store(level.load());
+			return *this;
+		}
+		/// @brief Move-assignment operator. Copies the `Level` currently stored in `level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		auto operator=(AtomicLevel&& level) noexcept -> AtomicLevel& {
+			store(level.load());
+			return *this;
+		}
+		/// @brief Stores the given `Level`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Config.h"
+		auto operator=(Level level) noexcept -> AtomicLevel& {
+			store(level);
+			return *this;
+		}
+
+	  private:
+		std::atomic<Level> m_level = Level::DISABLED;
+	};
+
 	/// @brief Used to configure the threading policy of loggers
 	///
 	/// - `SingleThreaded`: Used to configure a logger to be used on a single thread only. Using a
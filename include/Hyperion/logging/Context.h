@@ -0,0 +1,530 @@
+/// @file Context.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Thread-local structured logging context (mapped diagnostic context)
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/Fmt.h>
+#include <Hyperion/HyperionDef.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <new>
+#include <string_view>
+#include <utility>
+
+namespace hyperion::logging {
+
+	/// @brief A single key/value pair of logging context, stored inline in a fixed-size slot
+	///
+	/// Keys longer than `KEY_CAPACITY` and values longer than `VALUE_CAPACITY` characters are
+	/// truncated.
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Context.h"
+	class ContextField {
+	  public:
+		/// @brief The maximum number of characters stored for a key
+		static constexpr usize KEY_CAPACITY = 15_usize;
+		/// @brief The maximum number of characters stored for a value
+		static constexpr usize VALUE_CAPACITY = 46_usize;
+
+		/// @brief Constructs an empty `ContextField`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextField() noexcept = default;
+		/// @brief Constructs a `ContextField` holding the given key and value
+		///
+		/// @param key - The key
+		/// @param value - The value
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextField(std::string_view key, std::string_view value) noexcept {
+			set_key(key);
+			set_value(value);
+		}
+		/// @brief Copy constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextField(const ContextField& field) noexcept = default;
+		/// @brief Move constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextField(ContextField&& field) noexcept = default;
+		/// @brief Destructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ~ContextField() noexcept = default;
+
+		/// @brief Returns the key of this field
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto key() const noexcept -> std::string_view {
+			return {m_key.data(), m_key_size};
+		}
+
+		/// @brief Returns the value of this field
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto value() const noexcept -> std::string_view {
+			return {m_value.data(), m_value_size};
+		}
+
+		/// @brief Sets the key of this field, truncating it to `KEY_CAPACITY` characters
+		///
+		/// @param key - The key
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto set_key(std::string_view key) noexcept -> void {
+			m_key_size = static_cast<u8>(std::min(key.size(), KEY_CAPACITY));
+			std::copy_n(key.begin(), m_key_size, m_key.begin());
+		}
+
+		/// @brief Sets the value of this field, truncating it to `VALUE_CAPACITY` characters
+		///
+		/// @param value - The value
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto set_value(std::string_view value) noexcept -> void {
+			m_value_size = static_cast<u8>(std::min(value.size(), VALUE_CAPACITY));
+			std::copy_n(value.begin(), m_value_size, m_value.begin());
+		}
+
+		/// @brief Formats the given value directly into this field's value storage, truncating
+		/// the result to `VALUE_CAPACITY` characters. Does not allocate
+		///
+		/// @param value - The value to format
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		template<typename T>
+		inline auto format_value(const T& value) noexcept -> void {
+			const auto result = fmt::format_to_n(m_value.begin(), VALUE_CAPACITY, "{}", value);
+			m_value_size = static_cast<u8>(std::min(result.size, VALUE_CAPACITY));
+		}
+
+		/// @brief Copy-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto operator=(const ContextField& field) noexcept -> ContextField& = default;
+		/// @brief Move-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto operator=(ContextField&& field) noexcept -> ContextField& = default;
+
+	  private:
+		std::array<char, KEY_CAPACITY> m_key = {};
+		u8 m_key_size = 0_u8;
+		std::array<char, VALUE_CAPACITY> m_value = {};
+		u8 m_value_size = 0_u8;
+	};
+
+	/// @brief A compact, fixed-capacity set of `ContextField`s
+	///
+	/// Each thread has a current `ContextSnapshot` (see `ScopedContext`). Entries don't store a
+	/// copy of it, but a `ContextHandle` to an immutable copy shared by every entry logged while
+	/// the context was unchanged (see `ContextHandle::capture`). The context is only formatted
+	/// when an entry is written by a sink.
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Context.h"
+	class ContextSnapshot {
+	  public:
+		/// @brief The maximum number of fields in a snapshot
+		static constexpr usize CAPACITY = 4_usize;
+
+		using iterator = const ContextField*;
+		using const_iterator = const ContextField*;
+
+		/// @brief Constructs an empty `ContextSnapshot`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextSnapshot() noexcept = default;
+		/// @brief Copy constructor. Only copies the fields in use
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextSnapshot(const ContextSnapshot& snapshot) noexcept
+			: m_size(snapshot.m_size), m_generation(snapshot.m_generation) {
+			std::copy_n(snapshot.m_fields.begin(), m_size, m_fields.begin());
+		}
+		/// @brief Move constructor. Only copies the fields in use
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextSnapshot(ContextSnapshot&& snapshot) noexcept
+			: ContextSnapshot(static_cast<const ContextSnapshot&>(snapshot)) {
+		}
+		/// @brief Destructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ~ContextSnapshot() noexcept = default;
+
+		/// @brief Returns the calling thread's current context
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] static inline auto current() noexcept -> ContextSnapshot& {
+			thread_local auto context = ContextSnapshot();
+			return context;
+		}
+
+		/// @brief Returns the number of fields in this snapshot
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto size() const noexcept -> usize {
+			return m_size;
+		}
+
+		/// @brief Returns the generation of this snapshot. The generation changes every time the
+		/// fields of the snapshot are modified
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto generation() const noexcept -> usize {
+			return m_generation;
+		}
+
+		/// @brief Returns whether this snapshot has no fields
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool {
+			return m_size == 0_usize;
+		}
+
+		/// @brief Returns whether this snapshot has no room for more fields
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto full() const noexcept -> bool {
+			return m_size == CAPACITY;
+		}
+
+		/// @brief Returns an iterator to the first field in this snapshot
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto begin() const noexcept -> const_iterator {
+			return m_fields.data();
+		}
+
+		/// @brief Returns an iterator past the last field in this snapshot
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto end() const noexcept -> const_iterator {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return m_fields.data() + m_size;
+		}
+
+		/// @brief Appends an empty field to this snapshot, if there is room for it
+		///
+		/// @return A pointer to the new field, or `nullptr` if this snapshot is full
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto push() noexcept -> ContextField* {
+			if(full()) {
+				return nullptr;
+			}
+
+			auto& field = m_fields.at(m_size++);
+			field = ContextField();
+			++m_generation;
+			return &field;
+		}
+
+		/// @brief Removes the most recently pushed field from this snapshot, if any
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto pop() noexcept -> void {
+			if(!empty()) {
+				--m_size;
+				++m_generation;
+			}
+		}
+
+		/// @brief Removes every field from this snapshot
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto clear() noexcept -> void {
+			m_size = 0_usize;
+			++m_generation;
+		}
+
+		/// @brief Copy-assignment operator. Only copies the fields in use
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto operator=(const ContextSnapshot& snapshot) noexcept -> ContextSnapshot& {
+			if(this == &snapshot) {
+				return *this;
+			}
+
+			m_size = snapshot.m_size;
+			std::copy_n(snapshot.m_fields.begin(), m_size, m_fields.begin());
+			++m_generation;
+			return *this;
+		}
+		/// @brief Move-assignment operator. Only copies the fields in use
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr auto operator=(ContextSnapshot&& snapshot) noexcept -> ContextSnapshot& {
+			return *this = static_cast<const ContextSnapshot&>(snapshot);
+		}
+
+	  private:
+		std::array<ContextField, CAPACITY> m_fields = {};
+		usize m_size = 0_usize;
+		usize m_generation = 0_usize;
+	};
+
+	/// @brief A compact, reference-counted handle to an immutable copy of a thread's logging
+	/// context
+	///
+	/// A `ContextHandle` is a single pointer, and an empty context is represented by a null
+	/// handle, so entries logged without any context pay only for the pointer. Each thread caches
+	/// the handle for its current context, so capturing an unchanged context only bumps a
+	/// reference count; the context is only copied again after it changes.
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Context.h"
+	class ContextHandle {
+	  public:
+		/// @brief Constructs an empty `ContextHandle`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextHandle() noexcept = default;
+		/// @brief Copy constructor. Shares the context of `handle`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		ContextHandle(const ContextHandle& handle) noexcept : m_node(handle.m_node) {
+			retain();
+		}
+		/// @brief Move constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		constexpr ContextHandle(ContextHandle&& handle) noexcept
+			: m_node(std::exchange(handle.m_node, nullptr)) {
+		}
+		/// @brief Destructor. Frees the shared context if this was the last handle to it
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		~ContextHandle() noexcept {
+			release();
+		}
+
+		/// @brief Returns a handle to the calling thread's current context
+		///
+		/// If the context hasn't changed since the last capture on this thread, this shares the
+		/// previously captured copy instead of making a new one. If the context is empty (or a
+		/// copy can't be allocated), this returns an empty handle.
+		///
+		/// @return A handle to the current context
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] static inline auto capture() noexcept -> ContextHandle {
+			const auto& current = ContextSnapshot::current();
+			if(current.empty()) {
+				return {};
+			}
+
+			thread_local auto cached = ContextHandle();
+			thread_local auto cached_generation = 0_usize;
+			if(cached.m_node == nullptr || cached_generation != current.generation()) {
+				// NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+				cached = ContextHandle(new(std::nothrow) Node{current, {1_usize}});
+				cached_generation = current.generation();
+			}
+
+			return cached;
+		}
+
+		/// @brief Returns whether this handle refers to no context
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto empty() const noexcept -> bool {
+			return m_node == nullptr;
+		}
+
+		/// @brief Returns the context this handle refers to, or an empty snapshot if it is empty
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		[[nodiscard]] constexpr auto snapshot() const noexcept -> const ContextSnapshot& {
+			return m_node == nullptr ? EMPTY : m_node->snapshot;
+		}
+
+		/// @brief Copy-assignment operator. Shares the context of `handle`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		auto operator=(const ContextHandle& handle) noexcept -> ContextHandle& {
+			if(m_node != handle.m_node) {
+				release();
+				m_node = handle.m_node;
+				retain();
+			}
+			return *this;
+		}
+		/// @brief Move-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		auto operator=(ContextHandle&& handle) noexcept -> ContextHandle& {
+			if(this != &handle) {
+				release();
+				m_node = std::exchange(handle.m_node, nullptr);
+			}
+			return *this;
+		}
+
+	  private:
+		/// @brief The shared, immutable copy of a context
+		struct Node {
+			ContextSnapshot snapshot;
+			std::atomic<usize> references;
+		};
+
+		static constexpr ContextSnapshot EMPTY = ContextSnapshot();
+
+		Node* m_node = nullptr;
+
+		explicit ContextHandle(Node* node) noexcept : m_node(node) {
+		}
+
+		inline auto retain() noexcept -> void {
+			if(m_node != nullptr) {
+				m_node->references.fetch_add(1_usize, std::memory_order_relaxed);
+			}
+		}
+
+		inline auto release() noexcept -> void {
+			if(m_node != nullptr
+			   && m_node->references.fetch_sub(1_usize, std::memory_order_acq_rel) == 1_usize)
+			{
+				delete m_node; // NOLINT(cppcoreguidelines-owning-memory)
+			}
+			m_node = nullptr;
+		}
+	};
+
+	/// @brief Adds a key/value pair to the calling thread's logging context for the lifetime of
+	/// this object
+	///
+	/// Every entry logged from the thread while the `ScopedContext` is alive includes the field.
+	/// `ScopedContext`s must be destroyed in the reverse order of their construction (which is
+	/// always the case for ordinary scoped variables). If the thread's context is already full,
+	/// the field is dropped.
+	///
+	/// Example:
+	/// @code {.cpp}
+	/// auto handle_request(const Request& request) -> void {
+	/// 	const auto request_id = logging::ScopedContext("request_id", request.id());
+	/// 	const auto tenant = logging::ScopedContext("tenant", request.tenant());
+	///
+	/// 	// entries logged here, and in any function called from here, include
+	/// 	// `request_id` and `tenant`
+	/// 	...
+	/// }
+	/// @endcode
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Context.h"
+	class ScopedContext {
+	  public:
+		/// @brief Adds the given key and value to the calling thread's logging context
+		///
+		/// @param key - The key
+		/// @param value - The value
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		ScopedContext(std::string_view key, std::string_view value) noexcept
+			: m_field(ContextSnapshot::current().push()) {
+			if(m_field != nullptr) {
+				m_field->set_key(key);
+				m_field->set_value(value);
+			}
+		}
+		/// @brief Adds the given key and value to the calling thread's logging context,
+		/// formatting the value once, up front
+		///
+		/// @param key - The key
+		/// @param value - The value
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		template<typename T>
+		requires(!concepts::Convertible<T, std::string_view>)
+		ScopedContext(std::string_view key, const T& value) noexcept
+			: m_field(ContextSnapshot::current().push()) {
+			if(m_field != nullptr) {
+				m_field->set_key(key);
+				m_field->format_value(value);
+			}
+		}
+		/// @brief Deleted copy constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		ScopedContext(const ScopedContext& context) = delete;
+		/// @brief Deleted move constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		ScopedContext(ScopedContext&& context) = delete;
+		/// @brief Destructor. Removes the field from the calling thread's logging context
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		~ScopedContext() noexcept {
+			if(m_field != nullptr) {
+				ContextSnapshot::current().pop();
+			}
+		}
+
+		/// @brief Deleted copy-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		auto operator=(const ScopedContext& context) -> ScopedContext& = delete;
+		/// @brief Deleted move-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Context.h"
+		auto operator=(ScopedContext&& context) -> ScopedContext& = delete;
+
+	  private:
+		ContextField* m_field;
+	};
+} // namespace hyperion::logging
+
+/// @brief Formats a `ContextSnapshot` as ` {key=value key=value}`, including the leading space,
+/// or as nothing at all if the snapshot is empty
+/// @ingroup logging
+/// @headerfile "Hyperion/logging/Context.h"
+template<>
+struct fmt::formatter<hyperion::logging::ContextSnapshot> {
+	// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+	[[nodiscard]] inline constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin()) {
+		return ctx.begin();
+	}
+
+	template<typename FormatContext>
+	[[nodiscard]] inline auto format(const hyperion::logging::ContextSnapshot& snapshot,
+									 FormatContext& ctx) -> decltype(ctx.out()) {
+		auto out = ctx.out();
+		if(snapshot.empty()) {
+			return out;
+		}
+
+		auto separator = std::string_view(" {");
+		for(const auto& field : snapshot) {
+			out = fmt::format_to(out, "{}{}={}", separator, field.key(), field.value());
+			separator = " ";
+		}
+
+		return fmt::format_to(out, "}}");
+	}
+};
@@ -31,12 +31,41 @@
 #include <Hyperion/Fmt.h>
 #include <Hyperion/HyperionDef.h>
 #include <Hyperion/logging/Config.h>
+#include <Hyperion/logging/Context.h>
+#include <Hyperion/memory/ThreadCachingAllocator.h>
 #include <Hyperion/mpl/List.h>
+#include <iterator>
+#include <string>
 #include <string_view>
 #include <variant>
 
 namespace hyperion::logging {
 
+	/// @brief The allocator log entries store their text with.
+	/// Entries are usually formatted on one thread and destroyed on the logging thread, which
+	/// `ThreadCachingAllocator` handles without contending on the global heap
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Entry.h"
+	template<typename T>
+	using EntryAllocator = ThreadCachingAllocator<T>;
+
+	/// @brief The string type log entries store their text in
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Entry.h"
+	using EntryString = std::basic_string<char, std::char_traits<char>, EntryAllocator<char>>;
+
+	namespace detail {
+		/// @brief Formats `args` according to `format_string` directly into an `EntryString`
+		template<typename String, typename... Args>
+		inline auto format_entry(String&& format_string, Args&&... args) noexcept -> EntryString {
+			auto entry = EntryString();
+			fmt::format_to(std::back_inserter(entry),
+						   std::forward<String>(format_string),
+						   std::forward<Args>(args)...);
+			return entry;
+		}
+	} // namespace detail
+
 	IGNORE_WEAK_VTABLES_START
 
 	/// @brief Base interface for a Hyperion logging entry
@@ -92,19 +121,19 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		template<typename... Args>
 		explicit MessageEntry(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename CharT, typename... Args>
 		explicit MessageEntry(fmt::basic_string_view<CharT>&& format_string,
 							  Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename String, typename... Args>
 		explicit MessageEntry(String&& format_string, Args&&... args) noexcept
-			: m_entry(
-				fmt::format(std::forward<String>(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::forward<String>(format_string),
+										   std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		MessageEntry(const MessageEntry& entry) noexcept = default;
@@ -144,7 +173,7 @@ namespace hyperion::logging {
 		auto operator=(MessageEntry&& entry) noexcept -> MessageEntry& = default;
 
 	  private:
-		std::string m_entry;
+		EntryString m_entry;
 	};
 
 	/// @brief Entry type for `Level::TRACE` log entries
@@ -165,18 +194,18 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		template<typename... Args>
 		explicit TraceEntry(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename CharT, typename... Args>
 		explicit TraceEntry(fmt::basic_string_view<CharT>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename String, typename... Args>
 		explicit TraceEntry(String&& format_string, Args&&... args) noexcept
-			: m_entry(
-				fmt::format(std::forward<String>(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::forward<String>(format_string),
+										   std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		TraceEntry(const TraceEntry& entry) noexcept = default;
@@ -215,7 +244,7 @@ namespace hyperion::logging {
 		auto operator=(TraceEntry&& entry) noexcept -> TraceEntry& = default;
 
 	  private:
-		std::string m_entry;
+		EntryString m_entry;
 	};
 
 	/// @brief Entry type for `Level::INFO` log entries
@@ -236,18 +265,18 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		template<typename... Args>
 		explicit InfoEntry(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename CharT, typename... Args>
 		explicit InfoEntry(fmt::basic_string_view<CharT>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename String, typename... Args>
 		explicit InfoEntry(String&& format_string, Args&&... args) noexcept
-			: m_entry(
-				fmt::format(std::forward<String>(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::forward<String>(format_string),
+										   std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		InfoEntry(const InfoEntry& entry) noexcept = default;
@@ -286,7 +315,7 @@ namespace hyperion::logging {
 		auto operator=(InfoEntry&& entry) noexcept -> InfoEntry& = default;
 
 	  private:
-		std::string m_entry;
+		EntryString m_entry;
 	};
 
 	/// @brief Entry type for `Level::WARN` log entries
@@ -307,18 +336,18 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		template<typename... Args>
 		explicit WarnEntry(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename CharT, typename... Args>
 		explicit WarnEntry(fmt::basic_string_view<CharT>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename String, typename... Args>
 		explicit WarnEntry(String&& format_string, Args&&... args) noexcept
-			: m_entry(
-				fmt::format(std::forward<String>(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::forward<String>(format_string),
+										   std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		WarnEntry(const WarnEntry& entry) noexcept = default;
@@ -357,7 +386,7 @@ namespace hyperion::logging {
 		auto operator=(WarnEntry&& entry) noexcept -> WarnEntry& = default;
 
 	  private:
-		std::string m_entry;
+		EntryString m_entry;
 	};
 
 	/// @brief Entry type for `Level::ERROR` log entries
@@ -378,18 +407,18 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		template<typename... Args>
 		explicit ErrorEntry(fmt::format_string<Args...>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename CharT, typename... Args>
 		explicit ErrorEntry(fmt::basic_string_view<CharT>&& format_string, Args&&... args) noexcept
-			: m_entry(fmt::format(std::move(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::move(format_string), std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		template<typename String, typename... Args>
 		explicit ErrorEntry(String&& format_string, Args&&... args) noexcept
-			: m_entry(
-				fmt::format(std::forward<String>(format_string), std::forward<Args>(args)...)) {
+			: m_entry(detail::format_entry(std::forward<String>(format_string),
+										   std::forward<Args>(args)...)) {
 		}
 		/// @ingroup logging
 		ErrorEntry(const ErrorEntry& entry) noexcept = default;
@@ -428,7 +457,7 @@ namespace hyperion::logging {
 		auto operator=(ErrorEntry&& entry) noexcept -> ErrorEntry& = default;
 
 	  private:
-		std::string m_entry;
+		EntryString m_entry;
 	};
 
 	IGNORE_WEAK_VTABLES_STOP
@@ -530,10 +559,27 @@ namespace hyperion::logging {
 			return !(this->valueless_by_exception());
 		}
 
+		/// @brief Returns the structured logging context captured with this entry
+		///
+		/// @return the context of this entry
+		/// @ingroup logging
+		[[nodiscard]] inline constexpr auto context() const noexcept -> const ContextSnapshot& {
+			return m_context.snapshot();
+		}
+
+		/// @brief Captures the calling thread's current logging context into this entry
+		/// @ingroup logging
+		inline auto capture_context() noexcept -> void {
+			m_context = ContextHandle::capture();
+		}
+
 		/// @ingroup logging
 		auto operator=(const Entry& entry) noexcept -> Entry& = default;
 		/// @ingroup logging
 		auto operator=(Entry&& entry) noexcept -> Entry& = default;
+
+	  private:
+		ContextHandle m_context;
 	};
 
 	IGNORE_PADDING_STOP
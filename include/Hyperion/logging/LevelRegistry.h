@@ -0,0 +1,284 @@
+/// @file LevelRegistry.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime-adjustable logging levels for tags (modules, subsystems, etc.)
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Result.h>
+#include <Hyperion/logging/Config.h>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace hyperion::logging {
+
+	/// @brief Converts the given string to the `Level` it names
+	///
+	/// Accepts the names of the `Level` enumerators ("DISABLED", "MESSAGE", "TRACE", "INFO",
+	/// "WARN", "ERROR"), case-insensitively
+	///
+	/// @param name - The name of the level
+	///
+	/// @return The named `Level`, or `None` if `name` doesn't name a `Level`
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/LevelRegistry.h"
+	[[nodiscard]] auto level_from_string(std::string_view name) noexcept -> Option<Level>;
+
+	namespace detail {
+		struct TagData {
+			std::string name;
+			AtomicLevel level;
+		};
+	} // namespace detail
+
+	/// @brief Handle to the runtime-adjustable `Level` of a logging tag
+	///
+	/// Tags let entries be filtered by the module or subsystem that logs them, independently of
+	/// the logger they are logged to. A `Tag` is cheap to copy and remains valid for the lifetime
+	/// of the program, so it's intended to be retrieved once (e.g. into a `static`) and reused:
+	/// checking whether a level is enabled for a tag is a single relaxed load.
+	///
+	/// Example:
+	/// @code {.cpp}
+	/// static const auto net_tag = logging::LevelRegistry::get_tag("net");
+	///
+	/// ignore(logger.log<logging::Level::TRACE>(net_tag, None(), "received {} bytes", size));
+	///
+	/// // later, possibly on another thread:
+	/// logging::LevelRegistry::set_level("net", logging::Level::WARN);
+	/// @endcode
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/LevelRegistry.h"
+	class Tag {
+	  public:
+		/// @brief Deleted default constructor. Get a `Tag` from `LevelRegistry::get_tag`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		Tag() noexcept = delete;
+		/// @brief Copy constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		constexpr Tag(const Tag& tag) noexcept = default;
+		/// @brief Move constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		constexpr Tag(Tag&& tag) noexcept = default;
+		/// @brief Destructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		constexpr ~Tag() noexcept = default;
+
+		/// @brief Returns the name of this tag
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] inline auto name() const noexcept -> std::string_view {
+			return m_data->name;
+		}
+
+		/// @brief Returns the `Level` currently configured for this tag
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] inline auto level() const noexcept -> Level {
+			return m_data->level.load();
+		}
+
+		/// @brief Returns whether entries of the given `Level` should be logged for this tag,
+		/// i.e. whether `level` is above the `Level` configured for this tag. This matches the
+		/// semantics of a logger's minimum level
+		///
+		/// @param level - The `Level` to check
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] inline auto is_enabled(Level level) const noexcept -> bool {
+			return level > m_data->level.load();
+		}
+
+		/// @brief Copy-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		constexpr auto operator=(const Tag& tag) noexcept -> Tag& = default;
+		/// @brief Move-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		constexpr auto operator=(Tag&& tag) noexcept -> Tag& = default;
+
+	  private:
+		const detail::TagData* m_data;
+
+		explicit constexpr Tag(const detail::TagData* data) noexcept : m_data(data) {
+		}
+
+		friend class LevelRegistry;
+	};
+
+	/// @brief Global registry of the runtime-adjustable `Level`s of logging tags
+	///
+	/// Tag levels can be changed at runtime, from any thread, either directly with `set_level`
+	/// or by applying a configuration with `apply_config`, `apply_config_file`, or a
+	/// `LevelConfigWatcher`. Configurations consist of one `tag = LEVEL` assignment per line.
+	/// Blank lines and lines starting with `#` are ignored:
+	///
+	/// @code
+	/// # raise verbosity for networking while we investigate
+	/// net = TRACE
+	/// storage = WARN
+	/// @endcode
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/LevelRegistry.h"
+	class LevelRegistry {
+	  public:
+		/// @brief The `Level` tags are configured with when they are first registered. Because
+		/// a tag's level is an exclusive minimum, this lets every entry through, so tags only
+		/// filter entries once they've been configured
+		static constexpr auto DEFAULT_LEVEL = Level::DISABLED;
+
+		/// @brief Returns the `Tag` with the given name, registering it with `DEFAULT_LEVEL` if
+		/// it hasn't been registered yet
+		///
+		/// @param name - The name of the tag
+		///
+		/// @return The `Tag`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] static auto get_tag(std::string_view name) noexcept -> Tag;
+
+		/// @brief Returns the `Level` currently configured for the tag with the given name, if
+		/// it has been registered
+		///
+		/// @param name - The name of the tag
+		///
+		/// @return The tag's `Level`, or `None` if no tag with the given name has been registered
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] static auto get_level(std::string_view name) noexcept -> Option<Level>;
+
+		/// @brief Sets the `Level` of the tag with the given name, registering the tag if it
+		/// hasn't been registered yet
+		///
+		/// @param name - The name of the tag
+		/// @param level - The `Level` to configure the tag with
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		static auto set_level(std::string_view name, Level level) noexcept -> void;
+
+		/// @brief Applies the tag levels in the given configuration
+		///
+		/// The configuration is validated in full before any level is changed, so a malformed
+		/// configuration leaves every tag's level untouched.
+		///
+		/// # Errors
+		/// Returns an error (`EINVAL`) if any non-blank, non-comment line isn't a valid
+		/// `tag = LEVEL` assignment
+		///
+		/// @param config - The configuration to apply
+		///
+		/// @return The number of tag levels that were set
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] static auto apply_config(std::string_view config) noexcept -> Result<usize>;
+
+		/// @brief Reads the file at the given path and applies the tag levels configured in it
+		///
+		/// # Errors
+		/// Returns an error if reading the file fails, or if its contents aren't a valid
+		/// configuration (see `apply_config`)
+		///
+		/// @param path - The path to the configuration file
+		///
+		/// @return The number of tag levels that were set
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		[[nodiscard]] static auto
+		apply_config_file(const std::filesystem::path& path) noexcept -> Result<usize>;
+	};
+
+	IGNORE_PADDING_START
+	/// @brief Watches a tag-level configuration file, applying it whenever it changes
+	///
+	/// Polls the modification time of the file at the configured interval on a background
+	/// thread, and applies the file with `LevelRegistry::apply_config_file` whenever it changes.
+	/// The file is also applied once when watching starts, if it exists. Malformed
+	/// configurations are ignored until the file changes again.
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/LevelRegistry.h"
+	class LevelConfigWatcher {
+	  public:
+		/// @brief The default interval at which the configuration file is polled
+		static constexpr auto DEFAULT_POLL_INTERVAL = std::chrono::milliseconds(1000);
+
+		/// @brief Deleted default constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		LevelConfigWatcher() noexcept = delete;
+		/// @brief Starts watching the configuration file at the given path
+		///
+		/// @param path - The path to the configuration file
+		/// @param poll_interval - How often to check the file for modifications
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		explicit LevelConfigWatcher(std::filesystem::path path,
+									std::chrono::milliseconds poll_interval
+									= DEFAULT_POLL_INTERVAL) noexcept;
+		/// @brief Deleted copy constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		LevelConfigWatcher(const LevelConfigWatcher& watcher) = delete;
+		/// @brief Deleted move constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		LevelConfigWatcher(LevelConfigWatcher&& watcher) = delete;
+		/// @brief Destructor. Stops watching the configuration file
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		~LevelConfigWatcher() noexcept;
+
+		/// @brief Deleted copy-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		auto operator=(const LevelConfigWatcher& watcher) -> LevelConfigWatcher& = delete;
+		/// @brief Deleted move-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/LevelRegistry.h"
+		auto operator=(LevelConfigWatcher&& watcher) -> LevelConfigWatcher& = delete;
+
+	  private:
+		std::filesystem::path m_path;
+		std::chrono::milliseconds m_poll_interval;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_stop = false;
+		std::thread m_thread;
+
+		auto watch() noexcept -> void;
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion::logging
@@ -1,6 +1,7 @@
 /// @file Queue.h
 /// @author Braxton Salyer <braxtonsalyer@gmail.com>
-/// @brief Wraps hyperion::LocFreeQueue in a way that directly maps to asynchronous logging policies
+/// @brief Wraps hyperion::LocFreeQueue (or hyperion::SPSCQueue, for single-threaded loggers) in a
+/// way that directly maps to asynchronous logging policies
 /// @version 0.1
 /// @date 2022-06-23
 ///
@@ -29,7 +30,12 @@
 #include <Hyperion/BasicTypes.h>
 #include <Hyperion/HyperionDef.h>
 #include <Hyperion/LockFreeQueue.h>
+#include <Hyperion/Memory.h>
 #include <Hyperion/Result.h>
+#include <Hyperion/SPSCQueue.h>
+#include <Hyperion/logging/Config.h>
+#include <functional>
+#include <type_traits>
 
 namespace hyperion::logging {
 	/// @brief Types of `Error`s that can occur with `Queue`
@@ -97,12 +103,37 @@ namespace hyperion::logging {
 	static constexpr usize DEFAULT_QUEUE_CAPACITY = 64_usize;
 
 	IGNORE_PADDING_START
+	/// @brief The queue an asynchronous logger hands entries to its logging thread through.
+	///
+	/// A `SingleThreadedAsync` logger has exactly one producer (the thread using the logger) and
+	/// one consumer (the logging thread), so its entries go through a wait-free `SPSCQueue`.
+	/// `OverwriteWhenFull` needs the producer to displace entries the consumer may be reading,
+	/// which `SPSCQueue` can't allow, so that policy (and every `MultiThreadedAsync` logger) uses
+	/// `LockFreeQueue` instead.
+	///
+	/// @tparam T - The type of the entries
+	/// @tparam Policy - What to do when the queue is full
+	/// @tparam Capacity - The capacity of the queue
+	/// @tparam Threading - The threading policy of the logger using the queue
 	template<typename T,
 			 QueuePolicy Policy = QueuePolicy::ErrWhenFull,
-			 usize Capacity = DEFAULT_QUEUE_CAPACITY>
+			 usize Capacity = DEFAULT_QUEUE_CAPACITY,
+			 ThreadingPolicy Threading = ThreadingPolicy::MultiThreadedAsync>
 	class Queue {
+		static constexpr bool USE_SPSC = Threading == ThreadingPolicy::SingleThreadedAsync
+										 && Policy != QueuePolicy::OverwriteWhenFull;
+		using Storage = std::conditional_t<USE_SPSC,
+										   SPSCQueue<T, LargePageAllocator>,
+										   LockFreeQueue<T, LargePageAllocator>>;
+
 	  public:
 		Queue() noexcept = default;
+		/// @brief Constructs a `Queue` whose storage is allocated with the given `LargePageOptions`
+		///
+		/// @param options - The options to allocate the queue's storage with
+		explicit Queue(const LargePageOptions& options) noexcept
+			: m_data(make_storage(options)) {
+		}
 		constexpr Queue(const Queue& queue) noexcept = default;
 		constexpr Queue(Queue&& queue) noexcept = default;
 		constexpr ~Queue() noexcept = default;
@@ -191,6 +222,33 @@ namespace hyperion::logging {
 			return Err(QueueError(make_error_code(QueueErrorCategory::QueueIsEmpty)));
 		}
 
+		/// @brief Passes (at most) `max_count` entries from the front of the queue to
+		/// `consumer`, in order. When backed by `SPSCQueue` the whole batch is released back to
+		/// the producer with a single store
+		///
+		/// @param consumer - The function to call with each entry
+		/// @param max_count - The maximum number of entries to read
+		///
+		/// @return The number of entries read
+		template<typename F>
+		requires std::is_nothrow_invocable_v<F, T&&>
+		inline auto read_batch(F&& consumer, usize max_count) noexcept -> usize {
+			if constexpr(USE_SPSC) {
+				return m_data.pop_batch(std::forward<F>(consumer), max_count);
+			}
+			else {
+				auto count = 0_usize;
+				for(; count < max_count; ++count) {
+					auto entry = m_data.pop_front();
+					if(entry.is_none()) {
+						break;
+					}
+					std::invoke(consumer, entry.unwrap());
+				}
+				return count;
+			}
+		}
+
 		[[nodiscard]] inline auto empty() const noexcept -> bool {
 			return m_data.empty();
 		}
@@ -199,11 +257,23 @@ namespace hyperion::logging {
 			return m_data.full();
 		}
 
+		/// @brief Returns the current number of entries in the queue
+		/// @note When used concurrently, this is only a snapshot
+		[[nodiscard]] inline auto size() const noexcept -> usize {
+			return m_data.size();
+		}
+
 		constexpr auto operator=(const Queue& queue) noexcept -> Queue& = default;
 		constexpr auto operator=(Queue&& queue) noexcept -> Queue& = default;
 
 	  private:
-		LockFreeQueue<T> m_data = LockFreeQueue<T>(Capacity);
+		Storage m_data = Storage(Capacity);
+
+		[[nodiscard]] static inline auto
+		make_storage(const LargePageOptions& options) noexcept -> Storage {
+			const auto scope = LargePageScope(options);
+			return Storage(Capacity);
+		}
 	};
 	IGNORE_PADDING_STOP
 } // namespace hyperion::logging
@@ -34,9 +34,15 @@
 #include <Hyperion/logging/Config.h>
 #include <Hyperion/logging/Entry.h>
 #include <Hyperion/mpl/List.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <cstdio>
 #include <filesystem>
+#include <mutex>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace hyperion::logging {
@@ -53,6 +59,31 @@ namespace hyperion::logging {
 		virtual constexpr auto sink(Entry&& entry) noexcept -> void = 0;
 		[[nodiscard]] virtual constexpr auto get_log_level() const noexcept -> Level = 0;
 		virtual constexpr auto set_log_level(Level level) noexcept -> void = 0;
+		/// @brief Flushes any output buffered by this sink to its destination
+		///
+		/// The default implementation does nothing, for sinks that don't buffer output
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Sink.h"
+		virtual auto flush() noexcept -> void {
+		}
+		/// @brief Flushes any output buffered by this sink to its destination, giving up if
+		/// that can't be done by `deadline`
+		///
+		/// The default implementation calls `flush()`, for sinks whose flush is bounded on its
+		/// own (e.g. a flush of a file or standard stream). Sinks whose flush waits on another
+		/// thread (e.g. `SinkGroup`) override this to respect `deadline`
+		///
+		/// @param deadline - The point in time to give up at
+		///
+		/// @return Whether the flush completed before `deadline`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Sink.h"
+		virtual auto
+		flush_until([[maybe_unused]] std::chrono::steady_clock::time_point deadline) noexcept
+			-> bool {
+			flush();
+			return true;
+		}
 
 		auto operator=(const SinkBase&) noexcept -> SinkBase& = default;
 		auto operator=(SinkBase&&) noexcept -> SinkBase& = default;
@@ -109,7 +140,7 @@ namespace hyperion::logging {
 		/// @brief Move constructor
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
-		constexpr FileSink(FileSink&& sink) noexcept = default;
+		FileSink(FileSink&& sink) noexcept = default;
 		/// @brief Destructor
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
@@ -139,18 +170,25 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
 		[[nodiscard]] inline auto get_log_level() const noexcept -> Level override {
-			return m_log_level;
+			return m_log_level.load();
 		}
 
 		/// @brief Sets the configured `Level` for this sink to the given one
 		///
+		/// This can be called from any thread, including while the sink is in use by a logger
+		///
 		/// @param level - The `Level` to configure this sink to
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
 		inline auto set_log_level(Level level) noexcept -> void override {
-			m_log_level = level;
+			m_log_level.store(level);
 		}
 
+		/// @brief Flushes any output buffered for the file associated with this
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Sink.h"
+		auto flush() noexcept -> void override;
+
 		/// @brief Creates a file for logging in the system temporary files directory
 		///
 		/// Attempts to create an `fs::File` with the given root file name (it will be decorated
@@ -185,11 +223,11 @@ namespace hyperion::logging {
 		/// @brief Move-assignment operator
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
-		constexpr auto operator=(FileSink&& sink) noexcept -> FileSink& = default;
+		auto operator=(FileSink&& sink) noexcept -> FileSink& = default;
 
 	  private:
 		fs::File m_file;
-		Level m_log_level = Level::MESSAGE;
+		AtomicLevel m_log_level = Level::MESSAGE;
 	};
 
 	/// @brief Basic logging sink that writes to `stdout`
@@ -249,16 +287,25 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
 		[[nodiscard]] inline auto get_log_level() const noexcept -> Level final {
-			return m_log_level;
+			return m_log_level.load();
 		}
 
 		/// @brief Sets the configured `Level` for this sink to the given one
 		///
+		/// This can be called from any thread, including while the sink is in use by a logger
+		///
 		/// @param level - The `Level` to configure this sink to
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
 		inline auto set_log_level(Level level) noexcept -> void final {
-			m_log_level = level;
+			m_log_level.store(level);
+		}
+
+		/// @brief Flushes any output buffered for `stdout`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Sink.h"
+		inline auto flush() noexcept -> void final {
+			ignore(std::fflush(stdout));
 		}
 
 		/// @brief Copy-assignment operator
@@ -271,7 +318,7 @@ namespace hyperion::logging {
 		constexpr auto operator=(StdoutSink&& sink) noexcept -> StdoutSink& = default;
 
 	  private:
-		Level m_log_level = Level::ERROR;
+		AtomicLevel m_log_level = Level::ERROR;
 	};
 
 	/// @brief Basic logging sink that writes to `stderr`
@@ -331,16 +378,25 @@ namespace hyperion::logging {
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
 		[[nodiscard]] inline auto get_log_level() const noexcept -> Level final {
-			return m_log_level;
+			return m_log_level.load();
 		}
 
 		/// @brief Sets the configured `Level` for this sink to the given one
 		///
+		/// This can be called from any thread, including while the sink is in use by a logger
+		///
 		/// @param level - The `Level` to configure this sink to
 		/// @ingroup logging
 		/// @headerfile "Hyperion/logging/Sink.h"
 		inline auto set_log_level(Level level) noexcept -> void final {
-			m_log_level = level;
+			m_log_level.store(level);
+		}
+
+		/// @brief Flushes any output buffered for `stderr`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/Sink.h"
+		inline auto flush() noexcept -> void final {
+			ignore(std::fflush(stderr));
 		}
 
 		/// @brief Copy-assignment operator
@@ -353,7 +409,7 @@ namespace hyperion::logging {
 		constexpr auto operator=(StderrSink&& sink) noexcept -> StderrSink& = default;
 
 	  private:
-		Level m_log_level = Level::INFO;
+		AtomicLevel m_log_level = Level::INFO;
 	};
 	IGNORE_PADDING_STOP
 
@@ -670,4 +726,108 @@ namespace hyperion::logging {
 			= std::vector<hyperion::UniquePtr<SinkBase>>();
 	};
 
+	namespace detail {
+		using FlushClock = std::chrono::steady_clock;
+
+		/// @brief Returns the point in time `timeout` from now, saturating at the latest
+		/// representable point instead of overflowing
+		[[nodiscard]] inline auto
+		flush_deadline(std::chrono::nanoseconds timeout) noexcept -> FlushClock::time_point {
+			const auto now = FlushClock::now();
+			if(timeout >= FlushClock::time_point::max() - now) {
+				return FlushClock::time_point::max();
+			}
+
+			return now + std::chrono::duration_cast<FlushClock::duration>(timeout);
+		}
+
+		/// @brief Flushes every sink in `sinks`, giving up on any that can't finish by
+		/// `deadline`
+		///
+		/// @return Whether every sink finished flushing before `deadline`
+		[[nodiscard]] inline auto
+		flush_sinks(const Sinks& sinks, FlushClock::time_point deadline) noexcept -> bool {
+			auto flushed = true;
+			for(const auto& sink : sinks) {
+				flushed = sink->flush_until(deadline) && flushed;
+			}
+
+			return flushed;
+		}
+
+		IGNORE_PADDING_START
+		/// @brief Tracks flush requests made to a consumer thread, by sequence number
+		///
+		/// `request` takes a ticket and records the requester's deadline, and `wait` blocks
+		/// until the consumer thread has published a completed sequence number at least as
+		/// large as the ticket, or the deadline passes. The consumer thread `take`s every
+		/// request made so far, along with the latest of their deadlines, flushes, and then
+		/// `complete`s them if the flush finished in time. Requesters with earlier deadlines
+		/// stop waiting on their own.
+		class FlushRequests {
+		  public:
+			/// @brief Requests a flush that should complete by `deadline`
+			///
+			/// @return The ticket to `wait` on
+			[[nodiscard]] inline auto request(FlushClock::time_point deadline) noexcept -> u64 {
+				auto lock = std::scoped_lock(m_mutex);
+				m_deadline = std::max(m_deadline, deadline);
+				return m_requested.fetch_add(1_u64, std::memory_order_acq_rel) + 1_u64;
+			}
+
+			/// @brief Waits until the flush with the given ticket has completed, or `deadline`
+			/// has passed
+			///
+			/// @return Whether the flush completed
+			[[nodiscard]] inline auto
+			wait(u64 ticket, FlushClock::time_point deadline) noexcept -> bool {
+				auto lock = std::unique_lock(m_mutex);
+				const auto completed = [this, ticket]() noexcept {
+					return m_completed >= ticket;
+				};
+
+				if(deadline == FlushClock::time_point::max()) {
+					m_condition.wait(lock, completed);
+					return true;
+				}
+
+				return m_condition.wait_until(lock, deadline, completed);
+			}
+
+			/// @brief Returns whether there are requests the consumer thread hasn't taken yet.
+			/// Only called from the consumer thread
+			[[nodiscard]] inline auto pending() const noexcept -> bool {
+				return m_requested.load(std::memory_order_acquire) != m_serviced;
+			}
+
+			/// @brief Takes every request made so far. Only called from the consumer thread
+			///
+			/// @return The sequence number to `complete` once the requests have been serviced,
+			/// and the deadline to service them by
+			[[nodiscard]] inline auto take() noexcept -> std::pair<u64, FlushClock::time_point> {
+				auto lock = std::scoped_lock(m_mutex);
+				m_serviced = m_requested.load(std::memory_order_acquire);
+				return {m_serviced, std::exchange(m_deadline, FlushClock::time_point::min())};
+			}
+
+			/// @brief Marks every request up to `requested` as completed and wakes their
+			/// waiters. Only called from the consumer thread
+			inline auto complete(u64 requested) noexcept -> void {
+				{
+					auto lock = std::scoped_lock(m_mutex);
+					m_completed = requested;
+				}
+				m_condition.notify_all();
+			}
+
+		  private:
+			std::atomic<u64> m_requested = 0_u64;
+			u64 m_serviced = 0_u64;
+			u64 m_completed = 0_u64;
+			FlushClock::time_point m_deadline = FlushClock::time_point::min();
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+		};
+		IGNORE_PADDING_STOP
+	} // namespace detail
 } // namespace hyperion::logging
@@ -0,0 +1,322 @@
+/// @file SinkGroup.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Groups of sinks that are fed asynchronously by their own consumer thread
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Ignore.h>
+#include <Hyperion/logging/Config.h>
+#include <Hyperion/logging/Entry.h>
+#include <Hyperion/logging/Queue.h>
+#include <Hyperion/logging/Sink.h>
+#include <Hyperion/logging/Thread.h>
+#include <algorithm>
+#include <atomic>
+#include <semaphore>
+#include <thread>
+
+namespace hyperion::logging {
+
+	/// @brief The default capacity of the queue feeding a `SinkGroup`
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/SinkGroup.h"
+	static constexpr usize DEFAULT_SINK_GROUP_CAPACITY = 1024_usize;
+
+	IGNORE_PADDING_START
+	IGNORE_WEAK_VTABLES_START
+
+	/// @brief A sink that owns a group of sinks and writes to them from its own thread
+	///
+	/// Entries sunk into a `SinkGroup` are pushed into the group's queue and written to the
+	/// group's sinks by the group's own consumer thread, so the thread feeding the group (e.g. an
+	/// asynchronous logger's logging thread) only pays the cost of the enqueue. Partitioning a
+	/// logger's sinks into several groups lets fast sinks make progress independently of slow
+	/// ones (e.g. a network-backed or compressing file sink), and lets log output use more than
+	/// one core.
+	///
+	/// Example:
+	/// @code {.cpp}
+	/// auto slow_sinks = logging::Sinks();
+	/// slow_sinks.push_back(logging::make_sink<logging::FileSink>(std::move(file)));
+	///
+	/// auto sinks = logging::Sinks();
+	/// sinks.push_back(logging::make_sink<logging::StderrSink<>>());
+	/// sinks.push_back(logging::make_sink<logging::SinkGroup<>>(std::move(slow_sinks)));
+	/// auto logger = Logger<Parameters>(std::move(sinks));
+	/// @endcode
+	///
+	/// @tparam Policy - How the group behaves when its queue is full. With
+	/// `AsyncPolicy::DropWhenFull` a slow group drops entries instead of applying back pressure
+	/// to whatever feeds it
+	/// @tparam Capacity - The capacity of the group's queue
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/SinkGroup.h"
+	template<AsyncPolicy Policy = AsyncPolicy::BlockWhenFull,
+			 usize Capacity = DEFAULT_SINK_GROUP_CAPACITY>
+	class SinkGroup final : public SinkBase {
+	  public:
+		/// @brief The default name given to a `SinkGroup`'s consumer thread
+		static constexpr auto DEFAULT_THREAD_NAME = "HyperionSinks";
+
+		/// @brief Deleted default constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		SinkGroup() noexcept = delete;
+		/// @brief Constructs a `SinkGroup` that will write to the given `Sinks`
+		///
+		/// @param sinks - The sinks in the group
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		explicit SinkGroup(Sinks&& sinks) noexcept
+			: SinkGroup(std::move(sinks), ThreadOptions{.name = DEFAULT_THREAD_NAME}) {
+		}
+		/// @brief Constructs a `SinkGroup` that will write to the given `Sinks`, with its
+		/// consumer thread placed according to the given `ThreadOptions`
+		///
+		/// @param sinks - The sinks in the group
+		/// @param options - The name, CPU affinity, and priority to give the consumer thread
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		SinkGroup(Sinks&& sinks, ThreadOptions options) noexcept : m_sinks(std::move(sinks)) {
+#if HYPERION_HAS_JTHREAD
+			m_thread = std::jthread(
+				[this, _options = std::move(options)](const std::stop_token& token) noexcept {
+					ignore(set_current_thread_options(_options));
+					consumer_thread_function(token);
+				});
+#else
+			m_thread = std::thread([this, _options = std::move(options)]() noexcept {
+				ignore(set_current_thread_options(_options));
+				consumer_thread_function();
+			});
+#endif
+		}
+		/// @brief Deleted copy constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		SinkGroup(const SinkGroup& group) = delete;
+		/// @brief Deleted move constructor
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		SinkGroup(SinkGroup&& group) = delete;
+		/// @brief Destructor. Writes any queued entries to the group's sinks before returning
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		~SinkGroup() noexcept final {
+#if HYPERION_HAS_JTHREAD
+			m_thread.request_stop();
+#else
+			m_exit_flag.store(true);
+#endif
+			m_signal.release(1);
+			m_thread.join();
+		}
+
+		/// @brief Queues the given entry to be written to the group's sinks
+		///
+		/// Queues the given entry if it is at or above the configured `Level`. Otherwise, does
+		/// nothing
+		///
+		/// @param entry - The entry to sink
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto sink(const Entry& entry) noexcept -> void final {
+			if(entry.level() >= m_log_level.load()) {
+				push(entry);
+			}
+		}
+
+		/// @brief Queues the given entry to be written to the group's sinks
+		///
+		/// Queues the given entry if it is at or above the configured `Level`. Otherwise, does
+		/// nothing
+		///
+		/// @param entry - The entry to sink
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto sink(Entry&& entry) noexcept -> void final {
+			if(entry.level() >= m_log_level.load()) {
+				push(std::move(entry));
+			}
+		}
+
+		/// @brief Returns the currently configured `Level` for this group
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		[[nodiscard]] auto get_log_level() const noexcept -> Level final {
+			return m_log_level.load();
+		}
+
+		/// @brief Sets the configured `Level` for this group to the given one.
+		///
+		/// Entries below this level are discarded before being queued. The sinks in the group
+		/// still apply their own levels to the entries they receive.
+		///
+		/// @param level - The `Level` to configure this group to
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto set_log_level(Level level) noexcept -> void final {
+			m_log_level.store(level);
+		}
+
+		/// @brief Blocks until every entry queued before the call has been written to the
+		/// group's sinks, then flushes them
+		/// @note This waits for as long as the group's sinks take. Use `flush_until` to bound
+		/// the wait
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto flush() noexcept -> void final {
+			ignore(flush_until(detail::FlushClock::time_point::max()));
+		}
+
+		/// @brief Blocks until every entry queued before the call has been written to the
+		/// group's sinks and they have been flushed, or until `deadline` has passed
+		///
+		/// The group's consumer thread passes `deadline` on to the group's sinks, so a nested
+		/// group gives up at the same time.
+		///
+		/// @param deadline - The point in time to give up at
+		///
+		/// @return Whether the flush completed before `deadline`
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto flush_until(detail::FlushClock::time_point deadline) noexcept -> bool final {
+			const auto ticket = m_flush_requests.request(deadline);
+			m_signal.release(1);
+
+			return m_flush_requests.wait(ticket, deadline);
+		}
+
+		/// @brief Deleted copy-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto operator=(const SinkGroup& group) -> SinkGroup& = delete;
+		/// @brief Deleted move-assignment operator
+		/// @ingroup logging
+		/// @headerfile "Hyperion/logging/SinkGroup.h"
+		auto operator=(SinkGroup&& group) -> SinkGroup& = delete;
+
+	  private:
+		[[nodiscard]] static inline consteval auto get_queue_policy() noexcept -> QueuePolicy {
+			if constexpr(Policy == AsyncPolicy::DropWhenFull) {
+				return QueuePolicy::ErrWhenFull;
+			}
+			else if constexpr(Policy == AsyncPolicy::OverwriteWhenFull) {
+				return QueuePolicy::OverwriteWhenFull;
+			}
+			else {
+				return QueuePolicy::BlockWhenFull;
+			}
+		}
+
+		Sinks m_sinks;
+		Queue<Entry, get_queue_policy(), Capacity> m_queue;
+		std::counting_semaphore<> m_signal = std::counting_semaphore<>(0);
+		AtomicLevel m_log_level = Level::MESSAGE;
+
+		detail::FlushRequests m_flush_requests;
+
+#if HYPERION_HAS_JTHREAD
+		std::jthread m_thread;
+#else
+		std::atomic_bool m_exit_flag = false;
+		std::thread m_thread;
+#endif
+
+		template<typename U>
+		inline auto push(U&& entry) noexcept -> void {
+			if constexpr(Policy == AsyncPolicy::DropWhenFull) {
+				if(m_queue.push(std::forward<U>(entry)).is_err()) {
+					return;
+				}
+			}
+			else {
+				m_queue.push(std::forward<U>(entry));
+			}
+
+			m_signal.release(1);
+		}
+
+		inline auto try_sink_next() noexcept -> bool {
+			return m_queue.read()
+				.and_then([this](const auto& entry) noexcept -> None {
+					std::ranges::for_each(
+						m_sinks,
+						[&entry](const auto& sink) noexcept -> void { sink->sink(entry); });
+					return {};
+				})
+				.is_ok();
+		}
+
+		// only called from the consumer thread
+		inline auto service_flush_requests() noexcept -> void {
+			if(!m_flush_requests.pending()) {
+				return;
+			}
+
+			const auto [requested, deadline] = m_flush_requests.take();
+			// drain everything queued before the flush was requested, but no more, so
+			// producers that keep writing can't hold the flush off past its deadline
+			const auto queued = m_queue.size();
+			for(auto drained = 0_usize; drained < queued && detail::FlushClock::now() < deadline;
+				++drained)
+			{
+				if(!try_sink_next()) {
+					break;
+				}
+				// every entry was signalled once when it was pushed, so consume its signal
+				ignore(m_signal.try_acquire());
+			}
+
+			// if a sink couldn't finish in time its requesters have given up, so leave them
+			// uncompleted rather than claim a flush that didn't happen
+			if(detail::flush_sinks(m_sinks, deadline)) {
+				m_flush_requests.complete(requested);
+			}
+		}
+
+#if HYPERION_HAS_JTHREAD
+		inline auto consumer_thread_function(const std::stop_token& token) noexcept -> void {
+			while(!token.stop_requested()) {
+#else
+		inline auto consumer_thread_function() noexcept -> void {
+			while(!m_exit_flag.load()) {
+#endif
+				ignore(try_sink_next());
+				service_flush_requests();
+				m_signal.acquire();
+			}
+			while(try_sink_next()) {
+				// loop until we flush the queue
+			}
+			service_flush_requests();
+		}
+	};
+
+	IGNORE_WEAK_VTABLES_STOP
+	IGNORE_PADDING_STOP
+} // namespace hyperion::logging
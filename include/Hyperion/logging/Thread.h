@@ -0,0 +1,113 @@
+/// @file Thread.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Configuration and placement of logging threads
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Error.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Memory.h>
+#include <Hyperion/Result.h>
+#include <string>
+#include <vector>
+
+namespace hyperion::logging {
+
+	/// @brief Used to configure the scheduling priority of a logging thread
+	///
+	/// - `Default`: The thread keeps the scheduling priority it inherited from the thread that
+	/// created it
+	/// - `Low`: The thread's priority is lowered (on POSIX systems, its nice value is raised), so
+	/// that it yields to other threads when cores are contended
+	/// - `Background`: The thread only runs when a core would otherwise be idle (`SCHED_IDLE` on
+	/// Linux, `THREAD_PRIORITY_IDLE` on Windows). Falls back to `Low` where no such scheduling
+	/// class exists
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Thread.h"
+	enum class ThreadPriority : u8 {
+		Default = 0,
+		Low,
+		Background
+	};
+
+	IGNORE_PADDING_START
+	/// @brief Runtime options controlling the placement of an asynchronous logger's logging thread
+	///
+	/// Asynchronous loggers apply these on their logging thread when it starts, so the logger has
+	/// a predictable footprint that can be kept away from the cores running latency-critical work.
+	/// Each option is applied on a best-effort basis: failing to apply one (e.g. because of
+	/// insufficient permissions) does not prevent the logger from running.
+	///
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Thread.h"
+	struct ThreadOptions {
+		/// @brief The default name given to logging threads
+		static constexpr auto DEFAULT_NAME = "HyperionLogger";
+		/// @brief The maximum length of a thread name, excluding the null terminator. Longer
+		/// names are truncated. This is the limit imposed by Linux
+		static constexpr usize MAX_NAME_LENGTH = 15_usize;
+
+		/// @brief The name to give the thread. An empty name leaves the thread unnamed
+		std::string name = DEFAULT_NAME;
+		/// @brief The logical CPUs to pin the thread to. An empty set leaves the thread free to
+		/// run on any CPU
+		std::vector<usize> cpu_affinity = {};
+		/// @brief The scheduling priority to give the thread
+		ThreadPriority priority = ThreadPriority::Default;
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief Applies the given `ThreadOptions` to the calling thread
+	///
+	/// Every option is attempted, even if applying an earlier one fails.
+	///
+	/// # Errors
+	/// Returns the error from the first option that failed to apply, e.g. if a CPU in
+	/// `cpu_affinity` doesn't exist or the process lacks the permissions to change the thread's
+	/// priority. Options unsupported on the current platform are silently skipped.
+	///
+	/// @param options - The options to apply to the calling thread
+	///
+	/// @return `Ok` if every supported option was applied, otherwise the first error that occurred
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Thread.h"
+	[[nodiscard]] auto
+	set_current_thread_options(const ThreadOptions& options) noexcept -> Result<None>;
+
+	/// @brief Returns the `LargePageOptions` that memory primarily used by a thread configured
+	/// with the given `ThreadOptions` should be allocated with
+	///
+	/// Memory is placed on the NUMA node of the first CPU in `cpu_affinity`, if any. Otherwise it
+	/// is left to the OS's default placement policy.
+	///
+	/// @param options - The options the thread is configured with
+	///
+	/// @return The options to allocate the thread's memory with
+	/// @ingroup logging
+	/// @headerfile "Hyperion/logging/Thread.h"
+	[[nodiscard]] auto
+	large_page_options_for(const ThreadOptions& options) noexcept -> LargePageOptions;
+} // namespace hyperion::logging
@@ -0,0 +1,466 @@
+/// @file ArenaAllocator.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Monotonic arena memory resource and allocators compatible with Hyperion's
+/// allocator-aware containers
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/error/Panic.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/// @ingroup memory
+/// @{
+///	@defgroup ArenaAllocator ArenaAllocator
+/// Hyperion provides a monotonic memory arena, `Arena`, and two allocators backed by it that can
+/// be used anywhere Hyperion takes a `template<typename> typename Allocator` (`RingBuffer`,
+/// `LockFreeQueue`, `SPSCQueue`) or an allocator instance (`allocate_unique`):
+/// - `ArenaAllocator<T>` allocates from a specific `Arena`. When default constructed it binds to
+/// the calling thread's current arena: the innermost active `ArenaScope`, or the thread's own
+/// arena if there is none
+/// - `ThreadLocalArenaAllocator<T>` is stateless and always allocates from the calling thread's
+/// own arena, so it adds no storage to the containers and deleters holding it
+///
+/// Allocation is a pointer bump within the current block, deallocation is (almost always) a
+/// no-op, and memory is reclaimed in bulk with `Arena::reset` or `Arena::release`.
+///
+/// Example:
+/// @code {.cpp}
+/// auto arena = hyperion::Arena();
+/// {
+/// 	const auto scope = hyperion::ArenaScope(arena);
+/// 	// allocates its storage from `arena`
+/// 	auto buffer = hyperion::RingBuffer<i32, hyperion::ArenaAllocator>(64);
+/// 	auto ptr = hyperion::allocate_unique<Request>(hyperion::ArenaAllocator<Request>());
+/// 	handle(ptr, buffer);
+/// }
+/// // all of the request's memory is reclaimed at once
+/// arena.reset();
+/// @endcode
+/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+/// @}
+
+namespace hyperion {
+
+	class ArenaScope;
+
+	IGNORE_PADDING_START
+	/// @brief A monotonic memory arena.
+	///
+	/// `Arena` hands out memory by bumping a cursor through a chunk of memory ("block") that it
+	/// obtained from the global heap. When the current block is exhausted, a new one (twice the
+	/// size of the previous, up to `MAX_BLOCK_SIZE`) is obtained. Individual deallocations don't
+	/// return memory, except that deallocating the most recent allocation rolls the cursor back.
+	/// Instead, all memory is reclaimed at once with `reset` (which keeps the newest block for
+	/// reuse) or `release` (which returns every block to the heap).
+	///
+	/// `Arena` is not synchronized: only one thread may allocate from a given `Arena` at a time.
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+	class Arena {
+	  public:
+		/// The default size of the first block an `Arena` obtains
+		static constexpr usize DEFAULT_BLOCK_SIZE = 64_usize * 1024_usize; // NOLINT
+		/// The size blocks stop growing at. Larger requests still get a block of their own
+		static constexpr usize MAX_BLOCK_SIZE = 4_usize * 1024_usize * 1024_usize; // NOLINT
+
+		/// @brief Constructs an empty `Arena`. No memory is obtained until the first allocation
+		///
+		/// @param initial_block_size - The size of the first block to obtain
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		explicit Arena(usize initial_block_size = DEFAULT_BLOCK_SIZE) noexcept
+			: m_initial_block_size(std::max(initial_block_size, sizeof(Block))),
+			  m_next_block_size(m_initial_block_size) {
+		}
+		Arena(const Arena&) = delete;
+		Arena(Arena&&) = delete;
+		~Arena() noexcept {
+			release();
+		}
+
+		/// @brief Allocates `size` bytes aligned to `alignment`
+		///
+		/// @param size - The number of bytes to allocate
+		/// @param alignment - The alignment of the allocation. Must be a power of two
+		///
+		/// @return The allocated memory
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] inline auto
+		allocate(usize size, usize alignment = alignof(std::max_align_t)) noexcept -> void* {
+			const auto cursor = address(m_cursor);
+			const auto aligned = (cursor + alignment - 1) & ~(alignment - 1);
+			if(aligned + size > address(m_end) || m_cursor == nullptr) {
+				return allocate_from_new_block(size, alignment);
+			}
+
+			m_cursor = pointer(aligned + size);
+			m_allocated += size;
+			return pointer(aligned);
+		}
+
+		/// @brief Deallocates the `size` bytes at `memory`.
+		/// This only reclaims memory if `memory` is the most recent allocation; otherwise the
+		/// memory is reclaimed by the next `reset` or `release`
+		///
+		/// @param memory - The memory to deallocate
+		/// @param size - The size `memory` was allocated with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		inline auto deallocate(void* memory, usize size) noexcept -> void {
+			if(address(memory) + size == address(m_cursor)) {
+				m_cursor = static_cast<std::byte*>(memory);
+				m_allocated -= size;
+			}
+		}
+
+		/// @brief Reclaims all memory allocated from this `Arena`, keeping the most recently
+		/// obtained (and largest) block for reuse and returning the others to the heap.
+		/// @note Everything allocated from this `Arena` must be dead before calling `reset`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		inline auto reset() noexcept -> void {
+			if(m_head == nullptr) {
+				return;
+			}
+
+			free_blocks(m_head->m_previous);
+			m_head->m_previous = nullptr;
+			m_reserved = m_head->m_size;
+			m_cursor = first_byte(m_head);
+			m_allocated = 0_usize;
+		}
+
+		/// @brief Reclaims all memory allocated from this `Arena`, returning every block to the
+		/// heap
+		/// @note Everything allocated from this `Arena` must be dead before calling `release`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		inline auto release() noexcept -> void {
+			free_blocks(m_head);
+			m_head = nullptr;
+			m_cursor = nullptr;
+			m_end = nullptr;
+			m_allocated = 0_usize;
+			m_reserved = 0_usize;
+			m_next_block_size = m_initial_block_size;
+		}
+
+		/// @brief Returns the number of bytes currently allocated from this `Arena`, not
+		/// counting alignment padding
+		///
+		/// @return The number of bytes allocated
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] inline auto allocated() const noexcept -> usize {
+			return m_allocated;
+		}
+
+		/// @brief Returns the total size of the blocks this `Arena` currently holds
+		///
+		/// @return The number of bytes obtained from the heap
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] inline auto reserved() const noexcept -> usize {
+			return m_reserved;
+		}
+
+		/// @brief Returns the calling thread's own `Arena`.
+		/// Its memory is returned to the heap when the thread exits, so nothing allocated from it
+		/// may outlive the thread
+		///
+		/// @return The thread's `Arena`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] static inline auto thread_local_arena() noexcept -> Arena& {
+			thread_local auto arena = Arena();
+			return arena;
+		}
+
+		/// @brief Returns the calling thread's current `Arena`: the `Arena` of the innermost
+		/// active `ArenaScope` on this thread, or `thread_local_arena()` if there is none
+		///
+		/// @return The current `Arena`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] static inline auto current() noexcept -> Arena& {
+			auto* scoped = scoped_arena();
+			return scoped != nullptr ? *scoped : thread_local_arena();
+		}
+
+		auto operator=(const Arena&) -> Arena& = delete;
+		auto operator=(Arena&&) -> Arena& = delete;
+
+	  private:
+		/// @brief The header at the start of every block
+		struct Block {
+			Block* m_previous;
+			usize m_size;
+		};
+
+		std::byte* m_cursor = nullptr;
+		std::byte* m_end = nullptr;
+		Block* m_head = nullptr;
+		usize m_initial_block_size;
+		usize m_next_block_size;
+		usize m_allocated = 0_usize;
+		usize m_reserved = 0_usize;
+
+		friend class ArenaScope;
+
+		[[nodiscard]] static inline auto scoped_arena() noexcept -> Arena*& {
+			thread_local Arena* arena = nullptr;
+			return arena;
+		}
+
+		[[nodiscard]] static inline auto address(const void* memory) noexcept -> std::uintptr_t {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			return reinterpret_cast<std::uintptr_t>(memory);
+		}
+
+		[[nodiscard]] static inline auto pointer(std::uintptr_t memory) noexcept -> std::byte* {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+			return reinterpret_cast<std::byte*>(memory);
+		}
+
+		[[nodiscard]] static inline auto first_byte(Block* block) noexcept -> std::byte* {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			return reinterpret_cast<std::byte*>(block) + sizeof(Block);
+		}
+
+		static inline auto free_blocks(Block* block) noexcept -> void {
+			while(block != nullptr) {
+				auto* previous = block->m_previous;
+				::operator delete(static_cast<void*>(block), block->m_size);
+				block = previous;
+			}
+		}
+
+		/// @brief Obtains a block large enough for the allocation and allocates from it.
+		/// Kept out of line so the bump path in `allocate` stays small enough to inline
+		HYPERION_NOINLINE auto
+		allocate_from_new_block(usize size, usize alignment) noexcept -> void* {
+			if(size > MAX_BLOCK_SIZE * MAX_BLOCK_SIZE) {
+				panic("Arena: allocation of {} bytes is too large", size);
+			}
+
+			const auto block_size = std::max(m_next_block_size, sizeof(Block) + size + alignment);
+			auto* memory = ::operator new(block_size, std::nothrow);
+			if(memory == nullptr) {
+				panic("Arena: failed to obtain a {} byte block", block_size);
+			}
+
+			auto* block = ::new(memory) Block{m_head, block_size};
+			m_head = block;
+			m_cursor = first_byte(block);
+			m_end = static_cast<std::byte*>(memory) + block_size;
+			m_reserved += block_size;
+			m_next_block_size = std::min(m_next_block_size * 2, MAX_BLOCK_SIZE);
+
+			return allocate(size, alignment);
+		}
+	};
+
+	/// @brief Makes an `Arena` the calling thread's current `Arena` for the lifetime of the
+	/// `ArenaScope`. Default constructed `ArenaAllocator`s bind to the current `Arena`.
+	/// Scopes nest; the previous current `Arena` is restored when the `ArenaScope` is destroyed
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+	class [[nodiscard]] ArenaScope {
+	  public:
+		/// @brief Makes `arena` the calling thread's current `Arena`
+		///
+		/// @param arena - The `Arena` to make current
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		explicit ArenaScope(Arena& arena) noexcept
+			: m_previous(std::exchange(Arena::scoped_arena(), &arena)) {
+		}
+		ArenaScope(const ArenaScope&) = delete;
+		ArenaScope(ArenaScope&&) = delete;
+		~ArenaScope() noexcept {
+			Arena::scoped_arena() = m_previous;
+		}
+
+		auto operator=(const ArenaScope&) -> ArenaScope& = delete;
+		auto operator=(ArenaScope&&) -> ArenaScope& = delete;
+
+	  private:
+		Arena* m_previous;
+	};
+
+	/// @brief Allocator allocating from a specific `Arena`.
+	///
+	/// Copies (and rebound copies) of an `ArenaAllocator` allocate from the same `Arena`, and
+	/// compare equal. A default constructed `ArenaAllocator` binds to `Arena::current()`, so
+	/// containers that default construct their allocator (e.g. `RingBuffer`) can be pointed at an
+	/// `Arena` by constructing them inside an `ArenaScope`.
+	///
+	/// @tparam T - The type to allocate
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+	template<typename T>
+	class ArenaAllocator {
+	  public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+		using is_always_equal = std::false_type;
+
+		/// @brief Constructs an `ArenaAllocator` allocating from `Arena::current()`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		ArenaAllocator() noexcept : m_arena(&Arena::current()) {
+		}
+		/// @brief Constructs an `ArenaAllocator` allocating from `arena`
+		///
+		/// @param arena - The `Arena` to allocate from
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		explicit ArenaAllocator(Arena& arena) noexcept : m_arena(&arena) {
+		}
+		/// @brief Constructs an `ArenaAllocator` allocating from the same `Arena` as `allocator`
+		///
+		/// @param allocator - The allocator to share an `Arena` with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		template<typename U>
+		explicit(false) ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept // NOLINT
+			: m_arena(&allocator.arena()) {
+		}
+		ArenaAllocator(const ArenaAllocator&) noexcept = default;
+		ArenaAllocator(ArenaAllocator&&) noexcept = default;
+		~ArenaAllocator() noexcept = default;
+
+		/// @brief Allocates uninitialized storage for `count` `T`s
+		///
+		/// @param count - The number of `T`s to allocate storage for
+		///
+		/// @return The allocated storage
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] inline auto allocate(usize count) noexcept -> T* {
+			if(count > std::numeric_limits<usize>::max() / sizeof(T)) {
+				panic("ArenaAllocator: allocation of {} elements is too large", count);
+			}
+
+			return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/// @brief Deallocates the storage for `count` `T`s at `memory`
+		///
+		/// @param memory - The storage to deallocate
+		/// @param count - The number of `T`s `memory` was allocated for
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		inline auto deallocate(T* memory, usize count) noexcept -> void {
+			m_arena->deallocate(memory, count * sizeof(T));
+		}
+
+		/// @brief Returns the `Arena` this allocates from
+		///
+		/// @return The `Arena`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] inline auto arena() const noexcept -> Arena& {
+			return *m_arena;
+		}
+
+		auto operator=(const ArenaAllocator&) noexcept -> ArenaAllocator& = default;
+		auto operator=(ArenaAllocator&&) noexcept -> ArenaAllocator& = default;
+
+		template<typename U>
+		friend inline auto
+		operator==(const ArenaAllocator& lhs, const ArenaAllocator<U>& rhs) noexcept -> bool {
+			return &lhs.arena() == &rhs.arena();
+		}
+
+	  private:
+		Arena* m_arena;
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief Stateless allocator allocating from the calling thread's own `Arena`
+	/// (`Arena::thread_local_arena()`).
+	///
+	/// Memory may be deallocated from any thread (deallocation is a no-op unless it is the most
+	/// recent allocation of the deallocating thread's `Arena`), but nothing allocated with a
+	/// `ThreadLocalArenaAllocator` may outlive the thread that allocated it, nor survive a `reset`
+	/// or `release` of that thread's `Arena`.
+	///
+	/// @tparam T - The type to allocate
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+	template<typename T>
+	class ThreadLocalArenaAllocator {
+	  public:
+		using value_type = T;
+		using is_always_equal = std::true_type;
+
+		constexpr ThreadLocalArenaAllocator() noexcept = default;
+		template<typename U>
+		// NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+		explicit(false) constexpr ThreadLocalArenaAllocator(
+			[[maybe_unused]] const ThreadLocalArenaAllocator<U>& allocator) noexcept {
+		}
+
+		/// @brief Allocates uninitialized storage for `count` `T`s
+		///
+		/// @param count - The number of `T`s to allocate storage for
+		///
+		/// @return The allocated storage
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		[[nodiscard]] inline auto allocate(usize count) const noexcept -> T* {
+			return ArenaAllocator<T>(Arena::thread_local_arena()).allocate(count);
+		}
+
+		/// @brief Deallocates the storage for `count` `T`s at `memory`
+		///
+		/// @param memory - The storage to deallocate
+		/// @param count - The number of `T`s `memory` was allocated for
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ArenaAllocator.h"
+		inline auto deallocate(T* memory, usize count) const noexcept -> void {
+			Arena::thread_local_arena().deallocate(memory, count * sizeof(T));
+		}
+
+		template<typename U>
+		friend inline constexpr auto
+		operator==([[maybe_unused]] const ThreadLocalArenaAllocator& lhs,
+				   [[maybe_unused]] const ThreadLocalArenaAllocator<U>& rhs) noexcept -> bool {
+			return true;
+		}
+	};
+} // namespace hyperion
@@ -0,0 +1,341 @@
+/// @file LargePageAllocator.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Huge page and NUMA aware allocation for large, long-lived buffers
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/error/Panic.h>
+#include <limits>
+#include <type_traits>
+
+/// @ingroup memory
+/// @{
+///	@defgroup LargePageAllocator LargePageAllocator
+/// Hyperion provides `LargePageAllocator<T>` for large, long-lived buffers, like queue and ring
+/// buffer storage and file buffers. It can be used anywhere Hyperion takes a
+/// `template<typename> typename Allocator` (`RingBuffer`, `LockFreeQueue`, `SPSCQueue`) or an
+/// allocator instance (`allocate_unique`).
+///
+/// Allocations of at least `LargePages::MIN_MAPPED_SIZE` bytes, or any allocation bound to a
+/// NUMA node, are mapped directly from the OS instead of coming from the heap:
+/// - With `HugePages::Transparent` (the default), allocations of at least
+/// `LargePages::HUGE_PAGE_SIZE` are aligned to a huge page boundary and advised to be backed by
+/// transparent huge pages (`madvise(MADV_HUGEPAGE)`)
+/// - With `HugePages::Explicit`, they are first mapped from the reserved huge page pool
+/// (`MAP_HUGETLB`), falling back to transparent huge pages if none are available
+/// - With a `numa_node`, the memory is bound to that node (preferring it, falling back to
+/// others only when it is full), instead of to the node of whichever thread touches it first
+///
+/// The options for default constructed allocators (as created by containers) are set with a
+/// `LargePageScope`.
+///
+/// Huge pages and NUMA binding are only supported on Linux. Other UNIX platforms map large
+/// allocations without them, and other platforms allocate from the heap.
+///
+/// Example:
+/// @code {.cpp}
+/// {
+/// 	// place the buffer on the node the consuming thread runs on
+/// 	const auto scope = hyperion::LargePageScope(
+/// 		{.numa_node = hyperion::LargePages::numa_node_of_cpu(consumer_cpu)});
+/// 	auto buffer = hyperion::RingBuffer<Sample, hyperion::LargePageAllocator>(1'000'000);
+/// }
+/// @endcode
+/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+/// @}
+
+namespace hyperion {
+
+	/// @brief Whether (and how) to back large allocations with huge pages
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+	enum class HugePages : u8 {
+		/// Only use base pages
+		None = 0,
+		/// Advise the OS to back allocations with transparent huge pages
+		Transparent,
+		/// Use the reserved huge page pool, falling back to transparent huge pages
+		Explicit
+	};
+
+	IGNORE_PADDING_START
+	/// @brief Options for allocations made with `LargePages`
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+	struct LargePageOptions {
+		/// Value of `numa_node` for memory that isn't bound to a node
+		static constexpr i32 ANY_NUMA_NODE = -1;
+
+		HugePages huge_pages = HugePages::Transparent;
+		i32 numa_node = ANY_NUMA_NODE;
+
+		friend constexpr auto
+		operator==(const LargePageOptions& lhs, const LargePageOptions& rhs) noexcept -> bool
+			= default;
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief Allocates large buffers directly from the OS, optionally backed by huge pages and
+	/// bound to a NUMA node
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+	class LargePages {
+	  public:
+		/// Allocations smaller than this that aren't bound to a NUMA node come from the heap
+		static constexpr usize MIN_MAPPED_SIZE = 64_usize * 1024_usize; // NOLINT
+		/// The size of a (default sized) huge page
+		static constexpr usize HUGE_PAGE_SIZE = 2_usize * 1024_usize * 1024_usize; // NOLINT
+
+		/// @brief Allocates `size` bytes according to `options`. Mapped allocations are aligned
+		/// to at least the page size
+		///
+		/// @param size - The number of bytes to allocate
+		/// @param options - Huge page and NUMA placement for the allocation
+		///
+		/// @return The allocated memory
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] static auto
+		allocate(usize size, const LargePageOptions& options) noexcept -> void*;
+
+		/// @brief Deallocates the memory at `ptr`
+		///
+		/// @param ptr - The memory to deallocate
+		/// @param size - The size `ptr` was allocated with
+		/// @param options - The options `ptr` was allocated with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		static auto
+		deallocate(void* ptr, usize size, const LargePageOptions& options) noexcept -> void;
+
+		/// @brief Returns whether an allocation of `size` bytes with `options` is mapped from
+		/// the OS (as opposed to coming from the heap)
+		///
+		/// @param size - The allocation size
+		/// @param options - The allocation options
+		///
+		/// @return Whether the allocation is mapped
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] static constexpr auto
+		is_mapped(usize size, const LargePageOptions& options) noexcept -> bool {
+			return size >= MIN_MAPPED_SIZE || options.numa_node != LargePageOptions::ANY_NUMA_NODE;
+		}
+
+		/// @brief Returns the NUMA node the calling thread is currently running on
+		///
+		/// @return The node, or `LargePageOptions::ANY_NUMA_NODE` if it can't be determined
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] static auto current_numa_node() noexcept -> i32;
+
+		/// @brief Returns the NUMA node CPU `cpu` belongs to
+		///
+		/// @param cpu - The index of the CPU
+		///
+		/// @return The node, or `LargePageOptions::ANY_NUMA_NODE` if it can't be determined
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] static auto numa_node_of_cpu(usize cpu) noexcept -> i32;
+
+		/// @brief Returns the options default constructed `LargePageAllocator`s on the calling
+		/// thread use: those of the innermost active `LargePageScope`, or the default options if
+		/// there is none
+		///
+		/// @return The current options
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] static inline auto current_options() noexcept -> const LargePageOptions& {
+			return scoped_options();
+		}
+
+	  private:
+		friend class LargePageScope;
+
+		[[nodiscard]] static inline auto scoped_options() noexcept -> LargePageOptions& {
+			thread_local auto options = LargePageOptions();
+			return options;
+		}
+	};
+
+	/// @brief Sets the options default constructed `LargePageAllocator`s on the calling thread
+	/// use for the lifetime of the `LargePageScope`. Scopes nest; the previous options are
+	/// restored when the `LargePageScope` is destroyed
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+	class [[nodiscard]] LargePageScope {
+	  public:
+		/// @brief Makes `options` the current `LargePageOptions` on this thread
+		///
+		/// @param options - The options to use
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		explicit LargePageScope(const LargePageOptions& options) noexcept
+			: m_previous(LargePages::scoped_options()) {
+			LargePages::scoped_options() = options;
+		}
+		LargePageScope(const LargePageScope&) = delete;
+		LargePageScope(LargePageScope&&) = delete;
+		~LargePageScope() noexcept {
+			LargePages::scoped_options() = m_previous;
+		}
+		auto operator=(const LargePageScope&) -> LargePageScope& = delete;
+		auto operator=(LargePageScope&&) -> LargePageScope& = delete;
+
+	  private:
+		LargePageOptions m_previous;
+	};
+
+	IGNORE_PADDING_START
+	/// @brief Deleter for `UniquePtr<T[]>`s managing arrays allocated with `LargePages`.
+	/// Only deallocates the array; the elements must be trivially destructible
+	///
+	/// @tparam T - The element type of the array
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+	template<typename T>
+	requires std::is_trivially_destructible_v<T>
+	class LargePageDeleter {
+	  public:
+		/// @brief Constructs a `LargePageDeleter` that may only be used with null pointers
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		constexpr LargePageDeleter() noexcept = default;
+		/// @brief Constructs a `LargePageDeleter` for an array of `count` `T`s allocated with
+		/// `options`
+		///
+		/// @param count - The number of elements in the array
+		/// @param options - The options the array was allocated with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		constexpr LargePageDeleter(usize count, const LargePageOptions& options) noexcept
+			: m_count(count), m_options(options) {
+		}
+
+		/// @brief Deallocates the array at `ptr`
+		///
+		/// @param ptr - The array to deallocate
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		inline auto operator()(T* ptr) const noexcept -> void {
+			LargePages::deallocate(ptr, m_count * sizeof(T), m_options);
+		}
+
+	  private:
+		usize m_count = 0_usize;
+		LargePageOptions m_options = LargePageOptions();
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief Allocator for large buffers, backed by `LargePages`
+	///
+	/// @tparam T - The type to allocate
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+	template<typename T>
+	class LargePageAllocator {
+	  public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+		using is_always_equal = std::false_type;
+
+		/// @brief Constructs a `LargePageAllocator` using `LargePages::current_options()`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		LargePageAllocator() noexcept : m_options(LargePages::current_options()) {
+		}
+		/// @brief Constructs a `LargePageAllocator` using `options`
+		///
+		/// @param options - The huge page and NUMA placement to allocate with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		explicit LargePageAllocator(const LargePageOptions& options) noexcept
+			: m_options(options) {
+		}
+		/// @brief Constructs a `LargePageAllocator` using the same options as `allocator`
+		///
+		/// @param allocator - The allocator to copy the options of
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		template<typename U>
+		// NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+		explicit(false) LargePageAllocator(const LargePageAllocator<U>& allocator) noexcept
+			: m_options(allocator.options()) {
+		}
+		LargePageAllocator(const LargePageAllocator&) noexcept = default;
+		LargePageAllocator(LargePageAllocator&&) noexcept = default;
+		~LargePageAllocator() noexcept = default;
+
+		/// @brief Allocates uninitialized storage for `count` `T`s
+		///
+		/// @param count - The number of `T`s to allocate storage for
+		///
+		/// @return The allocated storage
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] inline auto allocate(usize count) const noexcept -> T* {
+			if(count > std::numeric_limits<usize>::max() / sizeof(T)) {
+				panic("LargePageAllocator: allocation of {} elements is too large", count);
+			}
+
+			return static_cast<T*>(LargePages::allocate(count * sizeof(T), m_options));
+		}
+
+		/// @brief Deallocates the storage for `count` `T`s at `memory`
+		///
+		/// @param memory - The storage to deallocate
+		/// @param count - The number of `T`s `memory` was allocated for
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		inline auto deallocate(T* memory, usize count) const noexcept -> void {
+			LargePages::deallocate(memory, count * sizeof(T), m_options);
+		}
+
+		/// @brief Returns the options this allocates with
+		///
+		/// @return The options
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/LargePageAllocator.h"
+		[[nodiscard]] inline auto options() const noexcept -> const LargePageOptions& {
+			return m_options;
+		}
+
+		auto operator=(const LargePageAllocator&) noexcept -> LargePageAllocator& = default;
+		auto operator=(LargePageAllocator&&) noexcept -> LargePageAllocator& = default;
+
+		template<typename U>
+		friend inline auto operator==(const LargePageAllocator& lhs,
+									  const LargePageAllocator<U>& rhs) noexcept -> bool {
+			return lhs.options() == rhs.options();
+		}
+
+	  private:
+		LargePageOptions m_options;
+	};
+} // namespace hyperion
@@ -0,0 +1,319 @@
+/// @file ObjectPool.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Fixed-capacity object pool with a lock-free free list, handing out `UniquePtr`s that
+/// return their slot to the pool
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Platform.h>
+#include <Hyperion/memory/UniquePtr.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+/// @ingroup memory
+/// @{
+///	@defgroup ObjectPool ObjectPool
+/// Hyperion provides `ObjectPool<T>`, a fixed-capacity slab of slots for `T`s that recycles
+/// memory without touching the allocator. Objects are created with `ObjectPool::make`, which
+/// returns a `PooledPtr<T>` (a `UniquePtr<T, PoolDeleter<T>>`) that returns its slot to the pool
+/// instead of `delete`ing it.
+///
+/// Example:
+/// @code {.cpp}
+/// auto pool = hyperion::ObjectPool<Request>(1024);
+/// if(auto request = pool.make(connection_id); request != nullptr) {
+/// 	handle(std::move(request));
+/// }
+/// @endcode
+/// @headerfile "Hyperion/memory/ObjectPool.h"
+/// @}
+
+namespace hyperion {
+
+	template<typename T>
+	class ObjectPool;
+
+	/// @brief Deleter for `UniquePtr`s handed out by an `ObjectPool`.
+	/// Destroys the managed object and returns its slot to the pool
+	///
+	/// @tparam T - The type of the pooled objects
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ObjectPool.h"
+	template<typename T>
+	class PoolDeleter {
+	  public:
+		/// @brief Constructs a `PoolDeleter` not associated with any pool.
+		/// It may only be used with null pointers
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		constexpr PoolDeleter() noexcept = default;
+		/// @brief Constructs a `PoolDeleter` returning objects to `pool`
+		///
+		/// @param pool - The pool the managed objects were created from
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		explicit constexpr PoolDeleter(ObjectPool<T>& pool) noexcept : m_pool(&pool) {
+		}
+
+		/// @brief Destroys the object at `ptr` and returns its slot to the pool.
+		/// Does nothing if `ptr` is null
+		///
+		/// @param ptr - The object to destroy
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		inline auto operator()(T* ptr) const noexcept -> void {
+			if(ptr != nullptr) {
+				m_pool->destroy(ptr);
+			}
+		}
+
+		/// @brief Returns the pool this returns objects to
+		///
+		/// @return The pool, or `nullptr` if this isn't associated with one
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		[[nodiscard]] constexpr auto pool() const noexcept -> ObjectPool<T>* {
+			return m_pool;
+		}
+
+	  private:
+		ObjectPool<T>* m_pool = nullptr;
+	};
+
+	/// @brief An owning pointer to an object created by an `ObjectPool<T>`
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ObjectPool.h"
+	template<typename T>
+	using PooledPtr = UniquePtr<T, PoolDeleter<T>>;
+
+	IGNORE_PADDING_START
+	/// @brief A fixed-capacity pool of slots for `T`s.
+	///
+	/// All slots are allocated up front in one slab. Free slots are kept on a lock-free
+	/// (Treiber) stack, so any number of threads may create objects from and return objects to
+	/// the pool concurrently; each is a single compare-exchange on the stack head. The head packs
+	/// the index of the top slot with a counter that changes on every push and pop, so a thread
+	/// that was preempted mid-pop can't mistake a slot that was popped and pushed back in the
+	/// meantime for the one it saw (the ABA problem).
+	///
+	/// The pool must outlive every object created from it.
+	///
+	/// @tparam T - The type of the pooled objects
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ObjectPool.h"
+	template<typename T>
+	class ObjectPool {
+		/// @brief Storage for one object, and the link to the next free slot while this one is
+		/// free. The link is kept outside the object's storage so that reading it from a stale
+		/// stack head never races with an object being constructed in the slot
+		struct Slot {
+			Slot() noexcept : m_empty() {
+			}
+			Slot(const Slot&) = delete;
+			Slot(Slot&&) = delete;
+			// NOLINTNEXTLINE(modernize-use-equals-default)
+			~Slot() noexcept {
+			}
+			auto operator=(const Slot&) -> Slot& = delete;
+			auto operator=(Slot&&) -> Slot& = delete;
+
+			struct Empty { };
+			union {
+				Empty m_empty;
+				T m_value;
+			};
+			std::atomic<u32> m_next = NIL;
+		};
+
+		static constexpr u32 NIL = std::numeric_limits<u32>::max();
+		using allocator_traits = std::allocator_traits<std::allocator<Slot>>;
+
+	  public:
+		/// @brief Constructs an `ObjectPool` with room for `capacity` objects
+		///
+		/// @param capacity - The number of objects the pool can hold at once. Must be less than
+		/// `2^32 - 1`
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		explicit ObjectPool(usize capacity) noexcept
+			: m_capacity(static_cast<u32>(std::min(capacity, static_cast<usize>(NIL - 1)))),
+			  m_slots(allocator_traits::allocate(m_allocator, m_capacity)) {
+			for(auto index = 0_u32; index < m_capacity; ++index) {
+				auto* slot = std::construct_at(slot_at(index));
+				slot->m_next.store(index + 1 < m_capacity ? index + 1 : NIL,
+								   std::memory_order_relaxed);
+			}
+			m_head.store(pack(0_u32, m_capacity == 0 ? NIL : 0_u32), std::memory_order_release);
+		}
+		ObjectPool(const ObjectPool&) = delete;
+		ObjectPool(ObjectPool&&) = delete;
+		~ObjectPool() noexcept {
+			for(auto index = 0_u32; index < m_capacity; ++index) {
+				std::destroy_at(slot_at(index));
+			}
+			allocator_traits::deallocate(m_allocator, m_slots, m_capacity);
+		}
+
+		/// @brief Creates a `T` from `args` in a free slot
+		///
+		/// @param args - The arguments to construct the `T` from
+		///
+		/// @return The created object, or a null `PooledPtr` if every slot is in use
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		template<typename... Args>
+		requires concepts::NoexceptConstructibleFrom<T, Args...>
+		[[nodiscard]] inline auto make(Args&&... args) noexcept -> PooledPtr<T> {
+			auto* memory = allocate();
+			if(memory == nullptr) {
+				return PooledPtr<T>(nullptr, PoolDeleter<T>(*this));
+			}
+
+			return PooledPtr<T>(std::construct_at(memory, std::forward<Args>(args)...),
+								PoolDeleter<T>(*this));
+		}
+
+		/// @brief Takes a free slot from the pool, without constructing anything in it
+		///
+		/// @return Uninitialized storage for a `T`, or `nullptr` if every slot is in use
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		[[nodiscard]] inline auto allocate() noexcept -> T* {
+			auto head = m_head.load(std::memory_order_acquire);
+			while(true) {
+				const auto index = index_of(head);
+				if(index == NIL) {
+					return nullptr;
+				}
+
+				const auto next = slot_at(index)->m_next.load(std::memory_order_relaxed);
+				if(m_head.compare_exchange_weak(head,
+												pack(tag_of(head) + 1, next),
+												std::memory_order_acquire,
+												std::memory_order_acquire))
+				{
+					return std::addressof(slot_at(index)->m_value);
+				}
+			}
+		}
+
+		/// @brief Returns the slot at `ptr`, which must have come from `allocate` and must not
+		/// hold a live object, to the pool
+		///
+		/// @param ptr - The slot to return
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		inline auto deallocate(T* ptr) noexcept -> void {
+			const auto index = index_of(ptr);
+			auto* slot = slot_at(index);
+			auto head = m_head.load(std::memory_order_relaxed);
+			do {
+				slot->m_next.store(index_of(head), std::memory_order_relaxed);
+			} while(!m_head.compare_exchange_weak(head,
+												  pack(tag_of(head) + 1, index),
+												  std::memory_order_release,
+												  std::memory_order_relaxed));
+		}
+
+		/// @brief Destroys the object at `ptr`, which must have been created from this pool, and
+		/// returns its slot to the pool
+		///
+		/// @param ptr - The object to destroy
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		inline auto destroy(T* ptr) noexcept -> void {
+			std::destroy_at(ptr);
+			deallocate(ptr);
+		}
+
+		/// @brief Returns whether `ptr` points into this pool's slots
+		///
+		/// @param ptr - The pointer to check
+		///
+		/// @return `true` if `ptr` is a slot of this pool, `false` otherwise
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		[[nodiscard]] inline auto owns(const T* ptr) const noexcept -> bool {
+			const auto offset = address(ptr) - address(std::to_address(m_slots));
+			// an address below the slab wraps around to a huge offset
+			return offset < static_cast<usize>(m_capacity) * sizeof(Slot)
+				   && offset % sizeof(Slot) == 0;
+		}
+
+		/// @brief Returns the number of objects the pool can hold at once
+		///
+		/// @return The capacity
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ObjectPool.h"
+		[[nodiscard]] inline auto capacity() const noexcept -> usize {
+			return m_capacity;
+		}
+
+		auto operator=(const ObjectPool&) -> ObjectPool& = delete;
+		auto operator=(ObjectPool&&) -> ObjectPool& = delete;
+
+	  private:
+		[[HYPERION_NO_UNIQUE_ADDRESS]] std::allocator<Slot> m_allocator = std::allocator<Slot>();
+		u32 m_capacity;
+		typename allocator_traits::pointer m_slots;
+		// the index of the top free slot in the low 32 bits, and the ABA tag in the high 32 bits
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<u64> m_head = 0_u64;
+
+		[[nodiscard]] static constexpr auto pack(u32 tag, u32 index) noexcept -> u64 {
+			return (static_cast<u64>(tag) << 32U) | index;
+		}
+
+		[[nodiscard]] static constexpr auto index_of(u64 head) noexcept -> u32 {
+			return static_cast<u32>(head);
+		}
+
+		[[nodiscard]] static constexpr auto tag_of(u64 head) noexcept -> u32 {
+			return static_cast<u32>(head >> 32U);
+		}
+
+		[[nodiscard]] inline auto slot_at(u32 index) const noexcept -> Slot* {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			return std::to_address(m_slots) + index;
+		}
+
+		[[nodiscard]] inline auto index_of(const T* ptr) const noexcept -> u32 {
+			// `m_value` lives at the start of its `Slot`
+			const auto offset = address(ptr) - address(std::to_address(m_slots));
+			return static_cast<u32>(offset / sizeof(Slot));
+		}
+
+		[[nodiscard]] static inline auto address(const void* ptr) noexcept -> std::uintptr_t {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			return reinterpret_cast<std::uintptr_t>(ptr);
+		}
+	};
+	IGNORE_PADDING_STOP
+} // namespace hyperion
@@ -0,0 +1,557 @@
+/// @file ThreadCachingAllocator.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Size-class allocator with per-thread caches, for small objects that are freed on a
+/// different thread than the one that allocated them
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Platform.h>
+#include <Hyperion/error/Panic.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+/// @ingroup memory
+/// @{
+///	@defgroup ThreadCachingAllocator ThreadCachingAllocator
+/// Hyperion provides `ThreadCachingAllocator<T>`, a stateless allocator for small objects that
+/// are commonly allocated on one thread and freed on another, like log entries handed from
+/// producer threads to the logging thread.
+///
+/// Small allocations (up to `ThreadCache::MAX_BLOCK_SIZE` bytes) are rounded up to one of a
+/// fixed set of size classes and served from the calling thread's `ThreadCache` without any
+/// synchronization. A block freed on the thread that allocated it goes straight back onto that
+/// thread's free list; a block freed on any other thread is pushed onto the owning cache's
+/// remote-free list with a single atomic operation, and the owner reclaims all of its remote
+/// frees at once the next time it runs out of blocks of some size. Larger or over-aligned
+/// allocations go to the global heap.
+///
+/// Example:
+/// @code {.cpp}
+/// using String = std::basic_string<char,
+/// 								 std::char_traits<char>,
+/// 								 hyperion::ThreadCachingAllocator<char>>;
+/// // allocated here, freed on whichever thread consumes the queue
+/// queue.push_back(String("a message long enough to need the heap"));
+/// @endcode
+/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+/// @}
+
+namespace hyperion {
+
+	namespace detail::thread_caching {
+		/// @brief The block sizes small allocations are rounded up to. Spaced by 16 bytes up to
+		/// 128, then by four steps per power of two, so no more than 25% of a block is wasted
+		static constexpr std::array<usize, 20_usize> SIZE_CLASSES // NOLINT
+			= {16_usize,  32_usize,  48_usize,  64_usize,  80_usize,  96_usize,  112_usize,
+			   128_usize, 160_usize, 192_usize, 224_usize, 256_usize, 320_usize, 384_usize,
+			   448_usize, 512_usize, 640_usize, 768_usize, 896_usize, 1024_usize};
+
+		static constexpr usize SIZE_CLASS_GRANULARITY = 16_usize;
+
+		/// @brief Maps `(size + 15) / 16` to the index of the smallest size class that fits
+		static constexpr auto SIZE_CLASS_LOOKUP = []() noexcept {
+			constexpr auto num_entries = SIZE_CLASSES.back() / SIZE_CLASS_GRANULARITY + 1_usize;
+			auto lookup = std::array<u8, num_entries>();
+			auto size_class = 0_usize;
+			for(auto index = 0_usize; index < num_entries; ++index) {
+				while(SIZE_CLASSES.at(size_class) < index * SIZE_CLASS_GRANULARITY) {
+					++size_class;
+				}
+				lookup.at(index) = static_cast<u8>(size_class);
+			}
+			return lookup;
+		}();
+	} // namespace detail::thread_caching
+
+	IGNORE_PADDING_START
+	/// @brief A cache of small blocks, owned by (at most) one thread at a time.
+	///
+	/// Blocks are carved from 64KiB `SPAN_SIZE`-aligned spans, each dedicated to one size class
+	/// and headed by a pointer to the cache that carved it, so the owner and size of any block
+	/// can be found from its address alone. Freed blocks are kept on intrusive per-size-class
+	/// free lists. Blocks freed by other threads are collected on a lock-free remote-free list
+	/// and moved to the local free lists in bulk when the owner runs out of blocks of the size it
+	/// needs.
+	///
+	/// Spans are only returned to the heap when the `ThreadCache` is destroyed, so the memory
+	/// held by a cache is bounded by the peak number of live blocks of each size.
+	///
+	/// Most code shouldn't use `ThreadCache` directly, but go through `ThreadCachingAllocator`
+	/// or `ThreadCachingHeap`, which route each thread to its own cache. The caches of exited
+	/// threads are handed to new threads, so blocks still in use when a thread exits are
+	/// returned to (and reused from) its cache.
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+	class ThreadCache {
+	  public:
+		/// The alignment of every block
+		static constexpr usize BLOCK_ALIGNMENT = detail::thread_caching::SIZE_CLASS_GRANULARITY;
+		/// The largest allocation served from a size class
+		static constexpr usize MAX_BLOCK_SIZE = detail::thread_caching::SIZE_CLASSES.back();
+		/// The number of size classes
+		static constexpr usize NUM_SIZE_CLASSES = detail::thread_caching::SIZE_CLASSES.size();
+		/// The size (and alignment) of the spans blocks are carved from
+		static constexpr usize SPAN_SIZE = 64_usize * 1024_usize; // NOLINT
+
+		/// @brief Constructs an empty `ThreadCache`. No memory is obtained until the first
+		/// allocation
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		ThreadCache() noexcept = default;
+		ThreadCache(const ThreadCache&) = delete;
+		ThreadCache(ThreadCache&&) = delete;
+		/// @brief Returns every span to the heap.
+		/// @note Every block allocated from this cache must have been freed
+		~ThreadCache() noexcept {
+			auto* span = m_spans;
+			while(span != nullptr) {
+				auto* next = span->m_next;
+				::operator delete(static_cast<void*>(span), std::align_val_t{SPAN_SIZE});
+				span = next;
+			}
+		}
+
+		/// @brief Returns the index of the size class allocations of `size` bytes are served
+		/// from
+		///
+		/// @param size - The allocation size. Must be at most `MAX_BLOCK_SIZE`
+		///
+		/// @return The size class index
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] static constexpr auto size_class_of(usize size) noexcept -> usize {
+			constexpr auto granularity = detail::thread_caching::SIZE_CLASS_GRANULARITY;
+			const auto index = (size + granularity - 1) / granularity;
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			return detail::thread_caching::SIZE_CLASS_LOOKUP[index];
+		}
+
+		/// @brief Returns the block size of the size class at `size_class`
+		///
+		/// @param size_class - The size class index. Must be less than `NUM_SIZE_CLASSES`
+		///
+		/// @return The size of the blocks in the size class
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] static constexpr auto class_size(usize size_class) noexcept -> usize {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			return detail::thread_caching::SIZE_CLASSES[size_class];
+		}
+
+		/// @brief Allocates a block of at least `size` bytes, aligned to `BLOCK_ALIGNMENT`.
+		/// Must only be called by the thread currently owning this cache
+		///
+		/// @param size - The number of bytes to allocate. Must be at most `MAX_BLOCK_SIZE`
+		///
+		/// @return The allocated block
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] inline auto allocate(usize size) noexcept -> void* {
+			const auto size_class = size_class_of(size);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			auto*& head = m_free_lists[size_class];
+			if(head != nullptr) [[likely]] {
+				auto* block = head;
+				head = block->m_next;
+				return block;
+			}
+
+			return allocate_slow(size_class);
+		}
+
+		/// @brief Returns the block at `ptr`, allocated from this cache with `size` bytes, to
+		/// this cache. Must only be called by the thread currently owning this cache; other
+		/// threads must use `deallocate_remote`
+		///
+		/// @param ptr - The block to free
+		/// @param size - The size the block was allocated with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		inline auto deallocate(void* ptr, usize size) noexcept -> void {
+			push_local(ptr, size_class_of(size));
+		}
+
+		/// @brief Returns the block at `ptr` to the remote-free list of the cache it was
+		/// allocated from. May be called from any thread
+		///
+		/// @param ptr - The block to free
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		static inline auto deallocate_remote(void* ptr) noexcept -> void {
+			auto& remote_frees = span_of(ptr)->m_owner->m_remote_frees;
+			auto* block = ::new(ptr) FreeBlock{remote_frees.load(std::memory_order_relaxed)};
+			while(!remote_frees.compare_exchange_weak(block->m_next,
+													  block,
+													  std::memory_order_release,
+													  std::memory_order_relaxed))
+			{
+			}
+		}
+
+		/// @brief Returns the cache the block at `ptr` was allocated from
+		///
+		/// @param ptr - A block allocated from a `ThreadCache`
+		///
+		/// @return The owning cache
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] static inline auto owner_of(const void* ptr) noexcept -> ThreadCache* {
+			return span_of(ptr)->m_owner;
+		}
+
+		auto operator=(const ThreadCache&) -> ThreadCache& = delete;
+		auto operator=(ThreadCache&&) -> ThreadCache& = delete;
+
+	  private:
+		/// @brief The link stored in a free block
+		struct FreeBlock {
+			FreeBlock* m_next;
+		};
+
+		/// @brief The header at the start of every span
+		struct Span {
+			ThreadCache* m_owner;
+			Span* m_next;
+			usize m_size_class;
+		};
+
+		/// @brief The not-yet-carved remainder of the newest span of a size class
+		struct Bump {
+			std::byte* m_cursor = nullptr;
+			std::byte* m_end = nullptr;
+		};
+
+		static constexpr usize FIRST_BLOCK_OFFSET
+			= (sizeof(Span) + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+
+		std::array<FreeBlock*, NUM_SIZE_CLASSES> m_free_lists = {};
+		std::array<Bump, NUM_SIZE_CLASSES> m_bumps = {};
+		Span* m_spans = nullptr;
+		// links abandoned caches together in `ThreadCachingHeap`'s registry
+		ThreadCache* m_next_abandoned = nullptr;
+		// kept on its own cache line, since every other thread writes to it
+		alignas(HYPERION_PLATFORM_CACHE_LINE_SIZE) std::atomic<FreeBlock*> m_remote_frees
+			= nullptr;
+
+		friend class ThreadCachingHeap;
+
+		[[nodiscard]] static inline auto span_of(const void* ptr) noexcept -> Span* {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			const auto address = reinterpret_cast<std::uintptr_t>(ptr);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast,performance-no-int-to-ptr)
+			return reinterpret_cast<Span*>(address & ~(SPAN_SIZE - 1));
+		}
+
+		inline auto push_local(void* ptr, usize size_class) noexcept -> void {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			auto*& head = m_free_lists[size_class];
+			head = ::new(ptr) FreeBlock{head};
+		}
+
+		/// @brief Reclaims remote frees, then carves a new block if there still isn't a free
+		/// one. Kept out of line so the free-list pop in `allocate` stays small enough to inline
+		HYPERION_NOINLINE auto allocate_slow(usize size_class) noexcept -> void* {
+			auto* remote = m_remote_frees.exchange(nullptr, std::memory_order_acquire);
+			while(remote != nullptr) {
+				auto* next = remote->m_next;
+				push_local(remote, span_of(remote)->m_size_class);
+				remote = next;
+			}
+
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			auto*& head = m_free_lists[size_class];
+			if(head != nullptr) {
+				auto* block = head;
+				head = block->m_next;
+				return block;
+			}
+
+			const auto size = class_size(size_class);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			auto& bump = m_bumps[size_class];
+			if(bump.m_cursor == nullptr
+			   || static_cast<usize>(bump.m_end - bump.m_cursor) < size) {
+				carve_new_span(size_class);
+			}
+
+			auto* block = bump.m_cursor;
+			bump.m_cursor += size;
+			return block;
+		}
+
+		inline auto carve_new_span(usize size_class) noexcept -> void {
+			auto* memory = ::operator new(SPAN_SIZE, std::align_val_t{SPAN_SIZE}, std::nothrow);
+			if(memory == nullptr) {
+				panic("ThreadCache: failed to obtain a {} byte span", SPAN_SIZE);
+			}
+
+			m_spans = ::new(memory) Span{this, m_spans, size_class};
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+			auto& bump = m_bumps[size_class];
+			bump.m_cursor = static_cast<std::byte*>(memory) + FIRST_BLOCK_OFFSET;
+			bump.m_end = static_cast<std::byte*>(memory) + SPAN_SIZE;
+		}
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief Routes allocations to the calling thread's `ThreadCache`.
+	///
+	/// Each thread is given a `ThreadCache` the first time it allocates. When the thread exits,
+	/// its cache is abandoned and handed to the next thread that needs one, so blocks freed
+	/// after their allocating thread exited are not lost. Allocations larger than
+	/// `ThreadCache::MAX_BLOCK_SIZE` or aligned more strictly than
+	/// `ThreadCache::BLOCK_ALIGNMENT` go to the global heap.
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+	class ThreadCachingHeap {
+	  public:
+		/// @brief Allocates `size` bytes aligned to `alignment`
+		///
+		/// @param size - The number of bytes to allocate
+		/// @param alignment - The alignment of the allocation. Must be a power of two
+		///
+		/// @return The allocated memory
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] static inline auto
+		allocate(usize size, usize alignment = alignof(std::max_align_t)) noexcept -> void* {
+			if(is_small(size, alignment)) [[likely]] {
+				auto* cache = current_cache();
+				if(cache != nullptr) [[likely]] {
+					return cache->allocate(size);
+				}
+
+				return allocate_without_cache(size);
+			}
+
+			auto* memory = alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__
+							   ? ::operator new(size, std::align_val_t{alignment}, std::nothrow)
+							   : ::operator new(size, std::nothrow);
+			if(memory == nullptr) {
+				panic("ThreadCachingHeap: failed to allocate {} bytes", size);
+			}
+			return memory;
+		}
+
+		/// @brief Deallocates the memory at `ptr`. May be called from any thread
+		///
+		/// @param ptr - The memory to deallocate
+		/// @param size - The size `ptr` was allocated with
+		/// @param alignment - The alignment `ptr` was allocated with
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		static inline auto deallocate(void* ptr,
+									  usize size,
+									  usize alignment = alignof(std::max_align_t)) noexcept
+			-> void {
+			if(ptr == nullptr) {
+				return;
+			}
+
+			if(is_small(size, alignment)) [[likely]] {
+				auto* cache = current_cache();
+				if(cache != nullptr && ThreadCache::owner_of(ptr) == cache) [[likely]] {
+					cache->deallocate(ptr, size);
+				}
+				else {
+					ThreadCache::deallocate_remote(ptr);
+				}
+			}
+			else if(alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+				::operator delete(ptr, size, std::align_val_t{alignment});
+			}
+			else {
+				::operator delete(ptr, size);
+			}
+		}
+
+		/// @brief Returns whether an allocation of `size` bytes aligned to `alignment` is served
+		/// from a `ThreadCache`
+		///
+		/// @param size - The allocation size
+		/// @param alignment - The allocation alignment
+		///
+		/// @return `true` if the allocation is served from a `ThreadCache`, `false` if it goes
+		/// to the global heap
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] static constexpr auto is_small(usize size, usize alignment) noexcept -> bool {
+			return size <= ThreadCache::MAX_BLOCK_SIZE && alignment <= ThreadCache::BLOCK_ALIGNMENT;
+		}
+
+		/// @brief Returns the calling thread's `ThreadCache`
+		///
+		/// @return The thread's cache, or `nullptr` if it hasn't allocated yet or is exiting
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] static inline auto current_cache() noexcept -> ThreadCache*& {
+			thread_local ThreadCache* cache = nullptr;
+			return cache;
+		}
+
+	  private:
+		/// @brief Gives the calling thread a cache for its lifetime, and abandons the cache when
+		/// the thread exits
+		class LocalCache {
+		  public:
+			LocalCache() noexcept : m_cache(acquire()) {
+				current_cache() = m_cache;
+			}
+			LocalCache(const LocalCache&) = delete;
+			LocalCache(LocalCache&&) = delete;
+			~LocalCache() noexcept {
+				current_cache() = nullptr;
+				exiting() = true;
+				abandon(m_cache);
+			}
+			auto operator=(const LocalCache&) -> LocalCache& = delete;
+			auto operator=(LocalCache&&) -> LocalCache& = delete;
+
+		  private:
+			ThreadCache* m_cache;
+		};
+
+		/// @brief The caches of exited threads, waiting to be handed to new ones
+		struct Registry {
+			std::mutex m_mutex;
+			ThreadCache* m_abandoned = nullptr;
+		};
+
+		[[nodiscard]] static inline auto registry() noexcept -> Registry& {
+			// never destroyed, so threads exiting after static destruction can still abandon
+			// their caches
+			static auto* instance = new Registry(); // NOLINT(cppcoreguidelines-owning-memory)
+			return *instance;
+		}
+
+		[[nodiscard]] static inline auto exiting() noexcept -> bool& {
+			thread_local auto is_exiting = false;
+			return is_exiting;
+		}
+
+		[[nodiscard]] static inline auto acquire() noexcept -> ThreadCache* {
+			auto& registry = ThreadCachingHeap::registry();
+			{
+				const auto lock = std::scoped_lock(registry.m_mutex);
+				if(auto* cache = registry.m_abandoned; cache != nullptr) {
+					registry.m_abandoned = cache->m_next_abandoned;
+					cache->m_next_abandoned = nullptr;
+					return cache;
+				}
+			}
+
+			// caches are never destroyed, since blocks allocated from them may outlive any
+			// thread
+			// NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+			auto* cache = new(std::nothrow) ThreadCache();
+			if(cache == nullptr) {
+				panic("ThreadCachingHeap: failed to allocate a ThreadCache");
+			}
+			return cache;
+		}
+
+		static inline auto abandon(ThreadCache* cache) noexcept -> void {
+			auto& registry = ThreadCachingHeap::registry();
+			const auto lock = std::scoped_lock(registry.m_mutex);
+			cache->m_next_abandoned = registry.m_abandoned;
+			registry.m_abandoned = cache;
+		}
+
+		/// @brief Allocates for a thread without a cache: gives the thread its cache if it
+		/// hasn't allocated yet, or borrows an abandoned one if the thread is exiting
+		HYPERION_NOINLINE static auto allocate_without_cache(usize size) noexcept -> void* {
+			if(!exiting()) {
+				thread_local auto local_cache = LocalCache();
+				return current_cache()->allocate(size);
+			}
+
+			auto* cache = acquire();
+			auto* memory = cache->allocate(size);
+			abandon(cache);
+			return memory;
+		}
+	};
+
+	/// @brief Stateless allocator backed by `ThreadCachingHeap`: small allocations come from the
+	/// calling thread's `ThreadCache`, and may be freed from any thread.
+	///
+	/// @tparam T - The type to allocate
+	/// @ingroup memory
+	/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+	template<typename T>
+	class ThreadCachingAllocator {
+	  public:
+		using value_type = T;
+		using is_always_equal = std::true_type;
+
+		constexpr ThreadCachingAllocator() noexcept = default;
+		template<typename U>
+		// NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+		explicit(false) constexpr ThreadCachingAllocator(
+			[[maybe_unused]] const ThreadCachingAllocator<U>& allocator) noexcept {
+		}
+
+		/// @brief Allocates uninitialized storage for `count` `T`s
+		///
+		/// @param count - The number of `T`s to allocate storage for
+		///
+		/// @return The allocated storage
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		[[nodiscard]] inline auto allocate(usize count) const noexcept -> T* {
+			if(count > std::numeric_limits<usize>::max() / sizeof(T)) {
+				panic("ThreadCachingAllocator: allocation of {} elements is too large", count);
+			}
+
+			return static_cast<T*>(ThreadCachingHeap::allocate(count * sizeof(T), alignof(T)));
+		}
+
+		/// @brief Deallocates the storage for `count` `T`s at `memory`. May be called from any
+		/// thread
+		///
+		/// @param memory - The storage to deallocate
+		/// @param count - The number of `T`s `memory` was allocated for
+		/// @ingroup memory
+		/// @headerfile "Hyperion/memory/ThreadCachingAllocator.h"
+		inline auto deallocate(T* memory, usize count) const noexcept -> void {
+			ThreadCachingHeap::deallocate(memory, count * sizeof(T), alignof(T));
+		}
+
+		template<typename U>
+		friend inline constexpr auto
+		operator==([[maybe_unused]] const ThreadCachingAllocator& lhs,
+				   [[maybe_unused]] const ThreadCachingAllocator<U>& rhs) noexcept -> bool {
+			return true;
+		}
+	};
+} // namespace hyperion
@@ -30,6 +30,7 @@
 #include <Hyperion/Concepts.h>
 #include <Hyperion/HyperionDef.h>
 #include <Hyperion/memory/CompressedPair.h>
+#include <Hyperion/option/Niche.h>
 #include <gsl/gsl>
 
 /// @ingroup memory
@@ -865,6 +866,26 @@ namespace hyperion {
 	swap(UniquePtr<T, Deleter>& first, UniquePtr<T, Deleter>& second) noexcept -> void {
 		first.swap(second);
 	}
+
+	/// @brief `UniquePtr`s use a `UniquePtr` managing no pointer as their `option::Niche`, so
+	/// `Option<UniquePtr<T, Deleter>>` is the same size as `UniquePtr<T, Deleter>`
+	///
+	/// @note This means an `Option` holding an empty `UniquePtr` is `None`
+	/// @ingroup UniquePtr
+	template<typename T, typename Deleter>
+	requires concepts::NoexceptDefaultConstructible<Deleter> && concepts::NotPointer<Deleter>
+	struct option::Niche<UniquePtr<T, Deleter>> {
+		static constexpr bool has_niche = true;
+
+		[[nodiscard]] static inline constexpr auto none() noexcept -> UniquePtr<T, Deleter> {
+			return {};
+		}
+
+		[[nodiscard]] static inline constexpr auto
+		is_none(const UniquePtr<T, Deleter>& value) noexcept -> bool {
+			return value.get() == nullptr;
+		}
+	};
 	// clang-format off
 
 	IGNORE_UNUSED_TEMPLATES_START
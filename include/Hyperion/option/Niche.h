@@ -0,0 +1,75 @@
+/// @file Niche.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Customization point for types with an invalid bit pattern `Option` can use as `None`
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/Concepts.h>
+
+namespace hyperion::option {
+
+	/// @brief `Niche` describes a "niche" of `T`: a value `T` can hold that is never a valid
+	/// `Some` value, and that `Option<T>` can therefore use to represent `None`.
+	///
+	/// Types with a niche are stored in an `Option` without a separate discriminator, making
+	/// `Option<T>` the same size as `T`, (and trivially copyable if `T` is).
+	/// Specializations must provide `static constexpr bool has_niche = true`, a
+	/// `static constexpr auto none() noexcept -> T` returning the niche value, and a
+	/// `static constexpr auto is_none(const T&) noexcept -> bool` checking for it.
+	///
+	/// @note Because the niche value __is__ `None`, storing the niche value in an `Option`
+	/// produces `None`. E.G. `Option<T*>(nullptr)` and `Option<UniquePtr<T>>(UniquePtr<T>())`
+	/// are both `None`.
+	///
+	/// @tparam T - The type to describe the niche of
+	/// @ingroup option
+	/// @headerfile "Hyperion/option/Niche.h"
+	template<typename T>
+	struct Niche {
+		static constexpr bool has_niche = false;
+	};
+
+	/// @brief Raw pointers use `nullptr` as their niche
+	/// @ingroup option
+	/// @headerfile "Hyperion/option/Niche.h"
+	template<concepts::Pointer T>
+	struct Niche<T> {
+		static constexpr bool has_niche = true;
+
+		[[nodiscard]] static inline constexpr auto none() noexcept -> T {
+			return nullptr;
+		}
+
+		[[nodiscard]] static inline constexpr auto is_none(const T& value) noexcept -> bool {
+			return value == nullptr;
+		}
+	};
+
+	/// @brief Concept that requires that `T` has a niche `Option` can use to represent `None`
+	/// @ingroup option
+	/// @headerfile "Hyperion/option/Niche.h"
+	template<typename T>
+	concept HasNiche = Niche<T>::has_niche;
+} // namespace hyperion::option
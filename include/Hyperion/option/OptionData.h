@@ -28,15 +28,19 @@
 
 #include <Hyperion/Concepts.h>
 #include <Hyperion/HyperionDef.h>
+#include <Hyperion/option/Niche.h>
 #include <Hyperion/option/None.h>
-#include <functional>
+#include <memory>
 
 namespace hyperion::option {
 	IGNORE_PADDING_START
 
 	/// @brief `OptionData` is the storage implementation backing `Option`
 	/// It acts as a tagged union, supports references (unlike `std::optional`), and abstracts away
-	/// the storage details of `Option`'s implementation
+	/// the storage details of `Option`'s implementation.
+	///
+	/// References, and types with a `Niche`, are stored without a separate discriminator, and
+	/// `OptionData<T>` is trivially copyable whenever `T` is.
 	template<typename T>
 	struct OptionData;
 
@@ -86,30 +90,50 @@ namespace hyperion::option {
 		}
 		explicit constexpr OptionData(None&& n) noexcept : m_none(n) {
 		}
+		constexpr OptionData(const OptionData& data) noexcept
+		requires concepts::TriviallyCopyable<storage_type>
+		= default;
+		constexpr OptionData(OptionData&& data) noexcept
+		requires concepts::TriviallyCopyable<storage_type>
+		= default;
+		constexpr ~OptionData() noexcept
+		requires concepts::TriviallyDestructible<storage_type>
+		= default;
+		constexpr auto operator=(const OptionData& data) noexcept -> OptionData&
+		requires concepts::TriviallyCopyable<storage_type>
+		= default;
+		constexpr auto operator=(OptionData&& data) noexcept -> OptionData&
+		requires concepts::TriviallyCopyable<storage_type>
+		= default;
 		constexpr OptionData(const OptionData& data) noexcept(
-			concepts::NoexceptCopyConstructible<storage_type>) requires
-			concepts::CopyConstructible<storage_type> {
+			concepts::NoexceptCopyConstructible<storage_type>)
+		requires concepts::CopyConstructible<storage_type>
+				 && concepts::NotTriviallyCopyable<storage_type>
+		{
 			if(data.m_is_some) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
 				std::construct_at(std::addressof(m_some), data.m_some);
 				m_is_some = true;
 			}
 		}
+		/// @note This leaves `data` engaged, holding the moved-from value. `Option` resets it to
+		/// `None` afterwards, so the moved-from value is still destroyed
 		constexpr OptionData(OptionData&& data) noexcept(
-			concepts::NoexceptMoveConstructible<storage_type>) requires
-			concepts::MoveConstructible<storage_type> {
+			concepts::NoexceptMoveConstructible<storage_type>)
+		requires concepts::MoveConstructible<storage_type>
+				 && concepts::NotTriviallyCopyable<storage_type>
+		{
 			if(data.m_is_some) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
 				std::construct_at(std::addressof(m_some), std::move(data.m_some));
 				m_is_some = true;
-				data.m_is_some = false;
 			}
 		}
 		template<typename U>
 		requires concepts::ConstructibleFrom<storage_type, U> && concepts::NotSame<storage_type, U>
 		constexpr OptionData(const OptionData<U>& data) // NOLINT
 			noexcept(concepts::NoexceptCopyConstructible<storage_type>) {
-			if(data.m_is_some) {
+			if(data.has_value()) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
 				std::construct_at(std::addressof(m_some), data.get());
 				m_is_some = true;
@@ -119,18 +143,18 @@ namespace hyperion::option {
 		requires concepts::ConstructibleFrom<storage_type, U> && concepts::NotSame<storage_type, U>
 		constexpr OptionData(OptionData<U>&& data) // NOLINT
 			noexcept(concepts::NoexceptCopyConstructible<storage_type>) {
-			if(data.m_is_some) {
+			if(data.has_value()) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
 				std::construct_at(std::addressof(m_some), data.extract());
 				m_is_some = true;
 			}
 		}
-		constexpr ~OptionData() noexcept(concepts::NoexceptDestructible<T>) {
-			if constexpr(!std::is_trivially_destructible_v<T>) {
-				if(m_is_some) {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					std::destroy_at(std::addressof(m_some));
-				}
+		constexpr ~OptionData() noexcept(concepts::NoexceptDestructible<T>)
+		requires(!concepts::TriviallyDestructible<storage_type>)
+		{
+			if(m_is_some) {
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+				std::destroy_at(std::addressof(m_some));
 			}
 		}
 
@@ -161,7 +185,9 @@ namespace hyperion::option {
 
 		constexpr auto
 		operator=(const OptionData& data) noexcept(concepts::NoexceptCopyable<storage_type>)
-			-> OptionData& requires concepts::Copyable<storage_type> {
+			-> OptionData&
+		requires concepts::Copyable<storage_type> && concepts::NotTriviallyCopyable<storage_type>
+		{
 			if(this == &data) {
 				return *this;
 			}
@@ -209,7 +235,7 @@ namespace hyperion::option {
 		{
 			// clang-format on
 
-			if(data.m_is_some) {
+			if(data.has_value()) {
 				*this = data.get();
 			}
 			else if(m_is_some) {
@@ -222,15 +248,18 @@ namespace hyperion::option {
 			return *this;
 		}
 
+		/// @note Like the move constructor, this leaves `data` engaged, holding the moved-from
+		/// value, for `Option` to reset
 		constexpr auto
 		operator=(OptionData&& data) noexcept(concepts::NoexceptMovable<storage_type>)
-			-> OptionData& requires concepts::Movable<storage_type> {
+			-> OptionData&
+		requires concepts::Movable<storage_type> && concepts::NotTriviallyCopyable<storage_type>
+		{
 			if(this == &data) {
 				return *this;
 			}
 
 			if(data.m_is_some) {
-				data.m_is_some = false;
 				*this = std::move(data.m_some);
 			}
 			else if(m_is_some) {
@@ -307,126 +336,119 @@ namespace hyperion::option {
 		}
 	};
 
-	template<concepts::Reference T>
+	/// @brief Storage for types with a `Niche`. The niche value represents `None`, so no separate
+	/// discriminator is needed and `OptionData<T>` is the same size as `T`
+	template<concepts::NotReference T>
+	requires HasNiche<T>
 	struct OptionData<T> {
-		using type = std::remove_reference_t<T>;
-		using reference = std::add_lvalue_reference_t<std::remove_const_t<type>>;
+		using type = T;
+		using reference = std::add_lvalue_reference_t<type>;
 		using const_reference = std::add_lvalue_reference_t<std::add_const_t<type>>;
-		using rvalue_reference
-			= std::conditional_t<std::is_const_v<type>, const_reference, reference>;
+		using rvalue_reference = std::add_rvalue_reference_t<type>;
 		using extracted = rvalue_reference;
-		using pointer = std::add_pointer_t<std::remove_const_t<type>>;
-		using pointer_to_const = std::add_pointer_t<std::add_const_t<type>>;
-
-		using storage_type = std::reference_wrapper<type>;
+		using pointer = std::conditional_t<concepts::Pointer<T>, T, std::add_pointer_t<T>>;
+		using pointer_to_const = std::add_pointer_t<std::add_const_t<std::remove_pointer_t<type>>>;
 
-		union {
-			storage_type m_some;
-			None m_none;
-		};
+		using storage_type = T;
+		using niche = Niche<T>;
 
-		bool m_is_some = false;
+		storage_type m_some = niche::none();
 
-		constexpr OptionData() noexcept : m_none() {
-		}
-		// clang-format off
+		constexpr OptionData() noexcept = default;
 		// NOLINTNEXTLINE(readability-identifier-length)
-		explicit constexpr OptionData(const_reference t) noexcept
-			requires std::is_const_v<std::remove_reference_t<T>>
-			: m_some(ref(t)),
-			  m_is_some(true) {
+		explicit constexpr OptionData(const_reference t) noexcept(
+			concepts::NoexceptCopyConstructible<storage_type>)
+		requires concepts::CopyConstructible<storage_type>
+		: m_some(t) {
 		}
-		// clang-format on
-
 		// NOLINTNEXTLINE(readability-identifier-length)
-		explicit constexpr OptionData(reference t) noexcept : m_some(ref(t)), m_is_some(true) {
+		explicit constexpr OptionData(rvalue_reference t) noexcept(
+			concepts::NoexceptMoveConstructible<storage_type>)
+		requires concepts::MoveConstructible<storage_type>
+		: m_some(std::move(t)) {
 		}
-		// NOLINTNEXTLINE(readability-identifier-length)
-		explicit constexpr OptionData(None n) noexcept : m_none(n) {
+		/// @brief Constructs an `OptionData` by constructing the `T` in place in it
+		/// @tparam Args - The types of the arguments to pass to `T`'s constructor
+		/// @param args  - The arguments to pass to `T`'s constructor
+		template<typename... Args>
+		requires concepts::ConstructibleFrom<T, Args...>
+		explicit constexpr OptionData(Args&&... args) noexcept(
+			concepts::NoexceptConstructibleFrom<T, Args...>)
+			: m_some(std::forward<Args>(args)...) {
 		}
-		constexpr OptionData(const OptionData& data) noexcept {
-			if(data.m_is_some) {
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-				std::construct_at(std::addressof(m_some), data.m_some);
-				m_is_some = true;
-			}
+		explicit constexpr OptionData([[maybe_unused]] const None& n) noexcept {
 		}
-		constexpr OptionData(OptionData&& data) noexcept {
-			if(data.m_is_some) {
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-				std::construct_at(std::addressof(m_some), std::move(data.m_some));
-				m_is_some = true;
-				data.m_is_some = false;
-			}
+		explicit constexpr OptionData([[maybe_unused]] None&& n) noexcept {
 		}
-		constexpr ~OptionData() noexcept {
-			if constexpr(!std::is_trivially_destructible_v<storage_type>) {
-				if(m_is_some) {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					std::destroy_at(std::addressof(m_some));
-				}
-			}
+		constexpr OptionData(const OptionData& data) = default;
+		constexpr OptionData(OptionData&& data) noexcept(
+			concepts::NoexceptMoveConstructible<storage_type>) = default;
+		template<typename U>
+		requires concepts::ConstructibleFrom<storage_type, U> && concepts::NotSame<storage_type, U>
+		constexpr OptionData(const OptionData<U>& data) // NOLINT
+			noexcept(concepts::NoexceptCopyConstructible<storage_type>)
+			: m_some(data.has_value() ? storage_type(data.get()) : niche::none()) {
+		}
+		template<typename U>
+		requires concepts::ConstructibleFrom<storage_type, U> && concepts::NotSame<storage_type, U>
+		constexpr OptionData(OptionData<U>&& data) // NOLINT
+			noexcept(concepts::NoexceptCopyConstructible<storage_type>)
+			: m_some(data.has_value() ? storage_type(data.extract()) : niche::none()) {
 		}
+		constexpr ~OptionData() noexcept(concepts::NoexceptDestructible<T>) = default;
 
+		/// @brief Returns whether this currently contains an active `T`
 		[[nodiscard]] inline constexpr auto has_value() const noexcept -> bool {
-			return m_is_some;
+			return !niche::is_none(m_some);
 		}
 
 		/// @brief Returns a const reference to the contained data
 		[[nodiscard]] inline constexpr auto get() const noexcept -> const_reference {
-			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-			return m_some.get();
+			return m_some;
 		}
 
 		/// @brief Returns a reference to the contained data
 		[[nodiscard]] inline constexpr auto get() noexcept -> reference {
-			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-			return m_some.get();
+			return m_some;
 		}
 
 		/// @brief Extracts the contained data out of this
-		[[nodiscard]] inline constexpr auto extract() noexcept -> extracted {
-			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-			return std::move(m_some).get();
+		[[nodiscard]] inline constexpr auto
+		extract() noexcept(concepts::NoexceptMovable<storage_type>)
+			-> type requires concepts::Movable<storage_type> {
+			return std::move(m_some);
 		}
 
-		constexpr auto operator=(const OptionData& data) noexcept -> OptionData& {
-			if(this == &data) {
-				return *this;
-			}
+		constexpr auto operator=(const OptionData& data) -> OptionData& = default;
+		constexpr auto operator=(OptionData&& data) noexcept(
+			concepts::NoexceptMoveAssignable<storage_type>) -> OptionData& = default;
 
-			if(data.m_is_some) {
-				*this = data.m_some;
-			}
-			else {
-				if(m_is_some) {
-					if constexpr(!std::is_trivially_destructible_v<storage_type>) {
-						// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-						std::destroy_at(std::addressof(m_some));
-					}
-					m_is_some = false;
-				}
-			}
-			return *this;
-		}
-		constexpr auto operator=(OptionData&& data) noexcept -> OptionData& {
-			if(this == &data) {
-				return *this;
-			}
+		// clang-format off
 
-			if(data.m_is_some) {
-				data.m_is_some = false;
-				*this = std::move(data.m_some);
-				m_is_some = true;
+        template<typename U>
+        constexpr auto operator=(const U& data)
+            noexcept (std::is_nothrow_assignable_v<storage_type, decltype(data)>)
+            -> OptionData&
+            requires std::is_assignable_v<storage_type, decltype(data)>
+        {
+            m_some = data;
+            return *this;
+        }
+
+		template<typename U>
+		requires concepts::Same<storage_type, std::remove_reference_t<U>>
+		constexpr auto operator=(const OptionData<U>& data)
+			noexcept(concepts::NoexceptCopyable<storage_type>)
+			-> OptionData&
+			requires concepts::Copyable<storage_type> && concepts::Reference<U>
+		{
+			// clang-format on
+
+			if(data.has_value()) {
+				m_some = data.get();
 			}
 			else {
-				if(m_is_some) {
-					m_is_some = false;
-					if constexpr(!std::is_trivially_destructible_v<storage_type>) {
-						// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-						std::destroy_at(std::addressof(m_some));
-					}
-				}
+				m_some = niche::none();
 			}
 			return *this;
 		}
@@ -435,76 +457,103 @@ namespace hyperion::option {
 		// NOLINTNEXTLINE(readability-identifier-length)
 		operator=(const_reference t) noexcept(concepts::NoexceptCopyable<storage_type>)
 			-> OptionData& requires concepts::Copyable<storage_type> {
-			if(m_is_some) {
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-				m_some = ref(t);
-			}
-			else {
-				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-				std::construct_at(std::addressof(m_some), ref(t));
-				m_is_some = true;
-			}
+			m_some = t;
 			return *this;
 		}
 		constexpr auto
 		// NOLINTNEXTLINE(readability-identifier-length)
 		operator=(rvalue_reference t) noexcept(concepts::NoexceptMovable<storage_type>)
 			-> OptionData& requires concepts::Movable<storage_type> {
-			if constexpr(std::is_trivially_copy_assignable_v<T>) {
-				if(m_is_some) {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					m_some = ref(t);
-				}
-				else {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					std::construct_at(std::addressof(m_some), ref(t));
-					m_is_some = true;
-				}
-			}
-			else {
-				if(m_is_some) {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					m_some = std::move(t);
-				}
-				else {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					std::construct_at(std::addressof(m_some), std::move(t));
-					m_is_some = true;
-				}
-			}
+			m_some = std::move(t);
 			return *this;
 		}
 		constexpr auto operator=([[maybe_unused]] const None& n) noexcept -> OptionData& {
-			if(m_is_some) {
-				if constexpr(!std::is_trivially_destructible_v<storage_type>) {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					std::destroy_at(std::addressof(m_some));
-				}
-				m_is_some = false;
-			}
+			m_some = niche::none();
 			return *this;
 		}
 		constexpr auto operator=([[maybe_unused]] None&& n) noexcept -> OptionData& {
-			if(m_is_some) {
-				if constexpr(!std::is_trivially_destructible_v<storage_type>) {
-					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
-					std::destroy_at(std::addressof(m_some));
-				}
-				m_is_some = false;
-			}
+			m_some = niche::none();
 			return *this;
 		}
+	};
 
-	  private:
-		template<typename U>
+	/// @brief Storage for references. References are stored as a pointer, with `nullptr`
+	/// representing `None`, so `OptionData<T&>` is the size of a pointer and trivially copyable
+	template<concepts::Reference T>
+	struct OptionData<T> {
+		using type = std::remove_reference_t<T>;
+		using reference = std::add_lvalue_reference_t<std::remove_const_t<type>>;
+		using const_reference = std::add_lvalue_reference_t<std::add_const_t<type>>;
+		using rvalue_reference
+			= std::conditional_t<std::is_const_v<type>, const_reference, reference>;
+		using extracted = rvalue_reference;
+		using pointer = std::add_pointer_t<std::remove_const_t<type>>;
+		using pointer_to_const = std::add_pointer_t<std::add_const_t<type>>;
+
+		using storage_type = std::add_pointer_t<type>;
+
+		storage_type m_some = nullptr;
+
+		constexpr OptionData() noexcept = default;
+		// clang-format off
 		// NOLINTNEXTLINE(readability-identifier-length)
-		[[nodiscard]] static inline constexpr auto ref(U&& u) noexcept {
-			if constexpr(std::is_const_v<T>) {
-				return std::cref(std::forward<U>(u));
-			}
-			else {
-				return std::ref(std::forward<U>(u));
-			}
+		explicit constexpr OptionData(const_reference t) noexcept
+			requires std::is_const_v<std::remove_reference_t<T>>
+			: m_some(std::addressof(t)) {
+		}
+		// clang-format on
+
+		// NOLINTNEXTLINE(readability-identifier-length)
+		explicit constexpr OptionData(reference t) noexcept : m_some(std::addressof(t)) {
+		}
+		// NOLINTNEXTLINE(readability-identifier-length)
+		explicit constexpr OptionData([[maybe_unused]] None n) noexcept {
+		}
+		constexpr OptionData(const OptionData& data) noexcept = default;
+		constexpr OptionData(OptionData&& data) noexcept = default;
+		constexpr ~OptionData() noexcept = default;
+
+		[[nodiscard]] inline constexpr auto has_value() const noexcept -> bool {
+			return m_some != nullptr;
+		}
+
+		/// @brief Returns a const reference to the contained data
+		[[nodiscard]] inline constexpr auto get() const noexcept -> const_reference {
+			return *m_some;
+		}
+
+		/// @brief Returns a reference to the contained data
+		[[nodiscard]] inline constexpr auto get() noexcept -> reference {
+			return *m_some;
+		}
+
+		/// @brief Extracts the contained data out of this
+		[[nodiscard]] inline constexpr auto extract() noexcept -> extracted {
+			return *m_some;
+		}
+
+		constexpr auto operator=(const OptionData& data) noexcept -> OptionData& = default;
+		constexpr auto operator=(OptionData&& data) noexcept -> OptionData& = default;
+
+		// NOLINTNEXTLINE(readability-identifier-length)
+		constexpr auto operator=(const_reference t) noexcept -> OptionData&
+		requires std::is_const_v<type>
+		{
+			m_some = std::addressof(t);
+			return *this;
+		}
+		// NOLINTNEXTLINE(readability-identifier-length)
+		constexpr auto operator=(reference t) noexcept -> OptionData& {
+			m_some = std::addressof(t);
+			return *this;
+		}
+		constexpr auto operator=([[maybe_unused]] const None& n) noexcept -> OptionData& {
+			m_some = nullptr;
+			return *this;
+		}
+		constexpr auto operator=([[maybe_unused]] None&& n) noexcept -> OptionData& {
+			m_some = nullptr;
+			return *this;
 		}
 	};
 	IGNORE_PADDING_STOP
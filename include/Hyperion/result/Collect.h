@@ -0,0 +1,452 @@
+/// @file Collect.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Range algorithms for aggregating `Result`s and `Option`s
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Concepts.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Result.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @ingroup result
+/// @{
+/// Range algorithms for turning many `Result`s (or `Option`s) into one.
+///
+/// Each algorithm sizes its output once, up front, and moves the contained values out of the
+/// input instead of copying them.
+///
+/// Example:
+/// @code {.cpp}
+/// #include <Hyperion/result/Collect.h>
+///
+/// using namespace hyperion;
+///
+/// auto parse_all(const std::vector<std::string>& lines) noexcept -> Result<std::vector<Entry>> {
+/// 	return try_transform(lines, [](const std::string& line) { return parse_entry(line); });
+/// }
+/// @endcode
+/// @headerfile "Hyperion/result/Collect.h"
+/// @}
+
+namespace hyperion {
+	/// @brief What the aggregating algorithms do after encountering the first error
+	///
+	/// - `ShortCircuit`: Stop at the first error. Elements after it are not processed
+	/// - `Exhaustive`: Process every element, and report the first error (in range order) once
+	/// done. Useful when processing an element has side effects that must happen regardless
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/Collect.h"
+	enum class CollectPolicy : u8 {
+		ShortCircuit = 0,
+		Exhaustive
+	};
+
+	namespace result::detail {
+		template<typename R>
+		struct collect_traits;
+
+		template<typename T, typename E>
+		struct collect_traits<Result<T, E>> {
+			using value_type = T;
+			using error_type = E;
+			using collected_type = Result<std::vector<T>, E>;
+
+			[[nodiscard]] static constexpr auto
+			succeeded(const Result<T, E>& result) noexcept -> bool {
+				return result.is_ok();
+			}
+
+			[[nodiscard]] static constexpr auto extract(Result<T, E>& result) noexcept -> T {
+				return result.unwrap();
+			}
+
+			[[nodiscard]] static constexpr auto
+			failure(Result<T, E>& result) noexcept -> collected_type {
+				return hyperion::Err<E>(result.unwrap_err(), result.error_origin());
+			}
+		};
+
+		template<typename T>
+		struct collect_traits<Option<T>> {
+			using value_type = T;
+			using collected_type = Option<std::vector<T>>;
+
+			[[nodiscard]] static constexpr auto
+			succeeded(const Option<T>& option) noexcept -> bool {
+				return option.is_some();
+			}
+
+			[[nodiscard]] static constexpr auto extract(Option<T>& option) noexcept -> T {
+				return option.unwrap();
+			}
+
+			[[nodiscard]] static constexpr auto
+			failure([[maybe_unused]] Option<T>& option) noexcept -> collected_type {
+				return None();
+			}
+		};
+
+		/// @brief Requires that `R` is a `Result` or `Option` whose values can be collected
+		/// into a `std::vector`
+		template<typename R>
+		concept Collectable = requires {
+			typename collect_traits<std::remove_cvref_t<R>>::value_type;
+		} && concepts::NotReference<typename collect_traits<std::remove_cvref_t<R>>::value_type>
+			&& concepts::NoexceptMovable<
+				typename collect_traits<std::remove_cvref_t<R>>::value_type>;
+
+		template<typename R>
+		using collected_t = typename collect_traits<std::remove_cvref_t<R>>::collected_type;
+
+		/// @brief The `Result` or `Option` produced for each element of `Range` by `F`. When
+		/// `F` is `std::identity`, the elements themselves are consumed
+		template<typename Range, typename F>
+		using produced_t = std::remove_cvref_t<
+			std::conditional_t<std::is_same_v<F, std::identity>,
+							   std::ranges::range_reference_t<Range>,
+							   std::invoke_result_t<F&, std::ranges::range_reference_t<Range>>>>;
+
+		/// @brief Lowers `first_failure` to `index`, if `index` is lower
+		inline auto
+		record_failure(std::atomic<usize>& first_failure, usize index) noexcept -> void {
+			auto current = first_failure.load(std::memory_order_relaxed);
+			while(index < current
+				  && !first_failure.compare_exchange_weak(current,
+														  index,
+														  std::memory_order_relaxed))
+			{
+			}
+		}
+
+		/// @brief Collects the outcomes of applying `func` to `[first, last)`, the elements at
+		/// indices `[offset, offset + (last - first))` of the whole input
+		///
+		/// When short-circuiting with a shared `first_failure`, elements are only processed
+		/// while their index is below the lowest failing index found by any worker so far, and
+		/// failures lower it. Every element before the lowest failing index is therefore still
+		/// processed, which makes the error reported deterministic.
+		template<typename R, typename Iter, typename Sentinel, typename F>
+		[[nodiscard]] inline auto transform_range(Iter first,
+												  Sentinel last,
+												  F& func,
+												  CollectPolicy policy,
+												  usize size_hint,
+												  std::atomic<usize>* first_failure = nullptr,
+												  usize offset = 0_usize) noexcept
+			-> collected_t<R> {
+			using traits = collect_traits<R>;
+
+			auto values = std::vector<typename traits::value_type>();
+			values.reserve(size_hint);
+			auto failure = Option<collected_t<R>>();
+
+			for(auto index = offset; first != last; ++first, ++index) {
+				if(first_failure != nullptr
+				   && index >= first_failure->load(std::memory_order_relaxed))
+				{
+					break;
+				}
+
+				auto&& result = [&]() noexcept -> decltype(auto) {
+					if constexpr(std::is_same_v<F, std::identity>) {
+						return *first;
+					}
+					else {
+						return std::invoke(func, *first);
+					}
+				}();
+
+				if(traits::succeeded(result)) [[likely]] {
+					if(failure.is_none()) {
+						values.push_back(traits::extract(result));
+					}
+					continue;
+				}
+
+				if(failure.is_none()) {
+					failure = Some(traits::failure(result));
+				}
+				if(policy == CollectPolicy::ShortCircuit) {
+					if(first_failure != nullptr) {
+						record_failure(*first_failure, index);
+					}
+					break;
+				}
+			}
+
+			if(failure.is_some()) {
+				return failure.unwrap();
+			}
+
+			return collected_t<R>(std::move(values));
+		}
+
+		template<typename Range>
+		[[nodiscard]] inline constexpr auto size_hint(Range& range) noexcept -> usize {
+			if constexpr(std::ranges::sized_range<Range>) {
+				return static_cast<usize>(std::ranges::size(range));
+			}
+			else {
+				return 0_usize;
+			}
+		}
+	} // namespace result::detail
+
+	/// @brief Collects a range of `Result<T, E>`s into a `Result<std::vector<T>, E>`, or a range
+	/// of `Option<T>`s into an `Option<std::vector<T>>`, consuming the elements of `results`
+	///
+	/// If every element is `Ok` (or `Some`), the values are moved into a single vector, which is
+	/// sized once if `results` is a `std::ranges::sized_range`. Otherwise, returns the first
+	/// error (or `None`), stopping at it.
+	///
+	/// @param results - The range of `Result`s or `Option`s to collect
+	///
+	/// @return The collected values, or the first error
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/Collect.h"
+	template<std::ranges::input_range Range,
+			 typename R = result::detail::produced_t<Range, std::identity>>
+	requires result::detail::Collectable<R>
+			 && (!std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>)
+	[[nodiscard]] inline auto collect(Range&& results) noexcept -> result::detail::collected_t<R> {
+		auto identity = std::identity();
+		return result::detail::transform_range<R>(std::ranges::begin(results),
+												  std::ranges::end(results),
+												  identity,
+												  CollectPolicy::ShortCircuit,
+												  result::detail::size_hint(results));
+	}
+
+	IGNORE_PADDING_START
+	/// @brief The values and errors of a range of `Result`s, split apart by `partition_results`
+	///
+	/// @tparam T - The `Ok` type of the partitioned `Result`s
+	/// @tparam E - The `Err` type of the partitioned `Result`s
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/Collect.h"
+	template<typename T, typename E>
+	struct PartitionedResults {
+		/// The values of the `Ok` results, in range order
+		std::vector<T> oks;
+		/// The errors of the `Err` results, in range order
+		std::vector<E> errs;
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief Splits a range of `Result<T, E>`s into their values and their errors, consuming
+	/// the elements of `results`
+	///
+	/// If `results` is a `std::ranges::forward_range`, the `Ok`s are counted first so both
+	/// vectors are sized exactly, once.
+	///
+	/// @param results - The range of `Result`s to partition
+	///
+	/// @return The values and errors of `results`, each in range order
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/Collect.h"
+	template<std::ranges::input_range Range,
+			 typename R = std::remove_cvref_t<std::ranges::range_reference_t<Range>>,
+			 typename T = typename result::detail::collect_traits<R>::value_type,
+			 typename E = typename result::detail::collect_traits<R>::error_type>
+	requires result::detail::Collectable<R> && concepts::NotReference<E>
+			 && concepts::NoexceptMovable<E>
+			 && (!std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>)
+	[[nodiscard]] inline auto
+	partition_results(Range&& results) noexcept -> PartitionedResults<T, E> {
+		auto partitioned = PartitionedResults<T, E>();
+		if constexpr(std::ranges::forward_range<Range>) {
+			auto num_oks = 0_usize;
+			auto num_errs = 0_usize;
+			for(const auto& result : results) {
+				++(result.is_ok() ? num_oks : num_errs);
+			}
+			partitioned.oks.reserve(num_oks);
+			partitioned.errs.reserve(num_errs);
+		}
+
+		for(auto&& result : results) {
+			if(result.is_ok()) {
+				partitioned.oks.push_back(result.unwrap());
+			}
+			else {
+				partitioned.errs.push_back(result.unwrap_err());
+			}
+		}
+
+		return partitioned;
+	}
+
+	/// @brief Applies `func` to each element of `inputs`, collecting the `Result<U, E>`s (or
+	/// `Option<U>`s) it returns into a `Result<std::vector<U>, E>` (or `Option<std::vector<U>>`)
+	///
+	/// The output is sized once if `inputs` is a `std::ranges::sized_range`, and every value is
+	/// moved out of the `Result` that carried it. With `CollectPolicy::ShortCircuit`, `func` is
+	/// not invoked for the elements after the first error.
+	///
+	/// @param inputs - The range of elements to transform
+	/// @param func - The fallible transformation, returning a `Result` or `Option`
+	/// @param policy - Whether to stop at the first error
+	///
+	/// @return The transformed values, or the first error
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/Collect.h"
+	template<std::ranges::input_range Range,
+			 typename F,
+			 typename R = result::detail::produced_t<Range, F>>
+	requires result::detail::Collectable<R>
+			 && concepts::Invocable<F&, std::ranges::range_reference_t<Range>>
+	[[nodiscard]] inline auto
+	try_transform(Range&& inputs,
+				  F&& func,
+				  CollectPolicy policy = CollectPolicy::ShortCircuit) noexcept
+		-> result::detail::collected_t<R> {
+		return result::detail::transform_range<R>(std::ranges::begin(inputs),
+												  std::ranges::end(inputs),
+												  func,
+												  policy,
+												  result::detail::size_hint(inputs));
+	}
+
+	/// @brief Applies `func` to each element of `inputs` on multiple threads, collecting the
+	/// `Result<U, E>`s (or `Option<U>`s) it returns into a `Result<std::vector<U>, E>` (or
+	/// `Option<std::vector<U>>`)
+	///
+	/// `inputs` is split into contiguous chunks, one per thread, with the first chunk processed
+	/// on the calling thread. Each chunk is collected into its own vector, and the chunks are
+	/// then moved, in order, into the output, which is sized once. This is intended for
+	/// independent, relatively expensive work items. For cheap ones, the cost of starting the
+	/// threads outweighs the work, and `try_transform` should be used instead.
+	///
+	/// `func` is invoked concurrently, so it must be safe to invoke from multiple threads at once.
+	/// With either policy, the first error in range order is returned. With
+	/// `CollectPolicy::ShortCircuit`, the elements after the first error found so far are
+	/// skipped, but those before it are still processed. If a thread can't be started, its chunk
+	/// is processed on the calling thread instead.
+	///
+	/// @param inputs - The range of elements to transform
+	/// @param func - The fallible transformation, returning a `Result` or `Option`
+	/// @param policy - Whether to stop at the first error
+	/// @param max_threads - The maximum number of threads to use, including the calling thread.
+	/// `0` uses `std::thread::hardware_concurrency()`
+	///
+	/// @return The transformed values, or the first error
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/Collect.h"
+	template<std::ranges::random_access_range Range,
+			 typename F,
+			 typename R = result::detail::produced_t<Range, F>>
+	requires std::ranges::sized_range<Range> && result::detail::Collectable<R>
+			 && concepts::Invocable<F&, std::ranges::range_reference_t<Range>>
+	[[nodiscard]] inline auto
+	try_transform_parallel(Range&& inputs,
+						   F&& func,
+						   CollectPolicy policy = CollectPolicy::ShortCircuit,
+						   usize max_threads = 0_usize) noexcept -> result::detail::collected_t<R> {
+		using collected_type = result::detail::collected_t<R>;
+		using traits = result::detail::collect_traits<collected_type>;
+
+		const auto size = static_cast<usize>(std::ranges::size(inputs));
+		if(max_threads == 0_usize) {
+			max_threads
+				= std::max(static_cast<usize>(std::thread::hardware_concurrency()), 1_usize);
+		}
+		if(std::min(max_threads, size) <= 1_usize) {
+			return try_transform(std::forward<Range>(inputs), func, policy);
+		}
+
+		// recompute the number of chunks from the chunk size so that none of them are empty
+		const auto chunk_size = (size + max_threads - 1_usize) / max_threads;
+		const auto num_chunks = (size + chunk_size - 1_usize) / chunk_size;
+
+		auto chunks = std::vector<collected_type>(num_chunks);
+		auto first_failure = std::atomic<usize>(std::numeric_limits<usize>::max());
+		auto begin = std::ranges::begin(inputs);
+		const auto run_chunk = [&](usize index) noexcept {
+			using difference_type = std::ranges::range_difference_t<Range>;
+			const auto first = index * chunk_size;
+			const auto last = std::min(first + chunk_size, size);
+			chunks[index] = result::detail::transform_range<R>(
+				std::next(begin, static_cast<difference_type>(first)),
+				std::next(begin, static_cast<difference_type>(last)),
+				func,
+				policy,
+				last - first,
+				&first_failure,
+				first);
+		};
+
+		auto workers = std::vector<std::thread>();
+		workers.reserve(num_chunks - 1_usize);
+		try {
+			for(auto index = 1_usize; index < num_chunks; ++index) {
+				workers.emplace_back(run_chunk, index);
+			}
+		}
+		catch([[maybe_unused]] const std::system_error& error) {
+			// out of threads (or not allowed any more): the chunks that didn't get one are
+			// processed on this thread below
+		}
+
+		run_chunk(0_usize);
+		for(auto index = workers.size() + 1_usize; index < num_chunks; ++index) {
+			run_chunk(index);
+		}
+		for(auto& worker : workers) {
+			worker.join();
+		}
+
+		auto total = 0_usize;
+		for(auto& chunk : chunks) {
+			if(!traits::succeeded(chunk)) {
+				return std::move(chunk);
+			}
+			total += chunk.as_cref().size();
+		}
+
+		auto values = std::vector<typename result::detail::collect_traits<R>::value_type>();
+		values.reserve(total);
+		for(auto& chunk : chunks) {
+			auto chunk_values = traits::extract(chunk);
+			values.insert(values.end(),
+						  std::make_move_iterator(chunk_values.begin()),
+						  std::make_move_iterator(chunk_values.end()));
+		}
+
+		return collected_type(std::move(values));
+	}
+} // namespace hyperion
@@ -28,6 +28,7 @@
 
 #include <Hyperion/Concepts.h>
 #include <Hyperion/Error.h>
+#include <Hyperion/result/ErrorOrigin.h>
 
 namespace hyperion {
 
@@ -42,6 +43,64 @@ namespace hyperion {
 
 	template<concepts::NotReference E>
 	struct Err<E> {
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		/// @brief Constructs an `Err` from the given error value, recording `location` as the
+		/// error's origin
+		///
+		/// @param error - The value representing an error
+		/// @param location - The location the error originated at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		explicit constexpr Err(
+			const E& error,
+			const std::source_location& location = std::source_location::current()) noexcept
+			requires concepts::NoexceptCopyConstructible<E>
+			: m_error(error), m_origin(location) {
+		}
+		/// @brief Constructs an `Err` from the given error value, recording `location` as the
+		/// error's origin
+		///
+		/// @param error - The value representing an error
+		/// @param location - The location the error originated at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		explicit constexpr Err(
+			E&& error,
+			const std::source_location& location = std::source_location::current()) noexcept
+			requires concepts::NoexceptMoveConstructible<E>
+			: m_error(std::move(error)), m_origin(location) {
+		}
+		/// @brief Constructs an `Err` from the given error value, recording `location` as the
+		/// error's origin
+		///
+		/// @param error - The value representing an error
+		/// @param location - The location the error originated at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		explicit constexpr Err(concepts::Convertible<E> auto&& error, // NOLINT
+							   const std::source_location& location
+							   = std::source_location::current()) noexcept
+			requires concepts::NotSame<const Err&,
+									   decltype(error)> && concepts::NotSame<Err&&, decltype(error)>
+			: m_error(std::forward<E>(static_cast<E>(error))), m_origin(location) {
+		}
+
+		/// @brief Constructs an `Err` by constructing the error value in place in it
+		///
+		/// Default arguments can't follow a parameter pack, so the origin of an error
+		/// constructed in place has an unknown location (though its backtrace is still captured,
+		/// if enabled).
+		///
+		/// @tparam Args - The types of arguments to pass to `E`'s constructor
+		/// @param args - The arguments to pass to `E`'s constructor
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		template<typename... Args>
+		requires concepts::ConstructibleFrom<E, Args...>
+		explicit constexpr Err(Args&&... args) noexcept
+			: m_error(std::forward<Args>(args)...), m_origin(std::source_location()) {
+		}
+#else
 		/// @brief Constructs an `Err` from the given error value
 		///
 		/// @param error - The value representing an error
@@ -80,6 +139,42 @@ namespace hyperion {
 		requires concepts::ConstructibleFrom<E, Args...>
 		explicit constexpr Err(Args&&... args) noexcept : m_error(std::forward<Args>(args)...) {
 		}
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+
+		/// @brief Constructs an `Err` from the given error value, carrying over the origin of
+		/// the error it was propagated from
+		///
+		/// @param error - The value representing an error
+		/// @param origin - The origin of the error
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		constexpr Err(const E& error, // NOLINT(misc-unused-parameters)
+					  [[maybe_unused]] const result::ErrorOrigin& origin) noexcept
+			requires concepts::NoexceptCopyConstructible<E>
+			: m_error(error)
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			  ,
+			  m_origin(origin)
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		{
+		}
+		/// @brief Constructs an `Err` from the given error value, carrying over the origin of
+		/// the error it was propagated from
+		///
+		/// @param error - The value representing an error
+		/// @param origin - The origin of the error
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		constexpr Err(E&& error, // NOLINT(misc-unused-parameters)
+					  [[maybe_unused]] const result::ErrorOrigin& origin) noexcept
+			requires concepts::NoexceptMoveConstructible<E>
+			: m_error(std::move(error))
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			  ,
+			  m_origin(origin)
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		{
+		}
 		/// @brief Copy Constructor
 		/// @ingroup result
 		/// @headerfile "Hyperion/result/Err.h"
@@ -112,10 +207,29 @@ namespace hyperion {
 		operator=(Err&& err) noexcept -> Err& requires concepts::NoexceptMoveAssignable<E>
 		= default;
 
+		/// @brief Returns where the error originated
+		///
+		/// @return The origin of the error, unknown if origin tracking is disabled
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		[[nodiscard]] constexpr auto origin() const noexcept -> const result::ErrorOrigin& {
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			return m_origin;
+#else
+			return result::UNKNOWN_ERROR_ORIGIN;
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		}
+
 		/// @brief The error
 		/// @ingroup result
 		/// @headerfile "Hyperion/result/Ok.h"
 		E m_error;
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		/// @brief Where the error originated
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		result::ErrorOrigin m_origin;
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
 	};
 
 	template<concepts::Reference E>
@@ -136,6 +250,16 @@ namespace hyperion {
 		/// @headerfile "Hyperion/result/Err.h"
 		explicit constexpr Err(type& error) noexcept : m_error(error) {
 		}
+		/// @brief Constructs an `Err` from the given error value. References don't own the
+		/// error they refer to, so they don't track its origin and `origin` is discarded
+		///
+		/// @param error - The value representing an error
+		/// @param origin - The origin of the error
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		constexpr Err(type& error, [[maybe_unused]] const result::ErrorOrigin& origin) noexcept
+			: m_error(error) {
+		}
 		/// @brief Constructs an `Err` from the given error value
 		///
 		/// @param error - The value representing an error
@@ -175,6 +299,16 @@ namespace hyperion {
 			m_error = err.m_error;
 		}
 
+		/// @brief Returns where the error originated. References don't track the origin of the
+		/// error they refer to, so this is always unknown
+		///
+		/// @return The origin of the error
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/Err.h"
+		[[nodiscard]] constexpr auto origin() const noexcept -> const result::ErrorOrigin& {
+			return result::UNKNOWN_ERROR_ORIGIN;
+		}
+
 		/// @brief The error
 		std::reference_wrapper<type> m_error;
 	};
@@ -0,0 +1,371 @@
+/// @file ErrorOrigin.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Optional provenance (source location and backtrace) for `Result` errors
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Fmt.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Ignore.h>
+#include <Hyperion/error/Backtrace.h>
+#include <Hyperion/error/Panic.h>
+#include <Hyperion/memory/ObjectPool.h>
+#include <atomic>
+#include <source_location>
+#include <utility>
+
+/// @def HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+/// @brief Configures `Err` and `Result` to record where errors originated
+///
+/// When enabled, constructing an `Err` (or a `Result` directly from an error value) records the
+/// `std::source_location` of the construction into a small side slot, and that origin is carried
+/// along as the error is propagated through copies, moves, and the error-preserving combinators
+/// (`map`, `and_then`, etc.) of `Result`. This gives errors provenance without having to format
+/// context strings at every layer. Recording the location never allocates.
+///
+/// When disabled, `Err` and `Result` carry no extra storage and `error_origin()` always reports
+/// an unknown origin.
+///
+/// By default, this is disabled. This changes the layout of `Err` and `Result`, so it must be
+/// configured identically for the whole program: enable it through the build system (the
+/// `HYPERION_RESULT_ERROR_ORIGIN` CMake cache variable, or xmake's
+/// `hyperion_result_error_origin` option, set to `LOCATION`/`location`), which defines it for
+/// every target using the library, not by defining it in individual translation units.
+/// @ingroup result
+/// @headerfile "Hyperion/result/ErrorOrigin.h"
+
+/// @def HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+/// @brief Configures the error origin recorded by `Err` and `Result` to also include a raw
+/// `hyperion::backtrace`
+///
+/// The backtrace is only captured (not symbolized) when the error is created, so this stays
+/// cheap enough for debug and staging builds. It's stored in a reference-counted block shared by
+/// every copy of the error's origin, so `Err` and `Result` only grow by a pointer, and a `Result`
+/// holding a value never pays for a backtrace. The blocks come from a fixed-capacity, lock-free
+/// pool allocated once (see `HYPERION_RESULT_ERROR_BACKTRACE_POOL_CAPACITY`), so creating an
+/// error doesn't allocate. If every block is in use, the error's origin only records its
+/// location. Enabling this implies `HYPERION_RESULT_TRACKS_ERROR_ORIGIN`.
+///
+/// By default, this is disabled. Like `HYPERION_RESULT_TRACKS_ERROR_ORIGIN`, it must be
+/// configured identically for the whole program, through the build system (`BACKTRACE`/
+/// `backtrace`).
+/// @ingroup result
+/// @headerfile "Hyperion/result/ErrorOrigin.h"
+
+#ifndef HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+	// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+	#define HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE false
+#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+
+/// @def HYPERION_RESULT_ERROR_BACKTRACE_POOL_CAPACITY
+/// @brief The number of error backtraces that can be alive at once when
+/// `HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE` is enabled
+///
+/// Every copy of an error's origin shares one backtrace, so this bounds the number of distinct
+/// errors carrying a backtrace at any one time, not the number of `Err`s or `Result`s. Defaults
+/// to 256.
+/// @ingroup result
+/// @headerfile "Hyperion/result/ErrorOrigin.h"
+
+#ifndef HYPERION_RESULT_ERROR_BACKTRACE_POOL_CAPACITY
+	// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+	#define HYPERION_RESULT_ERROR_BACKTRACE_POOL_CAPACITY 256
+#endif // HYPERION_RESULT_ERROR_BACKTRACE_POOL_CAPACITY
+
+#ifndef HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+	// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+	#define HYPERION_RESULT_TRACKS_ERROR_ORIGIN HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE && !HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+	#error "HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE requires HYPERION_RESULT_TRACKS_ERROR_ORIGIN"
+#endif
+
+namespace hyperion::result {
+
+	IGNORE_PADDING_START
+	/// @brief `ErrorOrigin` records where an error carried by an `Err` or `Result` was created
+	///
+	/// Depending on the configuration (see `HYPERION_RESULT_TRACKS_ERROR_ORIGIN` and
+	/// `HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE`), this holds the source location the error
+	/// was created at and, optionally, a shared handle to a raw backtrace of the call stack at
+	/// that point. When origin tracking is disabled, this is an empty type that always reports
+	/// an unknown origin.
+	///
+	/// # Example
+	/// @code {.cpp}
+	/// auto result = do_something_fallible();
+	/// if(result.is_err()) {
+	/// 	const auto& origin = result.error_origin();
+	/// 	if(origin.has_location()) {
+	/// 		eprintln("error originated at {}", origin);
+	/// 	}
+	/// }
+	/// @endcode
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/ErrorOrigin.h"
+	class ErrorOrigin {
+	  public:
+		/// @brief Whether origins are recorded at all in this configuration
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		static constexpr bool TRACKED = HYPERION_RESULT_TRACKS_ERROR_ORIGIN;
+		/// @brief Whether origins include a backtrace in this configuration
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		static constexpr bool HAS_BACKTRACE = HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE;
+		/// @brief The number of distinct backtraces that can be alive at once in this
+		/// configuration
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		static constexpr usize BACKTRACE_POOL_CAPACITY
+			= HAS_BACKTRACE ? HYPERION_RESULT_ERROR_BACKTRACE_POOL_CAPACITY : 0;
+
+		/// @brief Constructs an unknown `ErrorOrigin`
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		constexpr ErrorOrigin() noexcept = default;
+
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+		/// @brief Constructs an `ErrorOrigin` recording `location` and a backtrace of the
+		/// current call stack
+		///
+		/// If every backtrace in the pool is in use, only `location` is recorded.
+		///
+		/// @param location - The location the error was created at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		explicit BOOST_FORCEINLINE ErrorOrigin(const std::source_location& location) noexcept
+			: m_location(location), m_trace(make_trace(hyperion::backtrace())) {
+		}
+
+		/// @brief Copy constructor. The copy shares `origin`'s backtrace
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		constexpr ErrorOrigin(const ErrorOrigin& origin) noexcept
+			: m_location(origin.m_location), m_trace(origin.m_trace) {
+			if(m_trace != nullptr) {
+				retain();
+			}
+		}
+
+		/// @brief Move constructor
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		constexpr ErrorOrigin(ErrorOrigin&& origin) noexcept
+			: m_location(origin.m_location), m_trace(std::exchange(origin.m_trace, nullptr)) {
+		}
+
+		/// @brief Destructor
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		constexpr ~ErrorOrigin() noexcept {
+			if(m_trace != nullptr) {
+				release();
+			}
+		}
+
+		/// @brief Copy-assignment operator. This shares `origin`'s backtrace
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		constexpr auto operator=(const ErrorOrigin& origin) noexcept -> ErrorOrigin& {
+			if(this == &origin) {
+				return *this;
+			}
+
+			if(m_trace != nullptr) {
+				release();
+			}
+			m_location = origin.m_location;
+			m_trace = origin.m_trace;
+			if(m_trace != nullptr) {
+				retain();
+			}
+
+			return *this;
+		}
+
+		/// @brief Move-assignment operator
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		constexpr auto operator=(ErrorOrigin&& origin) noexcept -> ErrorOrigin& {
+			if(this == &origin) {
+				return *this;
+			}
+
+			if(m_trace != nullptr) {
+				release();
+			}
+			m_location = origin.m_location;
+			m_trace = std::exchange(origin.m_trace, nullptr);
+
+			return *this;
+		}
+#elif HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		/// @brief Constructs an `ErrorOrigin` recording `location`
+		///
+		/// @param location - The location the error was created at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		explicit constexpr ErrorOrigin(const std::source_location& location) noexcept
+			: m_location(location) {
+		}
+#else
+		/// @brief Constructs an `ErrorOrigin`. Origin tracking is disabled, so `location` is
+		/// discarded
+		///
+		/// @param location - The location the error was created at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		explicit constexpr ErrorOrigin(const std::source_location& location) noexcept {
+			ignore(location);
+		}
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+
+		/// @brief Returns whether the location the error was created at is known
+		///
+		/// @return whether the location is known
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		[[nodiscard]] constexpr auto has_location() const noexcept -> bool {
+			return location().line() != 0;
+		}
+
+		/// @brief Returns the location the error was created at, or a default constructed
+		/// `std::source_location` if it's unknown
+		///
+		/// @return The location the error was created at
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		[[nodiscard]] constexpr auto location() const noexcept -> std::source_location {
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+			return m_location;
+#else
+			return {};
+#endif // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+		}
+
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+		/// @brief Returns the backtrace captured when the error was created
+		///
+		/// The backtrace is empty if the origin is unknown.
+		///
+		/// @return The backtrace
+		/// @ingroup result
+		/// @headerfile "Hyperion/result/ErrorOrigin.h"
+		[[nodiscard]] constexpr auto backtrace() const noexcept -> const hyperion::backtrace& {
+			return m_trace != nullptr ? m_trace->trace : EMPTY_TRACE;
+		}
+#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+
+#if HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+	  private:
+	#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+		/// @brief A captured backtrace, shared by every copy of the origin it was captured for
+		struct SharedTrace {
+			explicit SharedTrace(const hyperion::backtrace& captured) noexcept
+				: trace(captured), references(1_usize) {
+			}
+
+			hyperion::backtrace trace;
+			std::atomic<usize> references;
+		};
+
+		static constexpr auto EMPTY_TRACE = hyperion::backtrace::empty_trace();
+	#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+
+		std::source_location m_location = {};
+	#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+		SharedTrace* m_trace = nullptr;
+
+		inline auto retain() const noexcept -> void {
+			m_trace->references.fetch_add(1_usize, std::memory_order_relaxed);
+		}
+
+		inline auto release() const noexcept -> void {
+			if(m_trace->references.fetch_sub(1_usize, std::memory_order_acq_rel) == 1_usize) {
+				trace_pool().destroy(m_trace);
+			}
+		}
+
+		[[nodiscard]] static inline auto trace_pool() noexcept -> ObjectPool<SharedTrace>& {
+			// never destroyed, so errors released during static destruction can still return
+			// their backtraces to it
+			// NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+			static auto* pool = new ObjectPool<SharedTrace>(BACKTRACE_POOL_CAPACITY);
+			return *pool;
+		}
+
+		// `trace` is captured by the caller, so the frames start at the error's creation
+		[[nodiscard]] static inline auto
+		make_trace(const hyperion::backtrace& trace) noexcept -> SharedTrace* {
+			auto* memory = trace_pool().allocate();
+			if(memory == nullptr) {
+				return nullptr;
+			}
+
+			return std::construct_at(memory, trace);
+		}
+	#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+#endif	   // HYPERION_RESULT_TRACKS_ERROR_ORIGIN
+	};
+	IGNORE_PADDING_STOP
+
+	/// @brief An unknown `ErrorOrigin`, e.g. the origin reported for errors when origin
+	/// tracking is disabled
+	/// @ingroup result
+	/// @headerfile "Hyperion/result/ErrorOrigin.h"
+	inline constexpr auto UNKNOWN_ERROR_ORIGIN = ErrorOrigin();
+} // namespace hyperion::result
+
+/// @brief Specialize `fmt::formatter` for `hyperion::result::ErrorOrigin` so it can be used with
+/// fmtlib formatting functions. Formats the origin's location as
+/// `{file_name}:{line}:{column} ({function_name})`, or `unknown` if it's not known
+/// @ingroup result
+/// @headerfile "Hyperion/result/ErrorOrigin.h"
+template<>
+struct fmt::formatter<hyperion::result::ErrorOrigin> {
+	// NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+	[[nodiscard]] inline constexpr auto parse(format_parse_context& ctx) -> decltype(ctx.begin()) {
+		return ctx.begin();
+	}
+
+	template<typename FormatContext>
+	[[nodiscard]] inline auto
+	format(const hyperion::result::ErrorOrigin& origin, FormatContext& ctx) -> decltype(ctx.out()) {
+		if(!origin.has_location()) {
+			return fmt::format_to(ctx.out(), "unknown");
+		}
+
+		const auto location = origin.location();
+		return fmt::format_to(ctx.out(),
+							  "{}:{}:{} ({})",
+							  location.file_name(),
+							  location.line(),
+							  location.column(),
+							  location.function_name());
+	}
+};
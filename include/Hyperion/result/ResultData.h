@@ -26,6 +26,7 @@
 /// IN THE SOFTWARE.
 #pragma once
 
+#include <Hyperion/BasicTypes.h>
 #include <Hyperion/Concepts.h>
 #include <Hyperion/option/None.h>
 #include <Hyperion/result/Err.h>
@@ -35,6 +36,19 @@
 namespace hyperion::result {
 	IGNORE_PADDING_START
 
+	/// @brief Requires that both storage types of a `ResultData` are trivially copyable.
+	/// In that case `ResultData` uses the implicit (trivial) copy and move operations, so
+	/// `Result`s of trivial types are themselves trivially copyable and can be passed and
+	/// returned in registers
+	template<typename OkStorage, typename ErrStorage>
+	concept TriviallyCopyableStorage
+		= concepts::TriviallyCopyable<OkStorage> && concepts::TriviallyCopyable<ErrStorage>;
+
+	/// @brief Requires that both storage types of a `ResultData` are trivially destructible
+	template<typename OkStorage, typename ErrStorage>
+	concept TriviallyDestructibleStorage
+		= concepts::TriviallyDestructible<OkStorage> && concepts::TriviallyDestructible<ErrStorage>;
+
 	/// @brief `ResultData` is the storage implementation backing `Result`
 	/// It acts as a tagged union, supports references, and abstracts away
 	/// the storage details of `Result`'s implementation
@@ -68,7 +82,7 @@ namespace hyperion::result {
 			option::None m_none;
 		};
 
-		enum class Active {
+		enum class Active : u8 {
 			Ok,
 			Err,
 			None
@@ -118,11 +132,27 @@ namespace hyperion::result {
 		requires concepts::NotSame<T, option::None>
 		: m_none(none) {
 		}
+		constexpr ResultData(const ResultData& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ResultData(ResultData&& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ~ResultData() noexcept
+		requires TriviallyDestructibleStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(const ResultData& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(ResultData&& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
 		constexpr ResultData(const ResultData& data) noexcept(
 			concepts::NoexceptCopyConstructible<ok_storage_type>&&
 				concepts::NoexceptCopyConstructible<E>)
 		requires concepts::CopyConstructible<ok_storage_type>
 				 && concepts::CopyConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -140,6 +170,7 @@ namespace hyperion::result {
 				concepts::NoexceptMoveConstructible<E>)
 		requires concepts::MoveConstructible<ok_storage_type>
 				 && concepts::MoveConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -151,10 +182,11 @@ namespace hyperion::result {
 				std::construct_at(std::addressof(m_err), std::move(data.m_err));
 				m_active = Active::Err;
 			}
-			data.m_active = Active::None;
 		}
 		constexpr ~ResultData() noexcept(concepts::NoexceptDestructible<ok_storage_type>&&
-											 concepts::NoexceptDestructible<err_storage_type>) {
+											 concepts::NoexceptDestructible<err_storage_type>)
+		requires(!TriviallyDestructibleStorage<ok_storage_type, err_storage_type>)
+		{
 			if(m_active == Active::Ok) {
 				if constexpr(!std::is_trivially_destructible_v<ok_storage_type>) {
 					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -224,6 +256,7 @@ namespace hyperion::result {
 		constexpr auto operator=(const ResultData& data) noexcept(
 			concepts::NoexceptCopyable<T>&& concepts::NoexceptCopyable<E>) -> ResultData&
 		requires concepts::Copyable<T> && concepts::Copyable<E>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
@@ -256,17 +289,16 @@ namespace hyperion::result {
 		operator=(ResultData&& data) noexcept(concepts::NoexceptMovable<T>&& concepts::Movable<E>)
 			-> ResultData&
 		requires concepts::Movable<T> && concepts::Movable<E>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
 			}
 
 			if(data.m_active == Active::Ok) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_ok);
 			}
 			else if(data.m_active == Active::Err) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_err);
 			}
 			else {
@@ -451,7 +483,7 @@ namespace hyperion::result {
 			option::None m_none;
 		};
 
-		enum class Active {
+		enum class Active : u8 {
 			Ok,
 			Err,
 			None
@@ -485,11 +517,27 @@ namespace hyperion::result {
 		requires concepts::NotSame<T, option::None>
 		: m_none(none) {
 		}
+		constexpr ResultData(const ResultData& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ResultData(ResultData&& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ~ResultData() noexcept
+		requires TriviallyDestructibleStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(const ResultData& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(ResultData&& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
 		constexpr ResultData(const ResultData& data) noexcept(
 			concepts::NoexceptCopyConstructible<ok_storage_type>&&
 				concepts::NoexceptCopyConstructible<err_storage_type>)
 		requires concepts::CopyConstructible<ok_storage_type>
 				 && concepts::NoexceptCopyConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -507,6 +555,7 @@ namespace hyperion::result {
 				concepts::NoexceptMoveConstructible<err_storage_type>)
 		requires concepts::MoveConstructible<ok_storage_type>
 				 && concepts::MoveConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -518,10 +567,11 @@ namespace hyperion::result {
 				std::construct_at(std::addressof(m_err), std::move(data.m_err));
 				m_active = Active::Err;
 			}
-			data.m_active = Active::None;
 		}
 		constexpr ~ResultData() noexcept(concepts::NoexceptDestructible<ok_storage_type>&&
-											 concepts::NoexceptDestructible<err_storage_type>) {
+											 concepts::NoexceptDestructible<err_storage_type>)
+		requires(!TriviallyDestructibleStorage<ok_storage_type, err_storage_type>)
+		{
 			if(m_active == Active::Ok) {
 				if constexpr(!std::is_trivially_destructible_v<ok_storage_type>) {
 					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -596,6 +646,7 @@ namespace hyperion::result {
 													   concepts::NoexceptCopyable<err_storage_type>)
 			-> ResultData&
 		requires concepts::Copyable<ok_storage_type> && concepts::Copyable<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
@@ -629,17 +680,16 @@ namespace hyperion::result {
 												  concepts::NoexceptMovable<err_storage_type>)
 			-> ResultData&
 		requires concepts::Movable<ok_storage_type> && concepts::Movable<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
 			}
 
 			if(data.m_active == Active::Ok) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_ok);
 			}
 			else if(data.m_active == Active::Err) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_err);
 			}
 			else {
@@ -823,7 +873,7 @@ namespace hyperion::result {
 			option::None m_none;
 		};
 
-		enum class Active {
+		enum class Active : u8 {
 			Ok,
 			Err,
 			None
@@ -858,11 +908,27 @@ namespace hyperion::result {
 		requires concepts::NotSame<T, option::None>
 		: m_none(none) {
 		}
+		constexpr ResultData(const ResultData& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ResultData(ResultData&& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ~ResultData() noexcept
+		requires TriviallyDestructibleStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(const ResultData& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(ResultData&& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
 		constexpr ResultData(const ResultData& data) noexcept(
 			concepts::NoexceptCopyConstructible<ok_storage_type>&&
 				concepts::NoexceptCopyConstructible<err_storage_type>)
 		requires concepts::CopyConstructible<ok_storage_type>
 				 && concepts::CopyConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -880,6 +946,7 @@ namespace hyperion::result {
 				concepts::NoexceptMoveConstructible<err_storage_type>)
 		requires concepts::MoveConstructible<ok_storage_type>
 				 && concepts::MoveConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -891,10 +958,11 @@ namespace hyperion::result {
 				std::construct_at(std::addressof(m_err), std::move(data.m_err));
 				m_active = Active::Err;
 			}
-			data.m_active = Active::None;
 		}
 		constexpr ~ResultData() noexcept(concepts::NoexceptDestructible<ok_storage_type>&&
-											 concepts::NoexceptDestructible<err_storage_type>) {
+											 concepts::NoexceptDestructible<err_storage_type>)
+		requires(!TriviallyDestructibleStorage<ok_storage_type, err_storage_type>)
+		{
 			if(m_active == Active::Ok) {
 				if constexpr(!std::is_trivially_destructible_v<ok_storage_type>) {
 					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -966,6 +1034,7 @@ namespace hyperion::result {
 													   concepts::NoexceptCopyable<err_storage_type>)
 			-> ResultData&
 		requires concepts::Copyable<ok_storage_type> && concepts::Copyable<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
@@ -999,17 +1068,16 @@ namespace hyperion::result {
 												  concepts::NoexceptMovable<err_storage_type>)
 			-> ResultData&
 		requires concepts::Movable<ok_storage_type> && concepts::Movable<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
 			}
 
 			if(data.m_active == Active::Ok) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_ok);
 			}
 			else if(data.m_active == Active::Err) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_err);
 			}
 			else {
@@ -1195,7 +1263,7 @@ namespace hyperion::result {
 			option::None m_none;
 		};
 
-		enum class Active {
+		enum class Active : u8 {
 			Ok,
 			Err,
 			None
@@ -1214,11 +1282,27 @@ namespace hyperion::result {
 		requires concepts::NotSame<T, option::None>
 		: m_none(none) {
 		}
+		constexpr ResultData(const ResultData& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ResultData(ResultData&& data) noexcept
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr ~ResultData() noexcept
+		requires TriviallyDestructibleStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(const ResultData& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
+		constexpr auto operator=(ResultData&& data) noexcept -> ResultData&
+		requires TriviallyCopyableStorage<ok_storage_type, err_storage_type>
+		= default;
 		constexpr ResultData(const ResultData& data) noexcept(
 			concepts::NoexceptCopyConstructible<ok_storage_type>&&
 				concepts::NoexceptCopyConstructible<err_storage_type>)
 		requires concepts::CopyConstructible<ok_storage_type>
 				 && concepts::CopyConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -1236,6 +1320,7 @@ namespace hyperion::result {
 				concepts::NoexceptMoveConstructible<err_storage_type>)
 		requires concepts::MoveConstructible<ok_storage_type>
 				 && concepts::MoveConstructible<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(data.m_active == Active::Ok) {
 				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -1247,10 +1332,11 @@ namespace hyperion::result {
 				std::construct_at(std::addressof(m_err), std::move(data.m_err));
 				m_active = Active::Err;
 			}
-			data.m_active = Active::None;
 		}
 		constexpr ~ResultData() noexcept(concepts::NoexceptDestructible<ok_storage_type>&&
-											 concepts::NoexceptDestructible<err_storage_type>) {
+											 concepts::NoexceptDestructible<err_storage_type>)
+		requires(!TriviallyDestructibleStorage<ok_storage_type, err_storage_type>)
+		{
 			if(m_active == Active::Ok) {
 				if constexpr(!std::is_trivially_destructible_v<ok_storage_type>) {
 					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
@@ -1322,6 +1408,7 @@ namespace hyperion::result {
 													   concepts::NoexceptCopyable<err_storage_type>)
 			-> ResultData&
 		requires concepts::Copyable<ok_storage_type> && concepts::Copyable<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
@@ -1355,17 +1442,16 @@ namespace hyperion::result {
 												  concepts::NoexceptMovable<err_storage_type>)
 			-> ResultData&
 		requires concepts::Movable<ok_storage_type> && concepts::Movable<err_storage_type>
+				 && (!TriviallyCopyableStorage<ok_storage_type, err_storage_type>)
 		{
 			if(this == &data) {
 				return *this;
 			}
 
 			if(data.m_active == Active::Ok) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_ok);
 			}
 			else if(data.m_active == Active::Err) {
-				data.m_active = Active::None;
 				*this = std::move(data.m_err);
 			}
 			else {
@@ -0,0 +1,202 @@
+/// @file ringbuffer/detail.h
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Index and segment implementation details shared by hyperion::RingBuffer and
+/// hyperion::StaticRingBuffer
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2022 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#pragma once
+
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Span.h>
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hyperion::detail::ringbuffer {
+
+	/// @brief Converts the ring index `index` into the corresponding index into the underlying
+	/// storage of a ring starting at `start`
+	///
+	/// @param start - The storage index of the front of the ring
+	/// @param index - The ring index to convert
+	/// @param capacity - The capacity of the ring. Must be a power of two
+	///
+	/// @return The corresponding storage index
+	[[nodiscard]] inline constexpr auto
+	adjusted_index(usize start, usize index, usize capacity) noexcept -> usize {
+		return (start + index) & (capacity - 1);
+	}
+
+	/// @brief Returns the (up to) two contiguous segments of `storage` holding the `size`
+	/// elements of a ring starting at `start`, in order
+	///
+	/// @param storage - The underlying storage of the ring
+	/// @param start - The storage index of the front of the ring
+	/// @param size - The number of elements in the ring
+	/// @param capacity - The capacity of the ring
+	///
+	/// @return The contiguous segments making up the ring
+	template<typename T>
+	[[nodiscard]] inline constexpr auto
+	segments(T* storage, usize start, usize size, usize capacity) noexcept
+		-> std::pair<Span<T>, Span<T>> {
+		const auto first_size = std::min(size, capacity - start);
+
+		IGNORE_UNSAFE_BUFFER_WARNINGS_START
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		return {make_span(storage + start, first_size), make_span(storage, size - first_size)};
+		IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+	}
+
+	/// @brief How a ring of a given size makes room to append a block of elements
+	struct PushPlan {
+		/// @brief The number of elements to drop from the front of the ring
+		usize drop;
+		/// @brief The number of elements to skip at the start of the block
+		usize skip;
+	};
+
+	/// @brief Computes how appending `count` elements to a ring holding `size` elements makes
+	/// room for them: elements are dropped from the front of the ring, and if the block itself
+	/// is larger than the ring, only its last `capacity` elements are kept
+	[[nodiscard]] inline constexpr auto
+	plan_push(usize size, usize count, usize capacity) noexcept -> PushPlan {
+		if(count >= capacity) {
+			return {.drop = size, .skip = count - capacity};
+		}
+
+		return {.drop = size + count > capacity ? size + count - capacity : 0_usize,
+				.skip = 0_usize};
+	}
+
+	/// @brief Returns whether the `count` elements starting at `values` overlap the `capacity`
+	/// slots of `storage`, i.e. whether a block being appended to a ring aliases the ring itself
+	template<typename T>
+	[[nodiscard]] inline auto
+	overlaps(const T* storage, usize capacity, const T* values, usize count) noexcept -> bool {
+		if(count == 0) {
+			return false;
+		}
+
+		const auto less = std::less<const T*>();
+		IGNORE_UNSAFE_BUFFER_WARNINGS_START
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		return less(values, storage + capacity) && less(storage, values + count);
+		IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+	}
+
+	/// @brief Copy-constructs `count` elements from `source` into the dead slots starting at
+	/// `destination`. For trivially copyable `T`, this is a `memcpy`
+	template<typename Allocator, typename T>
+	inline constexpr auto
+	construct_block(Allocator& allocator, T* destination, const T* source, usize count) noexcept
+		-> void {
+		if constexpr(std::is_trivially_copyable_v<T>) {
+			if(!std::is_constant_evaluated()) {
+				if(count != 0) {
+					std::memcpy(destination, source, count * sizeof(T));
+				}
+				return;
+			}
+		}
+
+		IGNORE_UNSAFE_BUFFER_WARNINGS_START
+		for(auto index = 0_usize; index < count; ++index) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			std::allocator_traits<Allocator>::construct(allocator,
+														destination + index,
+														source[index]); // NOLINT
+		}
+		IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+	}
+
+	/// @brief Copy-constructs `count` elements from `source` into the dead slots of `storage`
+	/// starting at storage index `tail`, wrapping around at `capacity`. This is (at most) two
+	/// block copies
+	template<typename Allocator, typename T>
+	inline constexpr auto construct_wrapped(Allocator& allocator,
+											T* storage,
+											usize capacity,
+											usize tail,
+											const T* source,
+											usize count) noexcept -> void {
+		const auto first_count = std::min(count, capacity - tail);
+
+		IGNORE_UNSAFE_BUFFER_WARNINGS_START
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		construct_block(allocator, storage + tail, source, first_count);
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		construct_block(allocator, storage, source + first_count, count - first_count);
+		IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+	}
+
+	/// @brief Assigns `count` elements from `source` to the live elements starting at
+	/// `destination`. Elements are moved from if `U` is non-const, and copied otherwise.
+	/// For trivially copyable `T`, this is a `memcpy`
+	template<typename T, typename U>
+	inline constexpr auto assign_block(T* destination, U* source, usize count) noexcept -> void {
+		if constexpr(std::is_trivially_copyable_v<T>) {
+			if(!std::is_constant_evaluated()) {
+				if(count != 0) {
+					std::memcpy(destination, source, count * sizeof(T));
+				}
+				return;
+			}
+		}
+
+		IGNORE_UNSAFE_BUFFER_WARNINGS_START
+		for(auto index = 0_usize; index < count; ++index) {
+			if constexpr(std::is_const_v<U>) {
+				destination[index] = source[index]; // NOLINT
+			}
+			else {
+				destination[index] = std::move(source[index]); // NOLINT
+			}
+		}
+		IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+	}
+
+	/// @brief Assigns as many elements from `segments` as fit into `destination`, in order
+	///
+	/// @return The number of elements assigned
+	template<typename T, typename U>
+	inline constexpr auto
+	transfer_to(Span<T> destination, std::pair<Span<U>, Span<U>> segments) noexcept -> usize {
+		auto& [first, second] = segments;
+		const auto count = std::min(destination.size(), first.size() + second.size());
+		const auto first_count = std::min(count, first.size());
+
+		IGNORE_UNSAFE_BUFFER_WARNINGS_START
+		assign_block(destination.data(), first.data(), first_count);
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		assign_block(destination.data() + first_count, second.data(), count - first_count);
+		IGNORE_UNSAFE_BUFFER_WARNINGS_STOP
+
+		return count;
+	}
+} // namespace hyperion::detail::ringbuffer
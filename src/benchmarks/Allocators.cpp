@@ -0,0 +1,220 @@
+/// @file Allocators.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Benchmarks of Hyperion's allocators against `std::allocator`
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/FmtIO.h>
+#include <Hyperion/SPSCQueue.h>
+#include <Hyperion/memory/ArenaAllocator.h>
+#include <Hyperion/memory/ThreadCachingAllocator.h>
+#include <Hyperion/memory/UniquePtr.h>
+#include <chrono>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace hyperion; // NOLINT
+
+namespace {
+	constexpr auto NUM_REQUESTS = 20'000_usize;
+	constexpr auto OBJECTS_PER_REQUEST = 64_usize;
+	constexpr auto VECTOR_SIZE = 256_usize;
+	constexpr auto NUM_PRODUCERS = 4_usize;
+	constexpr auto MESSAGES_PER_PRODUCER = 250'000_usize;
+	constexpr auto NUM_MESSAGES = NUM_PRODUCERS * MESSAGES_PER_PRODUCER;
+	constexpr auto QUEUE_CAPACITY = 1024_usize;
+
+	/// @brief Stand-in for a small per-request object
+	struct Node {
+		u64 m_id;
+		u64 m_payload[5]; // NOLINT
+		Node* m_next;
+	};
+
+	/// @brief Stand-in for a formatted log entry or error message
+	struct Message {
+		char* m_data;
+		usize m_size;
+	};
+
+	template<typename Function>
+	auto measure(std::string_view name,
+				 usize count,
+				 std::string_view unit,
+				 Function&& function) noexcept -> void {
+		const auto start = std::chrono::steady_clock::now();
+		const auto checksum = function();
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		const auto nanoseconds
+			= std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+		println("{:<48} {:>10.2f} ns/{} (checksum {})",
+				name,
+				static_cast<f64>(nanoseconds) / static_cast<f64>(count),
+				unit,
+				checksum);
+	}
+
+	template<typename Function>
+	auto measure(std::string_view name, Function&& function) noexcept -> void {
+		measure(name, NUM_REQUESTS, "request", std::forward<Function>(function));
+	}
+
+	/// @brief Simulates a request that builds a linked list of small objects, a growing
+	/// vector, and a few owned objects, then drops them all
+	template<template<typename> typename Allocator>
+	auto request(u64 seed) noexcept -> u64 {
+		auto node_allocator = Allocator<Node>();
+		using Traits = std::allocator_traits<Allocator<Node>>;
+
+		auto* head = static_cast<Node*>(nullptr);
+		for(auto i = 0_usize; i < OBJECTS_PER_REQUEST; ++i) {
+			auto* node = Traits::allocate(node_allocator, 1);
+			Traits::construct(node_allocator, node, Node{seed + i, {}, head});
+			head = node;
+		}
+
+		auto values = std::vector<u64, Allocator<u64>>();
+		for(auto i = 0_usize; i < VECTOR_SIZE; ++i) {
+			values.push_back(seed ^ i);
+		}
+
+		auto owned = allocate_unique<u64>(Allocator<u64>(), seed);
+
+		auto sum = *owned + values.back();
+		while(head != nullptr) {
+			auto* next = head->m_next;
+			sum += head->m_id;
+			Traits::destroy(node_allocator, head);
+			Traits::deallocate(node_allocator, head, 1);
+			head = next;
+		}
+
+		return sum;
+	}
+
+	/// @brief Producer threads allocate messages of varying sizes and hand them to this thread,
+	/// which frees them: the allocation pattern of log entries and errors
+	template<template<typename> typename Allocator>
+	auto cross_thread_free() noexcept -> u64 {
+		using Traits = std::allocator_traits<Allocator<char>>;
+
+		auto queues = std::vector<UniquePtr<SPSCQueue<Message>>>();
+		for(auto i = 0_usize; i < NUM_PRODUCERS; ++i) {
+			queues.push_back(make_unique<SPSCQueue<Message>>(QUEUE_CAPACITY));
+		}
+
+		auto producers = std::vector<std::thread>();
+		for(auto& queue : queues) {
+			producers.emplace_back([&queue]() noexcept {
+				auto allocator = Allocator<char>();
+				for(auto i = 0_usize; i < MESSAGES_PER_PRODUCER; ++i) {
+					const auto size = 16_usize + (i * 37_usize) % 496_usize; // NOLINT
+					auto* data = Traits::allocate(allocator, size);
+					data[0] = static_cast<char>(i); // NOLINT
+					while(!queue->try_push_back(Message{data, size})) {
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		auto allocator = Allocator<char>();
+		auto checksum = 0_u64;
+		auto remaining = NUM_MESSAGES;
+		while(remaining > 0_usize) {
+			auto consumed = 0_usize;
+			for(auto& queue : queues) {
+				consumed += queue->pop_batch([&](Message&& message) noexcept {
+					checksum += static_cast<u8>(message.m_data[0]); // NOLINT
+					Traits::deallocate(allocator, message.m_data, message.m_size);
+				});
+			}
+
+			remaining -= consumed;
+			if(consumed == 0_usize) {
+				std::this_thread::yield();
+			}
+		}
+
+		for(auto& producer : producers) {
+			producer.join();
+		}
+
+		return checksum;
+	}
+} // namespace
+
+auto main([[maybe_unused]] i32 argc, [[maybe_unused]] char** argv) -> i32 { // NOLINT
+	println("{} requests of {} nodes, a {} element vector, and one allocate_unique",
+			NUM_REQUESTS,
+			OBJECTS_PER_REQUEST,
+			VECTOR_SIZE);
+
+	measure("std::allocator", []() noexcept {
+		auto checksum = 0_u64;
+		for(auto i = 0_usize; i < NUM_REQUESTS; ++i) {
+			checksum += request<std::allocator>(i);
+		}
+		return checksum;
+	});
+
+	measure("ArenaAllocator (ArenaScope + reset per request)", []() noexcept {
+		auto arena = Arena();
+		auto checksum = 0_u64;
+		for(auto i = 0_usize; i < NUM_REQUESTS; ++i) {
+			{
+				const auto scope = ArenaScope(arena);
+				checksum += request<ArenaAllocator>(i);
+			}
+			arena.reset();
+		}
+		return checksum;
+	});
+
+	measure("ThreadLocalArenaAllocator (reset per request)", []() noexcept {
+		auto checksum = 0_u64;
+		for(auto i = 0_usize; i < NUM_REQUESTS; ++i) {
+			checksum += request<ThreadLocalArenaAllocator>(i);
+			Arena::thread_local_arena().reset();
+		}
+		return checksum;
+	});
+
+	println("{} producers each passing {} messages of 16 to 512 bytes to one consumer, which "
+			"frees them",
+			NUM_PRODUCERS,
+			MESSAGES_PER_PRODUCER);
+
+	measure("std::allocator (cross-thread free)", NUM_MESSAGES, "message", []() noexcept {
+		return cross_thread_free<std::allocator>();
+	});
+
+	measure("ThreadCachingAllocator (cross-thread free)", NUM_MESSAGES, "message", []() noexcept {
+		return cross_thread_free<ThreadCachingAllocator>();
+	});
+
+	return 0;
+}
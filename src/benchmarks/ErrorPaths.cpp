@@ -0,0 +1,585 @@
+/// @file ErrorPaths.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Benchmarks of the error paths of `Result`, `Option`, `StatusCode` and `AnyError`,
+/// against `std::expected`, `std::optional` and `std::error_code` baselines
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Error.h>
+#include <Hyperion/FmtIO.h>
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/Logger.h>
+#include <Hyperion/Option.h>
+#include <Hyperion/Result.h>
+#include <Hyperion/error/NTDomain.h>
+#include <Hyperion/error/Win32Domain.h>
+#include <Hyperion/filesystem/File.h>
+#include <Hyperion/logging/Queue.h>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+	#include <expected>
+	// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+	#define HYPERION_BENCHMARK_HAS_EXPECTED true
+#else
+	// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+	#define HYPERION_BENCHMARK_HAS_EXPECTED false
+#endif // defined(__cpp_lib_expected) && __cpp_lib_expected >= 202202L
+
+using namespace hyperion; // NOLINT
+
+namespace {
+	constexpr auto NUM_ITERATIONS = 1'000'000_usize;
+	/// @brief Every `ERROR_PERIOD`th source produces an error
+	constexpr auto ERROR_PERIOD = 8_usize;
+	/// @brief Where the report is written if no path is given on the command line
+	constexpr auto DEFAULT_REPORT_PATH = std::string_view("error_benchmark.json");
+
+	/// @brief Whether a measurement is of a hyperion type or of the standard library type
+	/// it's compared against
+	enum class Kind {
+		Hyperion,
+		Baseline
+	};
+
+	IGNORE_PADDING_START
+
+	/// @brief The time per operation of one benchmark
+	struct Measurement {
+		std::string m_group;
+		std::string m_name;
+		Kind m_kind;
+		f64 m_nanoseconds;
+		u64 m_checksum;
+	};
+
+	IGNORE_PADDING_STOP
+
+	/// @brief Runs the benchmarks, prints each measurement as it's taken, and collects them
+	/// so they can be written out as JSON for comparison against earlier runs
+	class Report {
+	  public:
+		template<typename Function>
+		auto measure(std::string_view group,
+					 std::string_view name,
+					 Kind kind,
+					 Function&& function) noexcept -> void {
+			const auto start = std::chrono::steady_clock::now();
+			const auto checksum = static_cast<u64>(function());
+			const auto elapsed = std::chrono::steady_clock::now() - start;
+			const auto nanoseconds
+				= static_cast<f64>(
+					  std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count())
+				  / static_cast<f64>(NUM_ITERATIONS);
+			println("{:<12} {:<52} {:>8.2f} ns/op (checksum {})",
+					group,
+					name,
+					nanoseconds,
+					checksum);
+			m_measurements.push_back(
+				{std::string(group), std::string(name), kind, nanoseconds, checksum});
+		}
+
+		/// @brief Writes the collected measurements to the file at `path`
+		///
+		/// Benchmark names are ASCII and never contain characters JSON requires escaped,
+		/// so they're written verbatim
+		[[nodiscard]] auto
+		write_json(const std::filesystem::path& path) const noexcept -> Result<i32> {
+			auto buffer = fmt::memory_buffer();
+			auto out = std::back_inserter(buffer);
+			fmt::format_to(out,
+						   "{{\n\t\"iterations\": {},\n\t\"error_period\": {},\n"
+						   "\t\"results\": [",
+						   NUM_ITERATIONS,
+						   ERROR_PERIOD);
+			auto separator = std::string_view("\n");
+			for(const auto& measurement : m_measurements) {
+				fmt::format_to(out,
+							   "{}\t\t{{\"group\": \"{}\", \"name\": \"{}\", \"kind\": \"{}\", "
+							   "\"ns_per_op\": {:.3f}, \"checksum\": {}}}",
+							   separator,
+							   measurement.m_group,
+							   measurement.m_name,
+							   measurement.m_kind == Kind::Hyperion ? "hyperion" : "baseline",
+							   measurement.m_nanoseconds,
+							   measurement.m_checksum);
+				separator = ",\n";
+			}
+			fmt::format_to(out, "\n\t]\n}}\n");
+
+			auto file = fs::File::open(path,
+									   {.type = fs::File::AccessType::Write,
+										.modifier = fs::File::AccessModifier::Truncate});
+			if(file.is_err()) {
+				return Err(file.unwrap_err());
+			}
+
+			return file.unwrap().print("{}", fmt::to_string(buffer));
+		}
+
+	  private:
+		std::vector<Measurement> m_measurements;
+	};
+
+	[[nodiscard]] constexpr auto is_error(usize index) noexcept -> bool {
+		return index % ERROR_PERIOD == 0_usize;
+	}
+
+	/// @brief Maps `index` to one that never produces an error, for measuring the `Ok` paths
+	[[nodiscard]] constexpr auto ok_index(usize index) noexcept -> usize {
+		return index * ERROR_PERIOD + 1_usize;
+	}
+
+	// The sources and stages are kept out of line, so that what's measured is constructing,
+	// returning, and inspecting each type rather than whatever the optimizer folds them into
+
+	HYPERION_NOINLINE auto result_source(usize index) noexcept -> Result<i64, error::SystemError> {
+		if(is_error(index)) {
+			return Err(error::SystemError(EINVAL));
+		}
+
+		return Ok(static_cast<i64>(index));
+	}
+
+	HYPERION_NOINLINE auto option_source(usize index) noexcept -> Option<i64> {
+		if(is_error(index)) {
+			return None();
+		}
+
+		return Some(static_cast<i64>(index));
+	}
+
+	HYPERION_NOINLINE auto optional_source(usize index) noexcept -> std::optional<i64> {
+		if(is_error(index)) {
+			return std::nullopt;
+		}
+
+		return static_cast<i64>(index);
+	}
+
+	HYPERION_NOINLINE auto error_code_source(usize index, std::error_code& error) noexcept -> i64 {
+		if(is_error(index)) {
+			error = std::make_error_code(std::errc::invalid_argument);
+			return 0_i64;
+		}
+
+		error.clear();
+		return static_cast<i64>(index);
+	}
+
+	// `halve` fails on odd values, so errors also enter partway through a pipeline
+
+	HYPERION_NOINLINE auto halve_result(i64 value) noexcept -> Result<i64, error::SystemError> {
+		if(value % 2_i64 != 0_i64) {
+			return Err(error::SystemError(EDOM));
+		}
+
+		return Ok(value / 2_i64);
+	}
+
+	HYPERION_NOINLINE auto halve_option(i64 value) noexcept -> Option<i64> {
+		if(value % 2_i64 != 0_i64) {
+			return None();
+		}
+
+		return Some(value / 2_i64);
+	}
+
+	HYPERION_NOINLINE auto halve_optional(i64 value) noexcept -> std::optional<i64> {
+		if(value % 2_i64 != 0_i64) {
+			return std::nullopt;
+		}
+
+		return value / 2_i64;
+	}
+
+	HYPERION_NOINLINE auto halve_error_code(i64 value, std::error_code& error) noexcept -> i64 {
+		if(value % 2_i64 != 0_i64) {
+			error = std::make_error_code(std::errc::argument_out_of_domain);
+			return 0_i64;
+		}
+
+		return value / 2_i64;
+	}
+
+	[[nodiscard]] constexpr auto add_one(i64 value) noexcept -> i64 {
+		return value + 1_i64;
+	}
+
+#if HYPERION_BENCHMARK_HAS_EXPECTED
+	HYPERION_NOINLINE auto
+	expected_source(usize index) noexcept -> std::expected<i64, std::error_code> {
+		if(is_error(index)) {
+			return std::unexpected(std::make_error_code(std::errc::invalid_argument));
+		}
+
+		return static_cast<i64>(index);
+	}
+
+	HYPERION_NOINLINE auto
+	halve_expected(i64 value) noexcept -> std::expected<i64, std::error_code> {
+		if(value % 2_i64 != 0_i64) {
+			return std::unexpected(std::make_error_code(std::errc::argument_out_of_domain));
+		}
+
+		return value / 2_i64;
+	}
+#endif // HYPERION_BENCHMARK_HAS_EXPECTED
+
+	auto measure_construction(Report& report) noexcept -> void {
+		report.measure("construct", "Result<i64, SystemError>", Kind::Hyperion, []() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += result_source(i).is_ok() ? 1_usize : 0_usize;
+			}
+			return checksum;
+		});
+
+		report.measure("construct", "Option<i64>", Kind::Hyperion, []() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += option_source(i).is_some() ? 1_usize : 0_usize;
+			}
+			return checksum;
+		});
+
+#if HYPERION_BENCHMARK_HAS_EXPECTED
+		report.measure("construct",
+					   "std::expected<i64, std::error_code>",
+					   Kind::Baseline,
+					   []() noexcept {
+						   auto checksum = 0_usize;
+						   for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+							   checksum += expected_source(i).has_value() ? 1_usize : 0_usize;
+						   }
+						   return checksum;
+					   });
+#endif // HYPERION_BENCHMARK_HAS_EXPECTED
+
+		report.measure("construct", "std::optional<i64>", Kind::Baseline, []() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += optional_source(i).has_value() ? 1_usize : 0_usize;
+			}
+			return checksum;
+		});
+
+		report.measure("construct", "i64 + std::error_code&", Kind::Baseline, []() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				auto error = std::error_code();
+				ignore(error_code_source(i, error));
+				checksum += error ? 0_usize : 1_usize;
+			}
+			return checksum;
+		});
+	}
+
+	auto measure_propagation(Report& report) noexcept -> void {
+		report.measure("propagate",
+					   "Result::and_then(halve).map(add_one).unwrap_or",
+					   Kind::Hyperion,
+					   []() noexcept {
+						   auto checksum = 0_i64;
+						   for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+							   checksum += result_source(i)
+											   .and_then(halve_result)
+											   .map(add_one)
+											   .unwrap_or(0_i64);
+						   }
+						   return checksum;
+					   });
+
+		report.measure("propagate",
+					   "Option::and_then(halve).map(add_one).unwrap_or",
+					   Kind::Hyperion,
+					   []() noexcept {
+						   auto checksum = 0_i64;
+						   for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+							   checksum += option_source(i)
+											   .and_then(halve_option)
+											   .map(add_one)
+											   .unwrap_or(0_i64);
+						   }
+						   return checksum;
+					   });
+
+		// the baselines propagate by hand, the way C++20 code without combinators has to
+
+#if HYPERION_BENCHMARK_HAS_EXPECTED
+		report.measure("propagate", "std::expected (by hand)", Kind::Baseline, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				auto value = expected_source(i);
+				if(value.has_value()) {
+					value = halve_expected(*value);
+				}
+				checksum += value.has_value() ? add_one(*value) : 0_i64;
+			}
+			return checksum;
+		});
+#endif // HYPERION_BENCHMARK_HAS_EXPECTED
+
+		report.measure("propagate", "std::optional (by hand)", Kind::Baseline, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				auto value = optional_source(i);
+				if(value.has_value()) {
+					value = halve_optional(*value);
+				}
+				checksum += value.has_value() ? add_one(*value) : 0_i64;
+			}
+			return checksum;
+		});
+
+		report.measure("propagate", "std::error_code (by hand)", Kind::Baseline, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				auto error = std::error_code();
+				auto value = error_code_source(i, error);
+				if(!error) {
+					value = halve_error_code(value, error);
+				}
+				checksum += error ? 0_i64 : add_one(value);
+			}
+			return checksum;
+		});
+	}
+
+	auto measure_unwrap(Report& report) noexcept -> void {
+		report.measure("unwrap", "Result::unwrap", Kind::Hyperion, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += result_source(ok_index(i)).unwrap();
+			}
+			return checksum;
+		});
+
+		report.measure("unwrap", "Option::unwrap", Kind::Hyperion, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += option_source(ok_index(i)).unwrap();
+			}
+			return checksum;
+		});
+
+		// `value()` is the checked accessor, so it's what `unwrap` is compared against
+
+#if HYPERION_BENCHMARK_HAS_EXPECTED
+		report.measure("unwrap", "std::expected::value", Kind::Baseline, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += expected_source(ok_index(i)).value();
+			}
+			return checksum;
+		});
+#endif // HYPERION_BENCHMARK_HAS_EXPECTED
+
+		report.measure("unwrap", "std::optional::value", Kind::Baseline, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += optional_source(ok_index(i)).value();
+			}
+			return checksum;
+		});
+
+		report.measure("unwrap", "std::error_code (check, abort)", Kind::Baseline, []() noexcept {
+			auto checksum = 0_i64;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				auto error = std::error_code();
+				const auto value = error_code_source(ok_index(i), error);
+				if(error) {
+					std::abort();
+				}
+				checksum += value;
+			}
+			return checksum;
+		});
+	}
+
+	auto measure_conversion(Report& report) noexcept -> void {
+		report.measure("convert", "SystemError -> AnyError", Kind::Hyperion, []() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				const auto error
+					= error::AnyError(error::SystemError(static_cast<i32>(i % 2_usize) + EINVAL));
+				checksum += error.has_message_view() ? 1_usize : 0_usize;
+			}
+			return checksum;
+		});
+
+		report.measure("convert",
+					   "Result<i64, SystemError> -> Result<i64, AnyError>",
+					   Kind::Hyperion,
+					   []() noexcept {
+						   auto checksum = 0_i64;
+						   for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+							   auto converted
+								   = result_source(i).map_err(
+										 [](error::SystemError&& error) noexcept {
+											 return error::AnyError(std::move(error));
+										 });
+							   checksum += converted.unwrap_or(0_i64);
+						   }
+						   return checksum;
+					   });
+
+		report.measure("convert", "errno -> std::error_code", Kind::Baseline, []() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				const auto error = std::error_code(static_cast<i32>(i % 2_usize) + EINVAL,
+												   std::generic_category());
+				checksum += error ? 1_usize : 0_usize;
+			}
+			return checksum;
+		});
+	}
+
+	/// @brief Measures `message`, and `message_view` if the domain provides it, cycling
+	/// through `codes`
+	template<typename Domain, usize N>
+	auto measure_messages(Report& report,
+						  const std::array<typename Domain::value_type, N>& codes) noexcept
+		-> void {
+		const auto domain = Domain();
+
+		report.measure("message",
+					   fmt::format("{}::message", domain.name()),
+					   Kind::Hyperion,
+					   [&domain, &codes]() noexcept {
+						   auto checksum = 0_usize;
+						   for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+							   checksum += domain.message(codes[i % N]).size(); // NOLINT
+						   }
+						   return checksum;
+					   });
+
+		if constexpr(error::StatusCodeDomainWithMessageView<Domain>) {
+			report.measure("message",
+						   fmt::format("{}::message_view", domain.name()),
+						   Kind::Hyperion,
+						   [&domain, &codes]() noexcept {
+							   auto checksum = 0_usize;
+							   for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+								   checksum
+									   += domain.message_view(codes[i % N]).size(); // NOLINT
+							   }
+							   return checksum;
+						   });
+		}
+	}
+
+	auto measure_baseline_messages(Report& report,
+								   std::string_view name,
+								   const std::error_category& category) noexcept -> void {
+		constexpr auto codes = std::array<i32, 4>{0, EINVAL, ENOENT, EBUSY};
+
+		report.measure("message", name, Kind::Baseline, [&category, &codes]() noexcept {
+			auto checksum = 0_usize;
+			for(auto i = 0_usize; i < NUM_ITERATIONS; ++i) {
+				checksum += std::error_code(codes[i % codes.size()], category) // NOLINT
+								.message()
+								.size();
+			}
+			return checksum;
+		});
+	}
+
+	auto measure_messages(Report& report) noexcept -> void {
+		measure_messages<error::GenericDomain>(
+			report,
+			std::array<error::Errno, 4>{error::Errno::Success,
+										error::Errno::InvalidArgument,
+										error::Errno::NoSuchFileOrDirectory,
+										error::Errno::DeviceOrResourceBusy});
+		measure_messages<error::PosixDomain>(report, std::array<i64, 4>{0, EINVAL, ENOENT, EBUSY});
+		measure_messages<LoggerErrorDomain>(
+			report,
+			std::array<LoggerErrorCategory, 3>{LoggerErrorCategory::Success,
+											   LoggerErrorCategory::QueueingError,
+											   LoggerErrorCategory::FlushTimedOut});
+		measure_messages<logging::QueueErrorDomain>(
+			report,
+			std::array<logging::QueueErrorCategory, 3>{logging::QueueErrorCategory::Success,
+													   logging::QueueErrorCategory::QueueIsFull,
+													   logging::QueueErrorCategory::QueueIsEmpty});
+#if HYPERION_PLATFORM_WINDOWS
+		using Win32Code = error::Win32Domain::value_type;
+		using NTCode = error::NTDomain::value_type;
+		measure_messages<error::Win32Domain>(report, std::array<Win32Code, 4>{0, 2, 5, 87});
+		measure_messages<error::NTDomain>(
+			report,
+			std::array<NTCode, 2>{0, static_cast<NTCode>(0xC0000005L)}); // NOLINT
+#endif // HYPERION_PLATFORM_WINDOWS
+
+		measure_baseline_messages(report,
+								  "std::error_code (generic_category)::message",
+								  std::generic_category());
+		measure_baseline_messages(report,
+								  "std::error_code (system_category)::message",
+								  std::system_category());
+	}
+} // namespace
+
+auto main(i32 argc, char** argv) -> i32 { // NOLINT
+	const auto path
+		= std::filesystem::path(argc > 1 ? std::string_view(argv[1]) // NOLINT
+										 : DEFAULT_REPORT_PATH);
+
+	println("{} iterations per benchmark, 1 in {} sources producing an error",
+			NUM_ITERATIONS,
+			ERROR_PERIOD);
+#if !HYPERION_BENCHMARK_HAS_EXPECTED
+	println("std::expected is unavailable, so std::expected baselines are skipped");
+#endif // !HYPERION_BENCHMARK_HAS_EXPECTED
+
+	auto report = Report();
+	measure_construction(report);
+	measure_propagation(report);
+	measure_unwrap(report);
+	measure_conversion(report);
+	measure_messages(report);
+
+	if(auto written = report.write_json(path); written.is_err()) {
+		eprintln("Failed to write benchmark results to {}: {}",
+				 path.string(),
+				 written.unwrap_err().message());
+		return 1;
+	}
+
+	println("Results written to {}", path.string());
+	return 0;
+}
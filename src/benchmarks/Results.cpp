@@ -0,0 +1,140 @@
+/// @file Results.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Benchmarks of `Result` and `Option` combinator pipelines
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions
+///
+/// The above copyright notice and this permission notice shall be included in all
+/// copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+#include <Hyperion/BasicTypes.h>
+#include <Hyperion/Error.h>
+#include <Hyperion/FmtIO.h>
+#include <Hyperion/Result.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <string>
+#include <string_view>
+
+using namespace hyperion; // NOLINT
+
+namespace {
+	constexpr auto NUM_PIPELINES = 500'000_usize;
+	/// @brief Every `ERROR_PERIOD`th pipeline starts from an error
+	constexpr auto ERROR_PERIOD = 8_usize;
+	/// @brief Long enough that copying the payload allocates
+	constexpr auto PAYLOAD = std::string_view("  hyperion::Result combinator pipeline payload  ");
+
+	using PipelineResult = Result<std::string, error::AnyError>;
+
+	template<typename Function>
+	auto measure(std::string_view name, Function&& function) noexcept -> void {
+		const auto start = std::chrono::steady_clock::now();
+		const auto checksum = function();
+		const auto elapsed = std::chrono::steady_clock::now() - start;
+		const auto nanoseconds
+			= std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+		println("{:<48} {:>10.2f} ns/pipeline (checksum {})",
+				name,
+				static_cast<f64>(nanoseconds) / static_cast<f64>(NUM_PIPELINES),
+				checksum);
+	}
+
+	[[nodiscard]] auto source(usize index) noexcept -> PipelineResult {
+		if(index % ERROR_PERIOD == 0_usize) {
+			return Err(error::AnyError(error::SystemError(EINVAL)));
+		}
+
+		return Ok(std::string(PAYLOAD));
+	}
+
+	// The stages of the pipeline, in copying (const reference) and consuming (rvalue) flavors.
+	// They do the same work; the copying ones just have to make their own string to do it in
+
+	[[nodiscard]] auto trim(std::string&& value) noexcept -> std::string {
+		const auto first = value.find_first_not_of(' ');
+		const auto last = value.find_last_not_of(' ');
+		value.erase(last + 1_usize);
+		value.erase(0_usize, first);
+		return std::move(value);
+	}
+
+	[[nodiscard]] auto to_upper(std::string&& value) noexcept -> std::string {
+		std::transform(value.begin(), value.end(), value.begin(), [](char character) {
+			return static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+		});
+		return std::move(value);
+	}
+
+	[[nodiscard]] auto annotate(std::string&& value) noexcept -> std::string {
+		value.append(" [checked]");
+		return std::move(value);
+	}
+
+	[[nodiscard]] auto trim_copy(const std::string& value) noexcept -> std::string {
+		return trim(std::string(value));
+	}
+
+	[[nodiscard]] auto to_upper_copy(const std::string& value) noexcept -> std::string {
+		return to_upper(std::string(value));
+	}
+
+	[[nodiscard]] auto annotate_copy(const std::string& value) noexcept -> std::string {
+		return annotate(std::string(value));
+	}
+
+	[[nodiscard]] auto length(const std::string& value) noexcept -> usize {
+		return value.size();
+	}
+} // namespace
+
+auto main([[maybe_unused]] i32 argc, [[maybe_unused]] char** argv) -> i32 { // NOLINT
+	println("{} pipelines of map(trim).map(to_upper).map(annotate).map_or(length) over "
+			"Result<std::string, AnyError>, 1 in {} starting from an error",
+			NUM_PIPELINES,
+			ERROR_PERIOD);
+
+	measure("const& combinators (copy at every stage)", []() noexcept {
+		auto checksum = 0_usize;
+		for(auto i = 0_usize; i < NUM_PIPELINES; ++i) {
+			const auto result = source(i);
+			const auto trimmed = result.map(trim_copy);
+			const auto upper = trimmed.map(to_upper_copy);
+			const auto annotated = upper.map(annotate_copy);
+			checksum += annotated.map_or(length, 0_usize);
+		}
+		return checksum;
+	});
+
+	measure("&& combinators (move through every stage)", []() noexcept {
+		auto checksum = 0_usize;
+		for(auto i = 0_usize; i < NUM_PIPELINES; ++i) {
+			checksum += source(i)
+							.map(trim)
+							.map(to_upper)
+							.map(annotate)
+							.map_or(length, 0_usize);
+		}
+		return checksum;
+	});
+
+	return 0;
+}
@@ -0,0 +1,69 @@
+/// @file Backtrace.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Process-wide symbol cache for lazily symbolized backtraces
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/error/Backtrace.h>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace hyperion {
+
+	/// @brief The process-wide address -> symbol cache backing `backtrace::symbolize`
+	///
+	/// Entries are never evicted, and `std::unordered_map` never relocates its elements, so the
+	/// views handed out by `symbolize` remain valid for the lifetime of the process.
+	struct SymbolCache {
+		std::mutex mutex;
+		std::unordered_map<backtrace::address_type, std::string> symbols;
+	};
+
+	[[nodiscard]] static inline auto symbol_cache() noexcept -> SymbolCache& {
+		// intentionally leaked so that backtraces can still be symbolized during static
+		// destruction (e.g. while panicking from a destructor)
+		static auto* cache = new SymbolCache(); // NOLINT(cppcoreguidelines-owning-memory)
+		return *cache;
+	}
+
+	auto backtrace::symbolize(address_type address) -> std::string_view {
+		auto& cache = symbol_cache();
+		const auto lock = std::scoped_lock(cache.mutex);
+		if(const auto iter = cache.symbols.find(address); iter != cache.symbols.end()) {
+			return iter->second;
+		}
+
+		// symbolizing can be slow (it may need to read debug info from disk), but doing it while
+		// holding the lock keeps each address from being resolved more than once
+		const auto [iter, _]
+			= cache.symbols.emplace(address, boost::stacktrace::to_string(frame_type(address)));
+		return iter->second;
+	}
+
+	auto backtrace::cached_symbols() noexcept -> usize {
+		auto& cache = symbol_cache();
+		const auto lock = std::scoped_lock(cache.mutex);
+		return cache.symbols.size();
+	}
+} // namespace hyperion
@@ -0,0 +1,320 @@
+/// @file CrashReporter.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Async-signal-safe crash reporting for fatal signals
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/HyperionDef.h>
+#include <Hyperion/error/Backtrace.h>
+#include <Hyperion/error/CrashReporter.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+
+#if HYPERION_PLATFORM_UNIX
+	#include <cerrno>
+	#include <csignal>
+	#include <signal.h>
+	#include <unistd.h>
+#endif
+
+namespace hyperion::error {
+
+#if HYPERION_PLATFORM_UNIX
+	static constexpr auto FATAL_SIGNALS
+		= std::array<i32, 5>{SIGSEGV, SIGABRT, SIGBUS, SIGFPE, SIGILL}; // NOLINT
+
+	IGNORE_PADDING_START
+
+	/// @brief Everything the signal handlers need, in static storage, so that reporting never
+	/// allocates and keeps working during static destruction
+	struct CrashReporterState {
+		std::atomic<i32> fd = -1;
+		std::atomic_flag reporting;
+		bool installed = false;
+		// one more than the maximum header size, for the terminating newline
+		std::array<char, CrashReporter::MAX_HEADER_SIZE + 1_usize> header = {};
+		usize header_size = 0_usize;
+		std::array<struct sigaction, FATAL_SIGNALS.size()> previous_actions = {};
+		alignas(16) std::array<byte, CrashReporter::SIGNAL_STACK_SIZE> signal_stack = {};
+	};
+
+	IGNORE_PADDING_STOP
+
+	static constinit auto state = CrashReporterState(); // NOLINT
+
+	/// @brief Writes all of `size` bytes of `data` to `fd`, retrying on partial writes and
+	/// interruptions. Async-signal-safe
+	static auto write_all(i32 fd, const char* data, usize size) noexcept -> void {
+		while(size > 0_usize) {
+			const auto written = ::write(fd, data, size);
+			if(written < 0) {
+				if(errno == EINTR) {
+					continue;
+				}
+				return;
+			}
+
+			data += written; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			size -= static_cast<usize>(written);
+		}
+	}
+
+	/// @brief Builds one line of a report in a fixed-size buffer and writes it with a single
+	/// `write`. Formats by hand, since nothing in `fmt` is guaranteed to be async-signal-safe
+	class ReportLine {
+	  public:
+		explicit ReportLine(i32 fd) noexcept : m_fd(fd) {
+		}
+
+		auto append(std::string_view str) noexcept -> ReportLine& {
+			const auto count = std::min(str.size(), m_buffer.size() - m_size);
+			std::copy_n(str.begin(), count, std::next(m_buffer.begin(), as_offset(m_size)));
+			m_size += count;
+			return *this;
+		}
+
+		auto append_decimal(u64 value, usize width = 0_usize) noexcept -> ReportLine& {
+			auto digits = std::array<char, 20>(); // NOLINT(readability-magic-numbers)
+			auto count = 0_usize;
+			do {
+				digits.at(digits.size() - ++count) = static_cast<char>('0' + value % 10_u64);
+				value /= 10_u64; // NOLINT(readability-magic-numbers)
+			} while(value != 0_u64);
+
+			for(; width > count; --width) {
+				append(" ");
+			}
+			const auto* first = std::next(digits.data(), as_offset(digits.size() - count));
+			return append(std::string_view(first, count));
+		}
+
+		auto append_hex(std::uintptr_t value) noexcept -> ReportLine& {
+			constexpr auto HEX_DIGITS = std::string_view("0123456789abcdef");
+			auto digits = std::array<char, sizeof(std::uintptr_t) * 2_usize>();
+			for(auto iter = digits.rbegin(); iter != digits.rend(); ++iter) {
+				*iter = HEX_DIGITS[value & 15_usize]; // NOLINT(readability-magic-numbers)
+				value >>= 4_usize;					  // NOLINT(readability-magic-numbers)
+			}
+
+			return append("0x").append(std::string_view(digits.data(), digits.size()));
+		}
+
+		auto write() noexcept -> void {
+			write_all(m_fd, m_buffer.data(), m_size);
+			m_size = 0_usize;
+		}
+
+	  private:
+		static constexpr usize LINE_SIZE = 256;
+
+		std::array<char, LINE_SIZE> m_buffer = {};
+		usize m_size = 0_usize;
+		i32 m_fd;
+
+		[[nodiscard]] static constexpr auto as_offset(usize value) noexcept -> std::ptrdiff_t {
+			return static_cast<std::ptrdiff_t>(value);
+		}
+	};
+
+	[[nodiscard]] static constexpr auto signal_name(i32 signal) noexcept -> std::string_view {
+		switch(signal) {
+			case SIGSEGV: return "SIGSEGV";
+			case SIGABRT: return "SIGABRT";
+			case SIGBUS: return "SIGBUS";
+			case SIGFPE: return "SIGFPE";
+			case SIGILL: return "SIGILL";
+			default: return "unknown signal";
+		}
+	}
+
+	/// @brief Returns the disposition `signal` had before the reporter was installed
+	[[nodiscard]] static auto previous_action(i32 signal) noexcept -> struct sigaction {
+		for(auto i = 0_usize; i < FATAL_SIGNALS.size(); ++i) {
+			if(FATAL_SIGNALS.at(i) == signal) {
+				return state.previous_actions.at(i);
+			}
+		}
+
+		return {};
+	}
+
+	/// @brief Returns whether `action` invokes a handler, as opposed to the default or ignore
+	/// dispositions
+	[[nodiscard]] static auto has_handler(const struct sigaction& action) noexcept -> bool {
+		if((action.sa_flags & SA_SIGINFO) != 0) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+			return action.sa_sigaction != nullptr;
+		}
+
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+		return action.sa_handler != SIG_DFL && action.sa_handler != SIG_IGN;
+	}
+
+	static auto handle_fatal_signal(i32 signal, siginfo_t* info, [[maybe_unused]] void* context)
+		-> void {
+		const auto saved_errno = errno;
+
+		// only the first thread to crash writes a report, the others just go down with it
+		if(!state.reporting.test_and_set(std::memory_order_acq_rel)) {
+			CrashReporter::write_report(signal, signal == SIGABRT ? nullptr : info->si_addr);
+		}
+
+		// chain to the disposition that was installed before the reporter, so the process goes
+		// down the way it would have without it. If there was no handler (or the signal was
+		// ignored, which a fatal signal can't meaningfully be), fall back to the default
+		// disposition
+		auto action = previous_action(signal);
+		if(!has_handler(action)) {
+			action = {};
+			action.sa_handler = SIG_DFL; // NOLINT(cppcoreguidelines-pro-type-union-access)
+			sigemptyset(&action.sa_mask);
+		}
+		sigaction(signal, &action, nullptr);
+
+		errno = saved_errno;
+		// a hardware fault recurs when the faulting instruction is retried, delivering the
+		// original `siginfo_t` to the restored disposition. A signal sent by a process
+		// (`raise`, `abort`, `kill`) has to be re-raised. The re-raised signal is blocked until
+		// this returns
+		if(info == nullptr || info->si_code <= 0) {
+			raise(signal);
+		}
+	}
+
+	auto CrashReporter::install(i32 fd, std::string_view header) noexcept -> bool {
+		const auto header_size = std::min(header.size(), MAX_HEADER_SIZE);
+		std::copy_n(header.begin(), header_size, state.header.begin());
+		state.header.at(header_size) = '\n';
+		state.header_size = header_size + 1_usize;
+		state.fd.store(fd, std::memory_order_release);
+
+		if(state.installed) {
+			return true;
+		}
+
+		auto stack = stack_t{};
+		stack.ss_sp = state.signal_stack.data();
+		stack.ss_size = state.signal_stack.size();
+		stack.ss_flags = 0;
+		ignore(sigaltstack(&stack, nullptr));
+
+		struct sigaction action = {};
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+		action.sa_sigaction = &handle_fatal_signal;
+		action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+		sigemptyset(&action.sa_mask);
+
+		for(auto i = 0_usize; i < FATAL_SIGNALS.size(); ++i) {
+			if(sigaction(FATAL_SIGNALS.at(i), &action, &state.previous_actions.at(i)) != 0) {
+				// roll back the handlers installed so far
+				for(auto j = 0_usize; j < i; ++j) {
+					sigaction(FATAL_SIGNALS.at(j), &state.previous_actions.at(j), nullptr);
+				}
+				state.fd.store(-1, std::memory_order_release);
+				return false;
+			}
+		}
+
+		state.installed = true;
+		return true;
+	}
+
+	auto CrashReporter::uninstall() noexcept -> void {
+		if(!state.installed) {
+			return;
+		}
+
+		for(auto i = 0_usize; i < FATAL_SIGNALS.size(); ++i) {
+			sigaction(FATAL_SIGNALS.at(i), &state.previous_actions.at(i), nullptr);
+		}
+
+		// only disable the alternate stack if it's still ours
+		auto stack = stack_t{};
+		if(sigaltstack(nullptr, &stack) == 0 && stack.ss_sp == state.signal_stack.data()) {
+			stack.ss_flags = SS_DISABLE;
+			ignore(sigaltstack(&stack, nullptr));
+		}
+
+		state.fd.store(-1, std::memory_order_release);
+		state.installed = false;
+	}
+
+	auto CrashReporter::is_installed() noexcept -> bool {
+		return state.installed;
+	}
+
+	auto CrashReporter::write_report(i32 signal, const void* address) noexcept -> void {
+		const auto fd = state.fd.load(std::memory_order_acquire);
+		if(fd < 0) {
+			return;
+		}
+
+		// skip this frame, so the trace starts at the signal handler (or whoever called this)
+		const auto trace = hyperion::backtrace(1_usize);
+
+		write_all(fd, state.header.data(), state.header_size);
+
+		auto line = ReportLine(fd);
+		line.append("Fatal signal ")
+			.append_decimal(static_cast<u64>(signal))
+			.append(" (")
+			.append(signal_name(signal))
+			.append(")");
+		if(address != nullptr) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			line.append(" at address ").append_hex(reinterpret_cast<std::uintptr_t>(address));
+		}
+		line.append("\nBacktrace:\n").write();
+
+		for(auto i = 0_usize; i < trace.size(); ++i) {
+			line.append_decimal(i, 2_usize)
+				.append("# ")
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+				.append_hex(reinterpret_cast<std::uintptr_t>(trace.address(i)))
+				.append("\n")
+				.write();
+		}
+	}
+#else
+	auto CrashReporter::install([[maybe_unused]] i32 fd,
+								[[maybe_unused]] std::string_view header) noexcept -> bool {
+		return false;
+	}
+
+	auto CrashReporter::uninstall() noexcept -> void {
+	}
+
+	auto CrashReporter::is_installed() noexcept -> bool {
+		return false;
+	}
+
+	auto CrashReporter::write_report([[maybe_unused]] i32 signal,
+									 [[maybe_unused]] const void* address) noexcept -> void {
+	}
+#endif // HYPERION_PLATFORM_UNIX
+} // namespace hyperion::error
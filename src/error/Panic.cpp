@@ -1,6 +1,141 @@
 
 #include <Hyperion/error/Panic.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
 
 namespace hyperion::error {
-	std::atomic<Panic::handler_type> Panic::handler = Panic::get_default_handler(); // NOLINT
+	std::atomic<Panic::handler_type> Panic::handler = Panic::get_default_handler();	// NOLINT
+	std::atomic<Panic::flush_hook_type> Panic::flush_hook = nullptr;				// NOLINT
+
+	IGNORE_PADDING_START
+
+	struct PanicHook {
+		Panic::hook_type hook = nullptr;
+		i32 order = Panic::DEFAULT_HOOK_ORDER;
+	};
+
+	/// @brief The registered panic hooks, kept sorted by order so that invoking them while
+	/// panicking is a plain walk over a copy of the table
+	struct PanicHookRegistry {
+		std::mutex mutex;
+		/// @brief Held while the hooks are running, so concurrent panics wait for them
+		std::timed_mutex invoke_mutex;
+		std::array<PanicHook, Panic::MAX_HOOKS> hooks = {};
+		usize size = 0_usize;
+	};
+
+	IGNORE_PADDING_STOP
+
+	[[nodiscard]] static inline auto hook_registry() noexcept -> PanicHookRegistry& {
+		// intentionally leaked so that hooks can still be run when panicking during static
+		// destruction
+		static auto* registry = new PanicHookRegistry(); // NOLINT(cppcoreguidelines-owning-memory)
+		return *registry;
+	}
+
+	/// @brief Removes `hook` from `registry`. `registry.mutex` must be held
+	static inline auto
+	remove_hook(PanicHookRegistry& registry, Panic::hook_type hook) noexcept -> bool {
+		const auto begin = registry.hooks.begin();
+		const auto end = std::next(begin, static_cast<std::ptrdiff_t>(registry.size));
+		const auto iter = std::find_if(begin, end, [hook](const PanicHook& registered) noexcept {
+			return registered.hook == hook;
+		});
+		if(iter == end) {
+			return false;
+		}
+
+		std::move(std::next(iter), end, iter);
+		--registry.size;
+		return true;
+	}
+
+	auto Panic::register_hook(hook_type hook, i32 order) noexcept -> bool {
+		if(hook == nullptr) {
+			return false;
+		}
+
+		auto& registry = hook_registry();
+		const auto lock = std::scoped_lock(registry.mutex);
+		ignore(remove_hook(registry, hook));
+		if(registry.size == MAX_HOOKS) {
+			return false;
+		}
+
+		// insert after every hook with an order <= `order`, so equal orders run in the order
+		// they were registered
+		const auto begin = registry.hooks.begin();
+		const auto end = std::next(begin, static_cast<std::ptrdiff_t>(registry.size));
+		const auto iter = std::find_if(begin, end, [order](const PanicHook& registered) noexcept {
+			return registered.order > order;
+		});
+		std::move_backward(iter, end, std::next(end));
+		*iter = PanicHook{hook, order};
+		++registry.size;
+		return true;
+	}
+
+	auto Panic::unregister_hook(hook_type hook) noexcept -> bool {
+		auto& registry = hook_registry();
+		const auto lock = std::scoped_lock(registry.mutex);
+		return remove_hook(registry, hook);
+	}
+
+	auto Panic::registered_hooks() noexcept -> usize {
+		auto& registry = hook_registry();
+		const auto lock = std::scoped_lock(registry.mutex);
+		return registry.size;
+	}
+
+	auto Panic::set_flush_hook(flush_hook_type hook) noexcept -> void {
+		if(auto* previous = flush_hook.exchange(hook, std::memory_order_seq_cst);
+		   previous != nullptr)
+		{
+			ignore(unregister_hook(previous));
+		}
+
+		if(hook != nullptr) {
+			ignore(register_hook(hook, FLUSH_HOOK_ORDER));
+		}
+	}
+
+	auto Panic::invoke_hooks() noexcept -> void {
+		// a panic from within a hook on this thread would deadlock waiting on itself, so skip
+		// the hooks instead of re-entering them
+		thread_local auto is_invoking = false;
+		if(is_invoking) {
+			return;
+		}
+
+		auto& registry = hook_registry();
+		// another thread panicking concurrently may be in the middle of persisting state (e.g.
+		// flushing the logger), so wait for it to finish instead of racing on to the handler
+		// and terminating the process underneath it
+		const auto invoke_lock
+			= std::unique_lock(registry.invoke_mutex, CONCURRENT_PANIC_TIMEOUT);
+		if(!invoke_lock.owns_lock()) {
+			return;
+		}
+
+		is_invoking = true;
+
+		// run the hooks from a copy, so a hook (un)registering hooks can't deadlock or
+		// invalidate the walk
+		auto hooks = std::array<PanicHook, MAX_HOOKS>();
+		auto size = 0_usize;
+		{
+			const auto lock = std::scoped_lock(registry.mutex);
+			hooks = registry.hooks;
+			size = registry.size;
+		}
+
+		for(auto i = 0_usize; i < size; ++i) {
+			hooks[i].hook(); // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+		}
+
+		is_invoking = false;
+	}
 } // namespace hyperion::error
@@ -135,7 +135,11 @@ namespace hyperion::fs {
 						return Err(error::SystemError(error::SystemDomain::get_last_error()));
 					}
 
-					auto buffer = make_unique<buffer_type>(buffer_size);
+					const auto& buffer_options = LargePages::current_options();
+					auto buffer = buffer_pointer(
+						static_cast<element_type*>(
+							LargePages::allocate(buffer_size, buffer_options)),
+						LargePageDeleter<element_type>(buffer_size, buffer_options));
 
 					if(std::setvbuf(file, buffer.get(), _IOFBF, buffer_size) != 0) {
 						ignore(std::fclose(file)); // NOLINT
@@ -0,0 +1,214 @@
+/// @file LevelRegistry.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Runtime-adjustable logging levels for tags
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/filesystem/File.h>
+#include <Hyperion/logging/LevelRegistry.h>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hyperion::logging {
+
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	[[nodiscard]] auto level_from_string(std::string_view name) noexcept -> Option<Level> {
+		constexpr auto levels = std::array<std::pair<std::string_view, Level>, 6>{{
+			{"DISABLED", Level::DISABLED},
+			{"MESSAGE", Level::MESSAGE},
+			{"TRACE", Level::TRACE},
+			{"INFO", Level::INFO},
+			{"WARN", Level::WARN},
+			{"ERROR", Level::ERROR},
+		}};
+
+		const auto iter = std::ranges::find_if(levels, [name](const auto& level) noexcept {
+			return std::ranges::equal(name, level.first, [](char lhs, char rhs) noexcept {
+				return std::toupper(static_cast<unsigned char>(lhs)) == rhs;
+			});
+		});
+
+		if(iter == levels.end()) {
+			return None();
+		}
+
+		return Some(iter->second);
+	}
+
+	// tags are never removed from the registry, so `TagData`s have stable addresses for the
+	// lifetime of the program and `Tag`s can safely refer to them without synchronization
+	using TagMap = std::map<std::string, std::unique_ptr<detail::TagData>, std::less<>>;
+
+	struct TagRegistry {
+		std::mutex mutex;
+		TagMap tags;
+	};
+
+	[[nodiscard]] static inline auto get_registry() noexcept -> TagRegistry& {
+		static auto registry = TagRegistry();
+		return registry;
+	}
+
+	// must be called with the registry's mutex held
+	[[nodiscard]] static inline auto
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	find_or_register(TagMap& tags, std::string_view name) noexcept -> detail::TagData* {
+		if(auto iter = tags.find(name); iter != tags.end()) {
+			return iter->second.get();
+		}
+
+		auto data = std::make_unique<detail::TagData>(
+			detail::TagData{.name = std::string(name), .level = LevelRegistry::DEFAULT_LEVEL});
+		auto* ptr = data.get();
+		tags.emplace(std::string(name), std::move(data));
+		return ptr;
+	}
+
+	[[nodiscard]] static inline auto trim(std::string_view str) noexcept -> std::string_view {
+		constexpr auto whitespace = std::string_view(" \t\r\n");
+		const auto first = str.find_first_not_of(whitespace);
+		if(first == std::string_view::npos) {
+			return {};
+		}
+
+		const auto last = str.find_last_not_of(whitespace);
+		return str.substr(first, last - first + 1);
+	}
+
+	[[nodiscard]] auto LevelRegistry::get_tag(std::string_view name) noexcept -> Tag {
+		auto& registry = get_registry();
+		auto lock = std::scoped_lock(registry.mutex);
+		return Tag(find_or_register(registry.tags, name));
+	}
+
+	[[nodiscard]] auto LevelRegistry::get_level(std::string_view name) noexcept -> Option<Level> {
+		auto& registry = get_registry();
+		auto lock = std::scoped_lock(registry.mutex);
+		if(auto iter = registry.tags.find(name); iter != registry.tags.end()) {
+			return Some(iter->second->level.load());
+		}
+
+		return None();
+	}
+
+	auto LevelRegistry::set_level(std::string_view name, Level level) noexcept -> void {
+		auto& registry = get_registry();
+		auto lock = std::scoped_lock(registry.mutex);
+		find_or_register(registry.tags, name)->level.store(level);
+	}
+
+	[[nodiscard]] auto
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	LevelRegistry::apply_config(std::string_view config) noexcept -> Result<usize> {
+		HYPERION_PROFILE_FUNCTION();
+
+		auto assignments = std::vector<std::pair<std::string_view, Level>>();
+		while(!config.empty()) {
+			const auto end = config.find('\n');
+			const auto line = trim(config.substr(0, end));
+			config = end == std::string_view::npos ? std::string_view() : config.substr(end + 1);
+
+			if(line.empty() || line.front() == '#') {
+				continue;
+			}
+
+			const auto separator = line.find('=');
+			if(separator == std::string_view::npos) {
+				return Err(error::SystemError(EINVAL));
+			}
+
+			const auto name = trim(line.substr(0, separator));
+			auto level = level_from_string(trim(line.substr(separator + 1)));
+			if(name.empty() || level.is_none()) {
+				return Err(error::SystemError(EINVAL));
+			}
+
+			assignments.emplace_back(name, level.unwrap());
+		}
+
+		auto& registry = get_registry();
+		auto lock = std::scoped_lock(registry.mutex);
+		for(const auto& [name, level] : assignments) {
+			find_or_register(registry.tags, name)->level.store(level);
+		}
+
+		return Ok(assignments.size());
+	}
+
+	[[nodiscard]] auto
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	LevelRegistry::apply_config_file(const std::filesystem::path& path) noexcept
+		-> Result<usize> {
+		HYPERION_PROFILE_FUNCTION();
+
+		auto err_code = std::error_code();
+		const auto size = std::filesystem::file_size(path, err_code);
+		if(err_code.value() != 0) {
+			return Err(
+				error::SystemError(static_cast<error::SystemError::value_type>(err_code.value())));
+		}
+
+		return fs::File::open(path,
+							  {.type = fs::File::AccessType::Read,
+							   .modifier = fs::File::AccessModifier::None})
+			.and_then([size](fs::File file) noexcept { return file.read(size); })
+			.and_then([](std::string contents) noexcept {
+				// `read` pads with null characters if fewer than `size` characters were read
+				return apply_config(std::string_view(contents.c_str()));
+			});
+	}
+
+	LevelConfigWatcher::LevelConfigWatcher(std::filesystem::path path,
+										   std::chrono::milliseconds poll_interval) noexcept
+		: m_path(std::move(path)), m_poll_interval(poll_interval) {
+		m_thread = std::thread([this]() noexcept { watch(); });
+	}
+
+	LevelConfigWatcher::~LevelConfigWatcher() noexcept {
+		{
+			auto lock = std::scoped_lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+		m_thread.join();
+	}
+
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	auto LevelConfigWatcher::watch() noexcept -> void {
+		auto last_write = std::filesystem::file_time_type::min();
+		auto lock = std::unique_lock(m_mutex);
+		do {
+			auto err_code = std::error_code();
+			const auto write_time = std::filesystem::last_write_time(m_path, err_code);
+			if(err_code.value() == 0 && write_time != last_write) {
+				last_write = write_time;
+				ignore(LevelRegistry::apply_config_file(m_path));
+			}
+		} while(!m_condition.wait_for(lock, m_poll_interval, [this]() noexcept { return m_stop; }));
+	}
+} // namespace hyperion::logging
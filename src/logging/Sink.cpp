@@ -91,20 +91,24 @@ namespace hyperion::logging {
 
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	auto FileSink::sink(const Entry& entry) noexcept -> void {
-		if(entry.level() >= m_log_level) {
-			auto res = m_file.println("{}", entry.entry());
+		if(entry.level() >= m_log_level.load()) {
+			auto res = m_file.println("{}{}", entry.entry(), entry.context());
 			ignore(res.is_ok());
 		}
 	}
 
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	auto FileSink::sink(Entry&& entry) noexcept -> void {
-		if(entry.level() >= m_log_level) {
-			auto res = m_file.println("{}", entry.entry());
+		if(entry.level() >= m_log_level.load()) {
+			auto res = m_file.println("{}{}", entry.entry(), entry.context());
 			ignore(res.is_ok());
 		}
 	}
 
+	auto FileSink::flush() noexcept -> void {
+		ignore(m_file.flush());
+	}
+
 	[[nodiscard]] auto
 	// NOLINTNEXTLINE(bugprone-easily-swappable-parameters, bugprone-exception-escape)
 	FileSink::create_file(const std::string& root_file_name,
@@ -128,32 +132,32 @@ namespace hyperion::logging {
 	template<>
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	auto StdoutSink<SinkTextStyle::Styled>::sink(const Entry& entry) noexcept -> void {
-		if(entry.level() >= m_log_level) {
-			println(entry.style(), "{}", entry.entry());
+		if(entry.level() >= m_log_level.load()) {
+			println(entry.style(), "{}{}", entry.entry(), entry.context());
 		}
 	}
 
 	template<>
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	auto StdoutSink<SinkTextStyle::NotStyled>::sink(const Entry& entry) noexcept -> void {
-		if(entry.level() >= m_log_level) {
-			println("{}", entry.entry());
+		if(entry.level() >= m_log_level.load()) {
+			println("{}{}", entry.entry(), entry.context());
 		}
 	}
 
 	template<>
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	auto StdoutSink<SinkTextStyle::Styled>::sink(Entry&& entry) noexcept -> void {
-		if(entry.level() >= m_log_level) {
-			println(entry.style(), "{}", entry.entry());
+		if(entry.level() >= m_log_level.load()) {
+			println(entry.style(), "{}{}", entry.entry(), entry.context());
 		}
 	}
 
 	template<>
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	auto StdoutSink<SinkTextStyle::NotStyled>::sink(Entry&& entry) noexcept -> void {
-		if(entry.level() >= m_log_level) {
-			println("{}", entry.entry());
+		if(entry.level() >= m_log_level.load()) {
+			println("{}{}", entry.entry(), entry.context());
 		}
 	}
 
@@ -0,0 +1,189 @@
+/// @file Thread.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Platform implementations for logging thread placement
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/logging/Thread.h>
+#include <initializer_list>
+
+#if HYPERION_PLATFORM_WINDOWS
+	#include <Windows.h>
+#elif HYPERION_PLATFORM_LINUX
+	#include <pthread.h>
+	#include <sched.h>
+	#include <sys/resource.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#elif HYPERION_PLATFORM_UNIX
+	#include <pthread.h>
+	#include <sys/resource.h>
+#endif
+
+namespace hyperion::logging {
+
+#if HYPERION_PLATFORM_LINUX
+	/// @brief The nice value given to threads configured with `ThreadPriority::Low`
+	static constexpr auto LOW_PRIORITY_NICE_VALUE = 10;
+#endif // HYPERION_PLATFORM_LINUX
+
+	[[nodiscard]] static inline auto set_current_thread_name(const std::string& name) noexcept
+		-> Result<None> {
+		if(name.empty()) {
+			return Ok();
+		}
+
+		const auto truncated = name.substr(0, ThreadOptions::MAX_NAME_LENGTH);
+
+#if HYPERION_PLATFORM_WINDOWS
+		auto wide = std::wstring(truncated.begin(), truncated.end());
+		if(FAILED(SetThreadDescription(GetCurrentThread(), wide.c_str()))) {
+			return Err(error::SystemError(error::SystemDomain::get_last_error()));
+		}
+#elif HYPERION_PLATFORM_APPLE
+		if(const auto res = pthread_setname_np(truncated.c_str()); res != 0) {
+			return Err(error::SystemError(res));
+		}
+#elif HYPERION_PLATFORM_LINUX
+		if(const auto res = pthread_setname_np(pthread_self(), truncated.c_str()); res != 0) {
+			return Err(error::SystemError(res));
+		}
+#endif
+
+		return Ok();
+	}
+
+	[[nodiscard]] static inline auto
+	set_current_thread_affinity(const std::vector<usize>& cpus) noexcept -> Result<None> {
+		if(cpus.empty()) {
+			return Ok();
+		}
+
+#if HYPERION_PLATFORM_WINDOWS
+		auto mask = DWORD_PTR(0);
+		for(const auto cpu : cpus) {
+			if(cpu >= sizeof(DWORD_PTR) * 8_usize) {
+				return Err(error::SystemError(ERROR_INVALID_PARAMETER));
+			}
+			mask |= DWORD_PTR(1) << cpu;
+		}
+
+		if(SetThreadAffinityMask(GetCurrentThread(), mask) == 0) {
+			return Err(error::SystemError(error::SystemDomain::get_last_error()));
+		}
+#elif HYPERION_PLATFORM_LINUX
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for(const auto cpu : cpus) {
+			if(cpu >= static_cast<usize>(CPU_SETSIZE)) {
+				return Err(error::SystemError(EINVAL));
+			}
+			CPU_SET(cpu, &set);
+		}
+
+		if(const auto res = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); res != 0) {
+			return Err(error::SystemError(res));
+		}
+#endif
+
+		return Ok();
+	}
+
+	[[nodiscard]] static inline auto
+	set_current_thread_priority(ThreadPriority priority) noexcept -> Result<None> {
+		if(priority == ThreadPriority::Default) {
+			return Ok();
+		}
+
+#if HYPERION_PLATFORM_WINDOWS
+		const auto value = priority == ThreadPriority::Background ? THREAD_PRIORITY_IDLE :
+																	THREAD_PRIORITY_BELOW_NORMAL;
+		if(SetThreadPriority(GetCurrentThread(), value) == 0) {
+			return Err(error::SystemError(error::SystemDomain::get_last_error()));
+		}
+#elif HYPERION_PLATFORM_LINUX
+		if(priority == ThreadPriority::Background) {
+			auto param = sched_param{};
+			param.sched_priority = 0;
+			if(const auto res = pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+			   res != 0)
+			{
+				return Err(error::SystemError(res));
+			}
+
+			return Ok();
+		}
+
+		// on Linux, nice values are per-thread, so we can lower just this thread's priority by
+		// targeting its thread id
+		const auto tid = static_cast<id_t>(syscall(SYS_gettid));
+		if(setpriority(PRIO_PROCESS, tid, LOW_PRIORITY_NICE_VALUE) != 0) {
+			return Err(error::SystemError(error::SystemDomain::get_last_error()));
+		}
+#elif HYPERION_PLATFORM_UNIX
+		// other POSIX systems don't have per-thread nice values, so the closest we can get is the
+		// minimum priority allowed by the thread's current scheduling policy
+		auto policy = 0;
+		auto param = sched_param{};
+		if(const auto res = pthread_getschedparam(pthread_self(), &policy, &param); res != 0) {
+			return Err(error::SystemError(res));
+		}
+
+		param.sched_priority = sched_get_priority_min(policy);
+		if(const auto res = pthread_setschedparam(pthread_self(), policy, &param); res != 0) {
+			return Err(error::SystemError(res));
+		}
+#endif
+
+		return Ok();
+	}
+
+	[[nodiscard]] auto
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	set_current_thread_options(const ThreadOptions& options) noexcept -> Result<None> {
+		HYPERION_PROFILE_FUNCTION();
+
+		auto name = set_current_thread_name(options.name);
+		auto affinity = set_current_thread_affinity(options.cpu_affinity);
+		auto priority = set_current_thread_priority(options.priority);
+
+		for(auto* result : {&name, &affinity, &priority}) {
+			if(result->is_err()) {
+				return Err(result->unwrap_err());
+			}
+		}
+
+		return Ok();
+	}
+
+	[[nodiscard]] auto
+	large_page_options_for(const ThreadOptions& options) noexcept -> LargePageOptions {
+		auto large_page_options = LargePageOptions();
+		if(!options.cpu_affinity.empty()) {
+			large_page_options.numa_node
+				= LargePages::numa_node_of_cpu(options.cpu_affinity.front());
+		}
+
+		return large_page_options;
+	}
+} // namespace hyperion::logging
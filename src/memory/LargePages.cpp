@@ -0,0 +1,229 @@
+/// @file LargePages.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Platform implementations for huge page and NUMA aware allocation
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/memory/LargePageAllocator.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#if HYPERION_PLATFORM_LINUX
+	#include <charconv>
+	#include <filesystem>
+	#include <string>
+	#include <string_view>
+	#include <system_error>
+	#include <sys/mman.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#elif HYPERION_PLATFORM_UNIX
+	#include <sys/mman.h>
+	#include <unistd.h>
+#endif
+
+namespace hyperion {
+
+#if HYPERION_PLATFORM_UNIX
+	/// @brief `mbind` mode preferring a node, but falling back to others when it is full
+	/// (`MPOL_PREFERRED` from `<numaif.h>`, which we don't want to depend on libnuma for)
+	static constexpr auto MPOL_PREFERRED_MODE = 1UL;
+
+	[[nodiscard]] static inline auto page_size() noexcept -> usize {
+		static const auto size = static_cast<usize>(sysconf(_SC_PAGESIZE));
+		return size;
+	}
+
+	[[nodiscard]] static constexpr auto round_up(usize value, usize multiple) noexcept -> usize {
+		return (value + multiple - 1) / multiple * multiple;
+	}
+
+	/// @brief Returns the length of the mapping backing an allocation of `size` bytes
+	[[nodiscard]] static inline auto
+	mapped_length(usize size, const LargePageOptions& options) noexcept -> usize {
+		const auto length = round_up(std::max(size, 1_usize), page_size());
+		if(HYPERION_PLATFORM_LINUX && options.huge_pages != HugePages::None
+		   && length >= LargePages::HUGE_PAGE_SIZE)
+		{
+			return round_up(size, LargePages::HUGE_PAGE_SIZE);
+		}
+
+		return length;
+	}
+
+	[[nodiscard]] static inline auto map(usize length) noexcept -> void* {
+		auto* memory
+			= mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		return memory == MAP_FAILED ? nullptr : memory; // NOLINT(performance-no-int-to-ptr)
+	}
+
+	/// @brief Maps `length` bytes aligned to a huge page boundary, so that every huge page of
+	/// the mapping can be backed by a transparent huge page
+	[[nodiscard]] static inline auto map_huge_page_aligned(usize length) noexcept -> void* {
+		auto* memory = static_cast<std::byte*>(map(length + LargePages::HUGE_PAGE_SIZE));
+		if(memory == nullptr) {
+			return nullptr;
+		}
+
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+		const auto address = reinterpret_cast<std::uintptr_t>(memory);
+		const auto head = round_up(address, LargePages::HUGE_PAGE_SIZE) - address;
+		const auto tail = LargePages::HUGE_PAGE_SIZE - head;
+		if(head != 0_usize) {
+			munmap(memory, head);
+		}
+		if(tail != 0_usize) {
+			munmap(memory + head + length, tail); // NOLINT
+		}
+
+		return memory + head; // NOLINT
+	}
+#endif // HYPERION_PLATFORM_UNIX
+
+#if HYPERION_PLATFORM_LINUX
+	[[nodiscard]] static inline auto
+	map_huge_pages(usize length, HugePages huge_pages) noexcept -> void* {
+		if(huge_pages == HugePages::Explicit) {
+			auto* memory = mmap(nullptr,
+								length,
+								PROT_READ | PROT_WRITE,
+								MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+								-1,
+								0);
+			if(memory != MAP_FAILED) { // NOLINT(performance-no-int-to-ptr)
+				return memory;
+			}
+			// no reserved huge pages available, fall back to transparent ones
+		}
+
+		auto* memory = map_huge_page_aligned(length);
+	#ifdef MADV_HUGEPAGE
+		if(memory != nullptr) {
+			// only advice: failing (e.g. with transparent huge pages disabled) is harmless
+			madvise(memory, length, MADV_HUGEPAGE);
+		}
+	#endif // MADV_HUGEPAGE
+		return memory;
+	}
+
+	static inline auto bind_to_numa_node(void* memory, usize length, i32 node) noexcept -> void {
+		constexpr auto max_nodes = sizeof(unsigned long) * 8_usize; // NOLINT
+		if(node < 0 || static_cast<usize>(node) >= max_nodes) {
+			return;
+		}
+
+		const auto mask = 1UL << static_cast<usize>(node);
+		// only a placement hint: if binding fails the memory is simply placed on first touch
+		syscall(SYS_mbind, memory, length, MPOL_PREFERRED_MODE, &mask, max_nodes + 1_usize, 0U);
+	}
+#endif // HYPERION_PLATFORM_LINUX
+
+	auto LargePages::allocate(usize size, const LargePageOptions& options) noexcept -> void* {
+#if HYPERION_PLATFORM_UNIX
+		if(is_mapped(size, options)) {
+			const auto length = mapped_length(size, options);
+	#if HYPERION_PLATFORM_LINUX
+			auto* memory = length >= HUGE_PAGE_SIZE && options.huge_pages != HugePages::None
+							   ? map_huge_pages(length, options.huge_pages)
+							   : map(length);
+			if(memory != nullptr) {
+				bind_to_numa_node(memory, length, options.numa_node);
+			}
+	#else
+			auto* memory = map(length);
+	#endif // HYPERION_PLATFORM_LINUX
+			if(memory == nullptr) {
+				panic("LargePages: failed to map {} bytes", length);
+			}
+			return memory;
+		}
+#endif // HYPERION_PLATFORM_UNIX
+
+		auto* memory = ::operator new(size, std::nothrow);
+		if(memory == nullptr) {
+			panic("LargePages: failed to allocate {} bytes", size);
+		}
+		return memory;
+	}
+
+	auto LargePages::deallocate(void* ptr,
+								usize size,
+								[[maybe_unused]] const LargePageOptions& options) noexcept -> void {
+		if(ptr == nullptr) {
+			return;
+		}
+
+#if HYPERION_PLATFORM_UNIX
+		if(is_mapped(size, options)) {
+			munmap(ptr, mapped_length(size, options));
+			return;
+		}
+#endif // HYPERION_PLATFORM_UNIX
+
+		::operator delete(ptr, size);
+	}
+
+	auto LargePages::current_numa_node() noexcept -> i32 {
+#if HYPERION_PLATFORM_LINUX
+		auto cpu = 0U;
+		auto node = 0U;
+		if(syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+			return static_cast<i32>(node);
+		}
+#endif // HYPERION_PLATFORM_LINUX
+
+		return LargePageOptions::ANY_NUMA_NODE;
+	}
+
+	auto LargePages::numa_node_of_cpu([[maybe_unused]] usize cpu) noexcept -> i32 {
+#if HYPERION_PLATFORM_LINUX
+		// the CPU's sysfs directory contains a `node<N>` link to the node it belongs to
+		constexpr auto prefix = std::string_view("node");
+		auto error = std::error_code();
+		const auto directory = std::filesystem::path("/sys/devices/system/cpu")
+							   / ("cpu" + std::to_string(cpu));
+		for(auto iterator = std::filesystem::directory_iterator(directory, error);
+			!error && iterator != std::filesystem::directory_iterator();
+			iterator.increment(error))
+		{
+			const auto name = iterator->path().filename().string();
+			if(name.size() <= prefix.size() || !name.starts_with(prefix)) {
+				continue;
+			}
+
+			auto node = 0_i32;
+			const auto* const begin = name.data() + prefix.size(); // NOLINT
+			const auto* const end = name.data() + name.size();	  // NOLINT
+			if(const auto [last, res] = std::from_chars(begin, end, node);
+			   res == std::errc() && last == end)
+			{
+				return node;
+			}
+		}
+#endif // HYPERION_PLATFORM_LINUX
+
+		return LargePageOptions::ANY_NUMA_NODE;
+	}
+} // namespace hyperion
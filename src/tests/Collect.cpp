@@ -0,0 +1,257 @@
+/// @file Collect.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for the `Result` and `Option` aggregation algorithms
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Testing.h>
+#include <Hyperion/result/Collect.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace hyperion {
+	namespace {
+		[[nodiscard]] auto checked_half(i32 value) noexcept -> Result<i32> {
+			if(value % 2_i32 != 0_i32) {
+				return error::SystemError(value);
+			}
+
+			return Ok(value / 2_i32);
+		}
+
+		[[nodiscard]] auto some_if_positive(i32 value) noexcept -> Option<i32> {
+			if(value <= 0_i32) {
+				return None();
+			}
+
+			return Some(value);
+		}
+	} // namespace
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("Collect") {
+		TEST_CASE("collect") {
+			SUBCASE("all ok") {
+				auto results = std::vector<Result<std::unique_ptr<i32>>>();
+				results.emplace_back(Ok(std::make_unique<i32>(1_i32)));
+				results.emplace_back(Ok(std::make_unique<i32>(2_i32)));
+				results.emplace_back(Ok(std::make_unique<i32>(3_i32)));
+
+				// move-only values are moved out of the results
+				auto collected = collect(results);
+				REQUIRE(collected.is_ok());
+				const auto values = collected.unwrap();
+				REQUIRE_EQ(values.size(), 3_usize);
+				CHECK_EQ(*values[0], 1_i32);
+				CHECK_EQ(*values[1], 2_i32);
+				CHECK_EQ(*values[2], 3_i32);
+				CHECK_EQ(values.capacity(), 3_usize);
+			}
+
+			SUBCASE("first error") {
+				auto results = std::vector<Result<i32>>();
+				results.emplace_back(Ok(1_i32));
+				results.emplace_back(error::SystemError(2_i32));
+				results.emplace_back(error::SystemError(3_i32));
+
+				auto collected = collect(std::move(results));
+				REQUIRE(collected.is_err());
+				CHECK_EQ(collected.unwrap_err(), error::SystemError(2_i32));
+			}
+
+			SUBCASE("options") {
+				auto options = std::vector<Option<i32>>{Some(1_i32), Some(2_i32)};
+				auto collected = collect(options);
+				REQUIRE(collected.is_some());
+				CHECK_EQ(collected.unwrap(), std::vector<i32>{1, 2});
+
+				options.push_back(None());
+				CHECK(collect(options).is_none());
+			}
+
+			SUBCASE("views") {
+				auto inputs = std::vector<i32>{2, 4, 6};
+				auto collected = collect(inputs | std::views::transform(checked_half));
+				REQUIRE(collected.is_ok());
+				CHECK_EQ(collected.unwrap(), std::vector<i32>{1, 2, 3});
+			}
+		}
+
+		TEST_CASE("partition_results") {
+			auto results = std::vector<Result<i32>>();
+			results.emplace_back(Ok(1_i32));
+			results.emplace_back(error::SystemError(2_i32));
+			results.emplace_back(Ok(3_i32));
+			results.emplace_back(error::SystemError(4_i32));
+			results.emplace_back(Ok(5_i32));
+
+			auto partitioned = partition_results(results);
+			CHECK_EQ(partitioned.oks, std::vector<i32>{1, 3, 5});
+			REQUIRE_EQ(partitioned.errs.size(), 2_usize);
+			CHECK_EQ(partitioned.errs[0], error::SystemError(2_i32));
+			CHECK_EQ(partitioned.errs[1], error::SystemError(4_i32));
+			// both were sized exactly
+			CHECK_EQ(partitioned.oks.capacity(), 3_usize);
+			CHECK_EQ(partitioned.errs.capacity(), 2_usize);
+		}
+
+		TEST_CASE("try_transform") {
+			auto inputs = std::vector<i32>{2, 4, 5, 6, 7};
+			auto invocations = 0_usize;
+			const auto counted_half = [&invocations](i32 value) noexcept {
+				++invocations;
+				return checked_half(value);
+			};
+
+			SUBCASE("ok") {
+				auto transformed = try_transform(std::vector<i32>{2, 4, 6}, counted_half);
+				REQUIRE(transformed.is_ok());
+				CHECK_EQ(transformed.unwrap(), std::vector<i32>{1, 2, 3});
+			}
+
+			SUBCASE("short circuit") {
+				auto transformed = try_transform(inputs, counted_half);
+				REQUIRE(transformed.is_err());
+				CHECK_EQ(transformed.unwrap_err(), error::SystemError(5_i32));
+				CHECK_EQ(invocations, 3_usize);
+			}
+
+			SUBCASE("exhaustive") {
+				auto transformed = try_transform(inputs, counted_half, CollectPolicy::Exhaustive);
+				REQUIRE(transformed.is_err());
+				CHECK_EQ(transformed.unwrap_err(), error::SystemError(5_i32));
+				CHECK_EQ(invocations, inputs.size());
+			}
+
+			SUBCASE("options") {
+				auto transformed = try_transform(std::vector<i32>{1, 2, 3}, some_if_positive);
+				REQUIRE(transformed.is_some());
+				CHECK_EQ(transformed.unwrap(), std::vector<i32>{1, 2, 3});
+				CHECK(try_transform(std::vector<i32>{1, 0, 3}, some_if_positive).is_none());
+			}
+		}
+
+		TEST_CASE("try_transform_parallel") {
+			constexpr auto num_inputs = 1000_usize;
+			constexpr auto num_threads = 4_usize;
+			auto inputs = std::vector<i32>(num_inputs);
+			std::iota(inputs.begin(), inputs.end(), 0_i32);
+			auto invocations = std::atomic<usize>(0_usize);
+			const auto doubled = [&invocations](i32 value) noexcept -> Result<i32> {
+				invocations.fetch_add(1_usize, std::memory_order_relaxed);
+				return checked_half(value * 2_i32);
+			};
+
+			SUBCASE("ok") {
+				auto transformed = try_transform_parallel(inputs,
+														  doubled,
+														  CollectPolicy::ShortCircuit,
+														  num_threads);
+				REQUIRE(transformed.is_ok());
+				const auto values = transformed.unwrap();
+				CHECK_EQ(values, inputs);
+				CHECK_EQ(values.capacity(), num_inputs);
+			}
+
+			SUBCASE("exhaustive") {
+				// every odd input past the halfway point fails
+				const auto half_odds = [&invocations](i32 value) noexcept -> Result<i32> {
+					invocations.fetch_add(1_usize, std::memory_order_relaxed);
+					return value < static_cast<i32>(num_inputs / 2_usize) ?
+							   Ok(value) :
+							   checked_half(value);
+				};
+				auto transformed = try_transform_parallel(inputs,
+														  half_odds,
+														  CollectPolicy::Exhaustive,
+														  num_threads);
+				REQUIRE(transformed.is_err());
+				// not every code is a valid errno value, so compare the raw codes, not the errors
+				CHECK_EQ(transformed.unwrap_err().code().value(),
+						 static_cast<i64>(num_inputs / 2_usize + 1_usize));
+				CHECK_EQ(invocations.load(), num_inputs);
+			}
+
+			SUBCASE("short circuit") {
+				const auto fails_at_end = [](i32 value) noexcept -> Result<i32> {
+					return value == static_cast<i32>(num_inputs) - 1_i32 ?
+							   Result<i32>(error::SystemError(value)) :
+							   Ok(value);
+				};
+				auto transformed = try_transform_parallel(inputs,
+														  fails_at_end,
+														  CollectPolicy::ShortCircuit,
+														  num_threads);
+				REQUIRE(transformed.is_err());
+				CHECK_EQ(transformed.unwrap_err().code().value(),
+						 static_cast<i64>(num_inputs - 1_usize));
+			}
+
+			SUBCASE("short circuit reports the first error") {
+				// the later chunks fail immediately, while the first one only starts once one of
+				// them has failed (or a while has passed), and fails near its end. So the first
+				// error found is never the first one in range order
+				constexpr auto first_error = static_cast<i32>(num_inputs / num_threads) - 10_i32;
+				auto later_failures = std::atomic<usize>(0_usize);
+				const auto fails_late = [&later_failures](i32 value) noexcept -> Result<i32> {
+					if(value == 0_i32) {
+						const auto deadline
+							= std::chrono::steady_clock::now() + std::chrono::seconds(1);
+						while(later_failures.load() == 0_usize
+							  && std::chrono::steady_clock::now() < deadline)
+						{
+							std::this_thread::yield();
+						}
+					}
+					if(value > first_error) {
+						later_failures.fetch_add(1_usize);
+					}
+
+					return value >= first_error ? Result<i32>(error::SystemError(value)) :
+												  Ok(value);
+				};
+				auto transformed = try_transform_parallel(inputs,
+														  fails_late,
+														  CollectPolicy::ShortCircuit,
+														  num_threads);
+				REQUIRE(transformed.is_err());
+				CHECK_EQ(transformed.unwrap_err().code().value(), static_cast<i64>(first_error));
+				CHECK_NE(later_failures.load(), 0_usize);
+			}
+
+			SUBCASE("single thread") {
+				auto transformed = try_transform_parallel(std::vector<i32>{1},
+														  doubled,
+														  CollectPolicy::ShortCircuit,
+														  num_threads);
+				REQUIRE(transformed.is_ok());
+				CHECK_EQ(transformed.unwrap(), std::vector<i32>{1});
+			}
+		}
+	}
+} // namespace hyperion
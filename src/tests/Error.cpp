@@ -0,0 +1,327 @@
+/// @file Error.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for Error and AnyError
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Error.h>
+#include <Hyperion/Testing.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A domain whose codes carry a string, so its `Error`s are too large to be stored inline in an
+// `AnyError`
+STATUS_CODE_DOMAIN(
+	TestContextDomain /**NOLINT**/,
+	TestContext,
+	hyperion::error::tests,
+	std::string,
+	false,
+	"6d0c3cc6-35c2-4e34-9b5a-5a4c1e1bfa0d",
+	"TestContextDomain",
+	std::string(),
+	std::string("unknown"),
+	[](const std::string& code) noexcept -> std::string { return "context: " + code; },
+	[](const std::string& code) noexcept -> hyperion::error::GenericStatusCode {
+		hyperion::ignore(code);
+		return {};
+	});
+
+namespace hyperion::error::tests {
+	enum class TestEnum : i8 {
+		Success = 0,
+		Busy = 1,
+		Missing = 2,
+		Unknown = -1
+	};
+} // namespace hyperion::error::tests
+
+// A domain with a one-byte value type, so its conversion to `Errno` is backed by a
+// `GenericCodeTable`
+STATUS_CODE_DOMAIN(
+	TestEnumDomain /**NOLINT**/,
+	TestEnum,
+	hyperion::error::tests,
+	hyperion::error::tests::TestEnum,
+	true,
+	"0f2b7d8e-5c61-4c1a-9a0e-2f7b9d4c3e15",
+	"TestEnumDomain",
+	hyperion::error::tests::TestEnum::Success,
+	hyperion::error::tests::TestEnum::Unknown,
+	[](hyperion::error::tests::TestEnum code) noexcept -> std::string_view {
+		return code == value_type::Success ? "Success" : "Failure";
+	},
+	[](hyperion::error::tests::TestEnum code) noexcept -> hyperion::error::GenericStatusCode {
+		switch(code) {
+			case value_type::Success: return make_status_code(hyperion::error::Errno::Success);
+			case value_type::Busy:
+				return make_status_code(hyperion::error::Errno::DeviceOrResourceBusy);
+			case value_type::Missing:
+				return make_status_code(hyperion::error::Errno::NoSuchFileOrDirectory);
+			default: return make_status_code(hyperion::error::Errno::Unknown);
+		}
+	});
+
+namespace hyperion::error {
+	namespace {
+		/// @brief An error aligned more strictly than `operator new` guarantees by default
+		struct alignas(64) OverAlignedError final : public ErrorBase { // NOLINT
+			[[nodiscard]] auto message() const noexcept -> std::string final {
+				return "over-aligned";
+			}
+
+			[[nodiscard]] auto to_string() const noexcept -> std::string final {
+				return message();
+			}
+
+			[[nodiscard]] auto clone() const noexcept -> hyperion::UniquePtr<ErrorBase> final {
+				return hyperion::make_unique<OverAlignedError>(*this);
+			}
+		};
+	} // namespace
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("Error") {
+		static_assert(!detail::any_error::stored_inline<tests::TestContextError>);
+
+		TEST_CASE("Error") {
+			const auto error = GenericError(Errno::InvalidArgument);
+			CHECK_EQ(error.code().code(), Errno::InvalidArgument);
+			CHECK_EQ(error.message(), "Invalid argument.");
+
+			// default constructed errors represent an unknown error
+			const auto unknown = SystemError();
+			CHECK(unknown.code().is_error());
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("AnyError") {
+			const auto posix = PosixError(EINVAL);
+			auto error = AnyError(posix);
+			CHECK(error.is_inline());
+			CHECK_EQ(error.message(), posix.message());
+			CHECK_EQ(error.get<0>(), static_cast<i64>(EINVAL));
+
+			SUBCASE("default") {
+				const auto unknown = AnyError();
+				CHECK(unknown.is_inline());
+				CHECK_EQ(unknown.message(), SystemError().message());
+			}
+
+			SUBCASE("copy") {
+				// NOLINTNEXTLINE(performance-unnecessary-copy-initialization)
+				const auto copy = error;
+				CHECK(copy.is_inline());
+				CHECK_EQ(copy.message(), posix.message());
+				CHECK_EQ(error.message(), posix.message());
+			}
+
+			SUBCASE("move") {
+				const auto moved = std::move(error);
+				CHECK_EQ(moved.message(), posix.message());
+				// NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+				CHECK_EQ(error.message(), AnyError().message());
+			}
+
+			SUBCASE("assignment") {
+				error = GenericError(Errno::NotEnoughMemory);
+				CHECK(error.is_inline());
+				CHECK_EQ(error.message(), GenericError(Errno::NotEnoughMemory).message());
+			}
+
+			SUBCASE("heap") {
+				const auto context = tests::TestContextError(
+					make_error_code<tests::TestContextDomain>(std::string("file not found")));
+				auto large = AnyError(context);
+				CHECK_FALSE(large.is_inline());
+				CHECK_EQ(large.message(), "context: file not found");
+				CHECK_EQ(large.get<0>(), -1_i64);
+
+				auto copy = large;
+				CHECK_FALSE(copy.is_inline());
+				CHECK_EQ(copy.message(), "context: file not found");
+
+				auto moved = std::move(large);
+				CHECK_EQ(moved.message(), "context: file not found");
+				// NOLINTNEXTLINE(bugprone-use-after-move,hicpp-invalid-access-moved)
+				CHECK(large.is_inline());
+
+				// replacing a heap-held error with an inline one and vice versa
+				copy = error;
+				CHECK(copy.is_inline());
+				CHECK_EQ(copy.message(), posix.message());
+				error = std::move(moved);
+				CHECK_FALSE(error.is_inline());
+				CHECK_EQ(error.message(), "context: file not found");
+			}
+		}
+
+		TEST_CASE("OverAligned") {
+			const auto error = OverAlignedError();
+			auto clones = std::vector<hyperion::UniquePtr<ErrorBase>>();
+			for(auto i = 0_usize; i < 16_usize; ++i) { // NOLINT(readability-magic-numbers)
+				clones.push_back(error.clone());
+				CHECK_EQ(reinterpret_cast<std::uintptr_t>(clones.back().get()) // NOLINT
+							 % alignof(OverAlignedError),
+						 0_usize);
+				CHECK_EQ(clones.back()->message(), "over-aligned");
+			}
+		}
+
+		TEST_CASE("message_view") {
+			static_assert(StatusCodeDomainWithMessageView<PosixDomain>);
+			static_assert(StatusCodeDomainWithMessageView<GenericDomain>);
+			static_assert(StatusCodeDomainWithMessageView<SystemDomain>);
+			static_assert(!StatusCodeDomainWithMessageView<tests::TestContextDomain>);
+			static_assert(GenericDomain().message_view(Errno::InvalidArgument)
+						  == "Invalid argument.");
+
+			SUBCASE("PosixDomain") {
+				const auto posix = PosixError(EINVAL);
+				CHECK_EQ(posix.message_view(), posix.message());
+				CHECK_EQ(std::string_view(posix.message_as_cstr()), posix.message());
+				// messages live in a table shared by every lookup
+				CHECK_EQ(posix.message_view().data(), PosixError(EINVAL).message_view().data());
+
+				const auto domain = PosixDomain();
+				for(auto code = 0_i64; code < static_cast<i64>(PosixDomain::MESSAGE_TABLE_SIZE);
+					++code)
+				{
+					CHECK_EQ(domain.message_view(code), domain.message(code));
+				}
+				CHECK_EQ(domain.message_view(-1_i64), "Unknown error.");
+			}
+
+			SUBCASE("AnyError") {
+				const auto error = AnyError(GenericError(Errno::InvalidArgument));
+				CHECK(error.has_message_view());
+				CHECK_EQ(error.message_view(), "Invalid argument.");
+
+				const auto context = AnyError(tests::TestContextError(
+					make_error_code<tests::TestContextDomain>(std::string("missing"))));
+				CHECK_FALSE(context.has_message_view());
+				CHECK(context.message_view().empty());
+			}
+
+			SUBCASE("format") {
+				CHECK_EQ(fmt::format("{}", GenericError(Errno::InvalidArgument)),
+						 "Invalid argument.");
+				CHECK_EQ(fmt::format("{}", AnyError(PosixError(EINVAL))),
+						 PosixError(EINVAL).message());
+				CHECK_EQ(fmt::format("{}",
+									 AnyError(tests::TestContextError(
+										 make_error_code<tests::TestContextDomain>(
+											 std::string("missing"))))),
+						 "context: missing");
+			}
+		}
+
+		TEST_CASE("equivalence") {
+			using tests::TestEnum;
+			using tests::TestEnumDomain;
+			using tests::TestEnumStatusCode;
+
+			static_assert(StatusCodeDomainWithGenericErrno<GenericDomain>);
+			static_assert(StatusCodeDomainWithGenericErrno<PosixDomain>);
+			static_assert(StatusCodeDomainWithGenericErrno<SystemDomain>);
+			static_assert(StatusCodeDomainWithGenericErrno<TestEnumDomain>);
+			static_assert(!StatusCodeDomainWithGenericErrno<tests::TestContextDomain>);
+
+			// conversions are available (and table-backed) at compile time
+			static_assert(PosixDomain::to_generic_errno(EINVAL) == Errno::InvalidArgument);
+			static_assert(PosixDomain::to_generic_errno(-1) == Errno::Unknown);
+			static_assert(TestEnumDomain().to_generic_errno(TestEnum::Busy)
+						  == Errno::DeviceOrResourceBusy);
+			static_assert(TestEnumDomain().to_generic_errno(static_cast<TestEnum>(42))
+						  == Errno::Unknown);
+			static_assert(
+				are_equivalent_via_errno(TestEnumStatusCode(TestEnum::Missing),
+										 GenericStatusCode(Errno::NoSuchFileOrDirectory)));
+
+			SUBCASE("PosixDomain") {
+				const auto posix = PosixStatusCode(EBUSY);
+				CHECK(posix == GenericStatusCode(Errno::DeviceOrResourceBusy));
+				CHECK(GenericStatusCode(Errno::DeviceOrResourceBusy) == posix);
+				CHECK(posix == PosixStatusCode(EBUSY));
+				CHECK_FALSE(posix == GenericStatusCode(Errno::Interrupted));
+				// unknown codes are never equivalent
+				CHECK_FALSE(PosixStatusCode(-1) == PosixStatusCode(-1));
+				CHECK_FALSE(PosixStatusCode(-1) == GenericStatusCode(Errno::Unknown));
+
+				// the table agrees with `GenericDomain` for every code it covers
+				constexpr auto table_size = static_cast<i64>(PosixDomain::GENERIC_CODE_TABLE_SIZE);
+				for(auto code = 0_i64; code < table_size; ++code) {
+					const auto generic = PosixDomain::to_generic_errno(code);
+					if(generic != Errno::Unknown) {
+						CHECK_EQ(static_cast<i64>(generic), code);
+					}
+				}
+			}
+
+			SUBCASE("STATUS_CODE_DOMAIN") {
+				const auto busy = TestEnumStatusCode(TestEnum::Busy);
+				CHECK(busy == GenericStatusCode(Errno::DeviceOrResourceBusy));
+				CHECK(GenericStatusCode(Errno::DeviceOrResourceBusy) == busy);
+				CHECK(busy == PosixStatusCode(EBUSY));
+				CHECK(PosixStatusCode(EBUSY) == busy);
+				CHECK(busy == TestEnumStatusCode(TestEnum::Busy));
+				CHECK_FALSE(busy == TestEnumStatusCode(TestEnum::Missing));
+				CHECK_FALSE(busy == PosixStatusCode(ENOENT));
+				CHECK_FALSE(TestEnumStatusCode(TestEnum::Unknown)
+							== TestEnumStatusCode(TestEnum::Unknown));
+			}
+		}
+
+		TEST_CASE("Backtrace") {
+			static_assert(std::is_trivially_copyable_v<backtrace>);
+			static_assert(sizeof(backtrace) <= (backtrace::MAX_FRAMES + 2) * sizeof(void*));
+
+			const auto trace = backtrace();
+			REQUIRE_FALSE(trace.empty());
+			CHECK_LE(trace.size(), backtrace::MAX_FRAMES);
+			CHECK_NE(trace.address(0), nullptr);
+			CHECK_EQ(trace[0].address(), trace.address(0));
+
+			SUBCASE("symbols are resolved once and cached") {
+				const auto symbol = trace.symbol(0);
+				const auto cached = backtrace::cached_symbols();
+				CHECK_GE(cached, 1_usize);
+				CHECK_FALSE(symbol.empty());
+
+				const auto copy = trace; // NOLINT(performance-unnecessary-copy-initialization)
+				CHECK_EQ(copy.symbol(0).data(), symbol.data());
+				CHECK_EQ(backtrace::cached_symbols(), cached);
+			}
+
+			SUBCASE("format") {
+				const auto formatted = fmt::format("{}", trace);
+				CHECK_EQ(formatted, to_string(trace));
+				CHECK_EQ(static_cast<usize>(std::count(formatted.begin(), formatted.end(), '\n')),
+						 trace.size());
+				CHECK_GE(backtrace::cached_symbols(), trace.size());
+			}
+		}
+	}
+} // namespace hyperion::error
@@ -0,0 +1,151 @@
+/// @file ErrorOrigin.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for error origin tracking in Result
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Result.h>
+#include <Hyperion/Testing.h>
+#include <source_location>
+#include <string_view>
+#include <vector>
+
+namespace hyperion {
+	namespace {
+		struct OriginTestError {
+			i32 code = 0;
+		};
+
+		struct OriginTestMappedError {
+			i32 code = 0;
+		};
+
+		constexpr auto FAILING_LINE = __LINE__ + 3;
+		[[nodiscard]] auto fail_deepest() noexcept -> Result<i32, OriginTestError> {
+			// NOLINTNEXTLINE(readability-magic-numbers)
+			return Err(OriginTestError{42});
+		}
+
+		[[nodiscard]] auto fail_deeper() noexcept -> Result<i32, OriginTestError> {
+			auto result = fail_deepest();
+			if(result.is_err()) {
+				return result;
+			}
+
+			return Ok(result.unwrap() + 1);
+		}
+
+		[[nodiscard]] auto fail() noexcept -> Result<i32, OriginTestError> {
+			return fail_deeper().map([](i32 value) noexcept { return value * 2; });
+		}
+	} // namespace
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("ErrorOrigin") {
+		// origin tracking is configured once for the whole build (see
+		// `HYPERION_RESULT_TRACKS_ERROR_ORIGIN`), so these check whichever mode this is built in
+		TEST_CASE("ErrorOrigin") {
+			// the backtrace lives behind a pointer, so carrying an origin (e.g. in a `Result`
+			// holding a value) costs at most a location and a pointer
+			static_assert(sizeof(result::ErrorOrigin)
+						  <= sizeof(std::source_location) + sizeof(void*));
+
+			SUBCASE("Err records its origin") {
+				const auto err = Err(OriginTestError{1});
+				const auto line = __LINE__ - 1;
+				CHECK_EQ(err.origin().has_location(), result::ErrorOrigin::TRACKED);
+				if(result::ErrorOrigin::TRACKED) {
+					CHECK_EQ(err.origin().location().line(), line);
+					CHECK_EQ(std::string_view(err.origin().location().file_name()),
+							 std::string_view(std::source_location::current().file_name()));
+				}
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+				CHECK_FALSE(err.origin().backtrace().empty());
+#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+			}
+
+			SUBCASE("origin survives propagation") {
+				const auto expected_line = result::ErrorOrigin::TRACKED ? FAILING_LINE : 0;
+				auto result = fail();
+				REQUIRE(result.is_err());
+				CHECK_EQ(result.error_origin().location().line(), expected_line);
+
+				auto mapped = fail().map_err([](const OriginTestError& error) noexcept {
+					return OriginTestMappedError{error.code};
+				});
+				REQUIRE(mapped.is_err());
+				CHECK_EQ(mapped.error_origin().location().line(), expected_line);
+
+				auto chained = fail().and_then([](i32 value) noexcept { return value; });
+				REQUIRE(chained.is_err());
+				CHECK_EQ(chained.error_origin().location().line(), expected_line);
+
+				const auto copy = result;
+				CHECK_EQ(copy.error_origin().location().line(), expected_line);
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+				CHECK_FALSE(result.error_origin().backtrace().empty());
+				// copies share the backtrace instead of copying it
+				CHECK_EQ(&copy.error_origin().backtrace(), &result.error_origin().backtrace());
+#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+			}
+
+			SUBCASE("Ok has an unknown origin") {
+				const auto result = Result<i32, OriginTestError>(Ok(1_i32));
+				CHECK_FALSE(result.error_origin().has_location());
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+				CHECK(result.error_origin().backtrace().empty());
+#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+				CHECK_EQ(fmt::format("{}", result.error_origin()), "unknown");
+			}
+
+#if HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+			SUBCASE("exhausted backtrace pool falls back to location only") {
+				auto errors = std::vector<Err<OriginTestError>>();
+				errors.reserve(result::ErrorOrigin::BACKTRACE_POOL_CAPACITY + 1);
+				for(auto i = 0_usize; i <= result::ErrorOrigin::BACKTRACE_POOL_CAPACITY; ++i) {
+					errors.push_back(Err(OriginTestError{static_cast<i32>(i)}));
+					CHECK(errors.back().origin().has_location());
+				}
+				CHECK(errors.back().origin().backtrace().empty());
+
+				// backtraces are returned to the pool once every copy of their origin is gone
+				errors.clear();
+				const auto err = Err(OriginTestError{1});
+				CHECK_FALSE(err.origin().backtrace().empty());
+			}
+#endif // HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE
+
+			SUBCASE("format") {
+				const auto result = fail();
+				const auto formatted = fmt::format("{}", result.error_origin());
+				if(result::ErrorOrigin::TRACKED) {
+					CHECK_NE(formatted.find(fmt::format(":{}:", FAILING_LINE)), std::string::npos);
+					CHECK_NE(formatted.find("fail_deepest"), std::string::npos);
+				}
+				else {
+					CHECK_EQ(formatted, "unknown");
+				}
+			}
+		}
+	}
+} // namespace hyperion
@@ -0,0 +1,552 @@
+/// @file Logger.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for Logger
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Logger.h>
+#include <Hyperion/logging/SinkGroup.h>
+#include <Hyperion/Testing.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <fstream>
+#include <thread>
+
+#if HYPERION_PLATFORM_LINUX
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+namespace hyperion { // NOLINT
+	namespace detail::logger::test {
+		IGNORE_PADDING_START
+		/// Sink that only counts the entries it receives, so tests can observe when entries
+		/// have actually reached the sinks
+		class CountingSink final : public logging::SinkBase {
+		  public:
+			explicit CountingSink(std::atomic<usize>& count,
+								  std::atomic<usize>& flushes) noexcept
+				: m_count(&count), m_flushes(&flushes) {
+			}
+			CountingSink(const CountingSink&) noexcept = default;
+			CountingSink(CountingSink&&) noexcept = default;
+			~CountingSink() noexcept final = default;
+
+			auto sink([[maybe_unused]] const logging::Entry& entry) noexcept -> void final {
+				m_count->fetch_add(1_usize);
+			}
+			auto sink([[maybe_unused]] logging::Entry&& entry) noexcept -> void final {
+				m_count->fetch_add(1_usize);
+			}
+			[[nodiscard]] auto get_log_level() const noexcept -> logging::Level final {
+				return logging::Level::MESSAGE;
+			}
+			auto set_log_level([[maybe_unused]] logging::Level level) noexcept -> void final {
+			}
+			auto flush() noexcept -> void final {
+				m_flushes->fetch_add(1_usize);
+			}
+
+			auto operator=(const CountingSink&) noexcept -> CountingSink& = default;
+			auto operator=(CountingSink&&) noexcept -> CountingSink& = default;
+
+		  private:
+			std::atomic<usize>* m_count;
+			std::atomic<usize>* m_flushes;
+		};
+
+		/// Sink that records the formatted context of the last entry it received
+		class ContextSink final : public logging::SinkBase {
+		  public:
+			explicit ContextSink(std::string& context) noexcept : m_context(&context) {
+			}
+			ContextSink(const ContextSink&) noexcept = default;
+			ContextSink(ContextSink&&) noexcept = default;
+			~ContextSink() noexcept final = default;
+
+			auto sink(const logging::Entry& entry) noexcept -> void final {
+				*m_context = fmt::format("{}", entry.context());
+			}
+			auto sink(logging::Entry&& entry) noexcept -> void final {
+				*m_context = fmt::format("{}", entry.context());
+			}
+			[[nodiscard]] auto get_log_level() const noexcept -> logging::Level final {
+				return logging::Level::MESSAGE;
+			}
+			auto set_log_level([[maybe_unused]] logging::Level level) noexcept -> void final {
+			}
+
+			auto operator=(const ContextSink&) noexcept -> ContextSink& = default;
+			auto operator=(ContextSink&&) noexcept -> ContextSink& = default;
+
+		  private:
+			std::string* m_context;
+		};
+
+		/// Sink whose flush blocks until the test releases it, to stand in for a stuck sink
+		class BlockingSink final : public logging::SinkBase {
+		  public:
+			explicit BlockingSink(std::atomic_bool& released) noexcept : m_released(&released) {
+			}
+			BlockingSink(const BlockingSink&) noexcept = default;
+			BlockingSink(BlockingSink&&) noexcept = default;
+			~BlockingSink() noexcept final = default;
+
+			auto sink([[maybe_unused]] const logging::Entry& entry) noexcept -> void final {
+			}
+			auto sink([[maybe_unused]] logging::Entry&& entry) noexcept -> void final {
+			}
+			[[nodiscard]] auto get_log_level() const noexcept -> logging::Level final {
+				return logging::Level::MESSAGE;
+			}
+			auto set_log_level([[maybe_unused]] logging::Level level) noexcept -> void final {
+			}
+			auto flush() noexcept -> void final {
+				while(!m_released->load()) {
+					std::this_thread::sleep_for(std::chrono::milliseconds(1));
+				}
+			}
+
+			auto operator=(const BlockingSink&) noexcept -> BlockingSink& = default;
+			auto operator=(BlockingSink&&) noexcept -> BlockingSink& = default;
+
+		  private:
+			std::atomic_bool* m_released;
+		};
+		IGNORE_PADDING_STOP
+
+		template<logging::ThreadingPolicy Threading>
+		using TestParameters
+			= logging::Parameters<logging::Policy<Threading, logging::AsyncPolicy::BlockWhenFull>,
+								  logging::LoggingLevel<logging::Level::MESSAGE>>;
+
+		template<logging::ThreadingPolicy Threading>
+		inline auto check_flush() noexcept -> void {
+			static constexpr auto num_entries = 200_usize;
+			auto count = std::atomic<usize>(0_usize);
+			auto flushes = std::atomic<usize>(0_usize);
+			auto sinks = logging::Sinks();
+			sinks.push_back(logging::make_sink<CountingSink>(count, flushes));
+			auto logger = Logger<TestParameters<Threading>>(std::move(sinks));
+			auto& base = static_cast<detail::ILogger&>(logger);
+
+			for(auto i = 0_usize; i < num_entries; ++i) {
+				CHECK(base.template log<logging::Level::ERROR>(None(), "entry {}", i).is_ok());
+			}
+
+			CHECK(logger.flush(std::chrono::seconds(5)).is_ok());
+			CHECK_EQ(count.load(), num_entries);
+			CHECK_GE(flushes.load(), 1_usize);
+		}
+
+		/// Returns a CPU this process is allowed to run on, so pinning to it succeeds even in a
+		/// restricted cpuset (containers, `taskset`)
+		inline auto allowed_cpu() noexcept -> usize {
+#if HYPERION_PLATFORM_LINUX
+			auto set = cpu_set_t{};
+			CPU_ZERO(&set);
+			if(sched_getaffinity(0, sizeof(set), &set) == 0) {
+				for(auto cpu = 0_usize; cpu < static_cast<usize>(CPU_SETSIZE); ++cpu) {
+					if(CPU_ISSET(cpu, &set)) {
+						return cpu;
+					}
+				}
+			}
+#endif
+			return 0_usize;
+		}
+	} // namespace detail::logger::test
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("Logger") {
+		TEST_CASE("flush") {
+			using detail::logger::test::check_flush;
+
+			SUBCASE("SingleThreaded") {
+				check_flush<logging::ThreadingPolicy::SingleThreaded>();
+			}
+
+			SUBCASE("SingleThreadedAsync") {
+				check_flush<logging::ThreadingPolicy::SingleThreadedAsync>();
+			}
+
+			SUBCASE("MultiThreaded") {
+				check_flush<logging::ThreadingPolicy::MultiThreaded>();
+			}
+
+			SUBCASE("MultiThreadedAsync") {
+				check_flush<logging::ThreadingPolicy::MultiThreadedAsync>();
+			}
+
+			SUBCASE("while_logging") {
+				using detail::logger::test::CountingSink;
+				using Parameters = detail::logger::test::TestParameters<
+					logging::ThreadingPolicy::MultiThreadedAsync>;
+
+				auto count = std::atomic<usize>(0_usize);
+				auto flushes = std::atomic<usize>(0_usize);
+				auto sinks = logging::Sinks();
+				sinks.push_back(logging::make_sink<CountingSink>(count, flushes));
+				auto logger = Logger<Parameters>(std::move(sinks));
+				auto& base = static_cast<detail::ILogger&>(logger);
+
+				// a producer that never stops logging mustn't be able to hold a flush off
+				auto stop = std::atomic_bool(false);
+				auto producer = std::thread([&base, &stop]() noexcept {
+					while(!stop.load()) {
+						ignore(base.template log<logging::Level::ERROR>(None(), "entry"));
+					}
+				});
+
+				for(auto i = 0; i < 10; ++i) {
+					CHECK(logger.flush(std::chrono::seconds(5)).is_ok());
+				}
+				CHECK_GE(flushes.load(), 10_usize);
+
+				stop.store(true);
+				producer.join();
+			}
+		}
+
+		TEST_CASE("Levels") {
+			using detail::logger::test::CountingSink;
+			using Parameters = detail::logger::test::TestParameters<
+				logging::ThreadingPolicy::SingleThreaded>;
+
+			auto count = std::atomic<usize>(0_usize);
+			auto flushes = std::atomic<usize>(0_usize);
+			auto sinks = logging::Sinks();
+			sinks.push_back(logging::make_sink<CountingSink>(count, flushes));
+			auto logger = Logger<Parameters>(std::move(sinks));
+			auto& base = static_cast<detail::ILogger&>(logger);
+
+			SUBCASE("logger") {
+				CHECK_EQ(base.get_minimum_level(), logging::Level::MESSAGE);
+				CHECK(base.template log<logging::Level::INFO>(None(), "info").is_ok());
+				CHECK_EQ(count.load(), 1_usize);
+
+				base.set_minimum_level(logging::Level::INFO);
+				CHECK_FALSE(base.is_enabled(logging::Level::INFO));
+				CHECK(base.is_enabled(logging::Level::WARN));
+				CHECK(base.template log<logging::Level::INFO>(None(), "info").is_ok());
+				CHECK(base.template log<logging::Level::WARN>(None(), "warn").is_ok());
+				CHECK_EQ(count.load(), 2_usize);
+			}
+
+			SUBCASE("tag") {
+				auto tag = logging::LevelRegistry::get_tag("tests.logger.tag");
+				CHECK_EQ(tag.name(), "tests.logger.tag");
+				CHECK_EQ(tag.level(), logging::LevelRegistry::DEFAULT_LEVEL);
+				CHECK(base.template log<logging::Level::TRACE>(tag, None(), "trace").is_ok());
+				CHECK_EQ(count.load(), 1_usize);
+
+				// an unconfigured tag doesn't filter anything, not even MESSAGE entries
+				auto fresh = logging::LevelRegistry::get_tag("tests.logger.fresh_tag");
+				CHECK(fresh.is_enabled(logging::Level::MESSAGE));
+				base.set_minimum_level(logging::Level::DISABLED);
+				CHECK(base.template log<logging::Level::MESSAGE>(fresh, None(), "message").is_ok());
+				CHECK_EQ(count.load(), 2_usize);
+				base.set_minimum_level(logging::Level::MESSAGE);
+
+				logging::LevelRegistry::set_level("tests.logger.tag", logging::Level::INFO);
+				CHECK_EQ(tag.level(), logging::Level::INFO);
+				CHECK_FALSE(tag.is_enabled(logging::Level::INFO));
+				CHECK(tag.is_enabled(logging::Level::WARN));
+				CHECK(base.template log<logging::Level::TRACE>(tag, None(), "trace").is_ok());
+				CHECK(base.template log<logging::Level::INFO>(tag, None(), "info").is_ok());
+				CHECK(base.template log<logging::Level::WARN>(tag, None(), "warn").is_ok());
+				CHECK_EQ(count.load(), 3_usize);
+
+				// a tag's level is an exclusive minimum, exactly like the logger's
+				base.set_minimum_level(logging::Level::INFO);
+				CHECK_EQ(tag.is_enabled(logging::Level::INFO),
+						 base.is_enabled(logging::Level::INFO));
+				CHECK_EQ(tag.is_enabled(logging::Level::WARN),
+						 base.is_enabled(logging::Level::WARN));
+			}
+
+			SUBCASE("sink") {
+				auto sink = logging::StdoutSink<>(logging::Level::WARN);
+				CHECK_EQ(sink.get_log_level(), logging::Level::WARN);
+				sink.set_log_level(logging::Level::TRACE);
+				CHECK_EQ(sink.get_log_level(), logging::Level::TRACE);
+			}
+
+			SUBCASE("level_from_string") {
+				CHECK_EQ(logging::level_from_string("warn").unwrap(), logging::Level::WARN);
+				CHECK_EQ(logging::level_from_string("ERROR").unwrap(), logging::Level::ERROR);
+				CHECK(logging::level_from_string("verbose").is_none());
+			}
+
+			SUBCASE("apply_config") {
+				auto applied = logging::LevelRegistry::apply_config(
+					"# comment\n\n tests.logger.a = TRACE \ntests.logger.b=error\n");
+				CHECK_EQ(applied.unwrap(), 2_usize);
+				CHECK_EQ(logging::LevelRegistry::get_level("tests.logger.a").unwrap(),
+						 logging::Level::TRACE);
+				CHECK_EQ(logging::LevelRegistry::get_level("tests.logger.b").unwrap(),
+						 logging::Level::ERROR);
+
+				// malformed configurations are rejected without applying any of their levels
+				CHECK(logging::LevelRegistry::apply_config("tests.logger.a = INFO\nnonsense\n")
+						  .is_err());
+				CHECK_EQ(logging::LevelRegistry::get_level("tests.logger.a").unwrap(),
+						 logging::Level::TRACE);
+				CHECK(logging::LevelRegistry::get_level("tests.logger.unregistered").is_none());
+			}
+
+			SUBCASE("LevelConfigWatcher") {
+				const auto path = std::filesystem::temp_directory_path()
+								  / "hyperion_tests_logger_levels.conf";
+				{
+					auto file = std::ofstream(path);
+					file << "tests.logger.watched = ERROR\n";
+				}
+
+				CHECK_EQ(logging::LevelRegistry::apply_config_file(path).unwrap(), 1_usize);
+				logging::LevelRegistry::set_level("tests.logger.watched", logging::Level::INFO);
+
+				{
+					auto watcher
+						= logging::LevelConfigWatcher(path, std::chrono::milliseconds(10));
+					const auto deadline
+						= std::chrono::steady_clock::now() + std::chrono::seconds(5);
+					while(logging::LevelRegistry::get_level("tests.logger.watched").unwrap()
+							  != logging::Level::ERROR
+						  && std::chrono::steady_clock::now() < deadline)
+					{
+						std::this_thread::sleep_for(std::chrono::milliseconds(1));
+					}
+				}
+
+				CHECK_EQ(logging::LevelRegistry::get_level("tests.logger.watched").unwrap(),
+						 logging::Level::ERROR);
+				std::filesystem::remove(path);
+			}
+		}
+
+		TEST_CASE("Context") {
+			auto& current = logging::ContextSnapshot::current();
+			CHECK(current.empty());
+
+			SUBCASE("ScopedContext") {
+				{
+					const auto request = logging::ScopedContext("request_id", "abc123");
+					const auto tenant = logging::ScopedContext("tenant", 42_i32);
+					CHECK_EQ(current.size(), 2_usize);
+					CHECK_EQ(current.begin()->key(), "request_id");
+					CHECK_EQ(current.begin()->value(), "abc123");
+					CHECK_EQ(fmt::format("{}", current), " {request_id=abc123 tenant=42}");
+				}
+
+				CHECK(current.empty());
+				CHECK_EQ(fmt::format("{}", current), "");
+			}
+
+			SUBCASE("ContextHandle") {
+				static_assert(sizeof(logging::ContextHandle) == sizeof(void*));
+				CHECK(logging::ContextHandle::capture().empty());
+
+				const auto request = logging::ScopedContext("request_id", "abc123");
+				const auto first = logging::ContextHandle::capture();
+				const auto second = logging::ContextHandle::capture();
+				REQUIRE(!first.empty());
+				// an unchanged context is shared, not copied again
+				CHECK_EQ(&first.snapshot(), &second.snapshot());
+
+				{
+					const auto tenant = logging::ScopedContext("tenant", 42_i32);
+					const auto third = logging::ContextHandle::capture();
+					CHECK_NE(&first.snapshot(), &third.snapshot());
+					CHECK_EQ(fmt::format("{}", third.snapshot()),
+							 " {request_id=abc123 tenant=42}");
+				}
+
+				// captured contexts are unaffected by later changes
+				CHECK_EQ(fmt::format("{}", first.snapshot()), " {request_id=abc123}");
+
+				auto entry = logging::Entry(logging::InfoEntry("message"));
+				entry.capture_context();
+				CHECK_EQ(fmt::format("{}", entry.context()), " {request_id=abc123}");
+			}
+
+			SUBCASE("capacity") {
+				const auto first = logging::ScopedContext("a", "1");
+				const auto second = logging::ScopedContext("b", "2");
+				const auto third = logging::ScopedContext("c", "3");
+				const auto fourth = logging::ScopedContext("d", "4");
+				{
+					const auto dropped = logging::ScopedContext("e", "5");
+					CHECK_EQ(current.size(), logging::ContextSnapshot::CAPACITY);
+				}
+				CHECK_EQ(current.size(), logging::ContextSnapshot::CAPACITY);
+
+				const auto long_value = std::string(100_usize, 'x');
+				auto field = logging::ContextField("a_very_long_key_indeed", long_value);
+				CHECK_EQ(field.key().size(), logging::ContextField::KEY_CAPACITY);
+				CHECK_EQ(field.value().size(), logging::ContextField::VALUE_CAPACITY);
+			}
+
+			SUBCASE("Logger") {
+				using Parameters = detail::logger::test::TestParameters<
+					logging::ThreadingPolicy::SingleThreadedAsync>;
+				auto context = std::string();
+				auto sinks = logging::Sinks();
+				sinks.push_back(logging::make_sink<detail::logger::test::ContextSink>(context));
+				auto logger = Logger<Parameters>(std::move(sinks));
+				auto& base = static_cast<detail::ILogger&>(logger);
+
+				{
+					const auto span = logging::ScopedContext("span", "7f");
+					CHECK(base.template log<logging::Level::ERROR>(None(), "entry").is_ok());
+				}
+				CHECK(logger.flush(std::chrono::seconds(5)).is_ok());
+				CHECK_EQ(context, " {span=7f}");
+			}
+		}
+
+		TEST_CASE("SinkGroup") {
+			using detail::logger::test::CountingSink;
+			using Parameters = detail::logger::test::TestParameters<
+				logging::ThreadingPolicy::SingleThreadedAsync>;
+			static constexpr auto num_entries = 500_usize;
+
+			auto direct_count = std::atomic<usize>(0_usize);
+			auto first_count = std::atomic<usize>(0_usize);
+			auto second_count = std::atomic<usize>(0_usize);
+			auto flushes = std::atomic<usize>(0_usize);
+
+			auto first_group = logging::Sinks();
+			first_group.push_back(logging::make_sink<CountingSink>(first_count, flushes));
+			auto second_group = logging::Sinks();
+			second_group.push_back(logging::make_sink<CountingSink>(second_count, flushes));
+
+			auto sinks = logging::Sinks();
+			sinks.push_back(logging::make_sink<CountingSink>(direct_count, flushes));
+			sinks.push_back(logging::make_sink<logging::SinkGroup<>>(std::move(first_group)));
+			sinks.push_back(logging::make_sink<logging::SinkGroup<>>(std::move(second_group)));
+			auto logger = Logger<Parameters>(std::move(sinks));
+			auto& base = static_cast<detail::ILogger&>(logger);
+
+			for(auto i = 0_usize; i < num_entries; ++i) {
+				CHECK(base.template log<logging::Level::ERROR>(None(), "entry {}", i).is_ok());
+			}
+
+			SUBCASE("flush") {
+				CHECK(logger.flush(std::chrono::seconds(5)).is_ok());
+				CHECK_EQ(direct_count.load(), num_entries);
+				CHECK_EQ(first_count.load(), num_entries);
+				CHECK_EQ(second_count.load(), num_entries);
+				CHECK_EQ(flushes.load(), 3_usize);
+			}
+
+			SUBCASE("level") {
+				auto count = std::atomic<usize>(0_usize);
+				auto group_sinks = logging::Sinks();
+				group_sinks.push_back(logging::make_sink<CountingSink>(count, flushes));
+				auto group = logging::SinkGroup<>(std::move(group_sinks));
+				group.set_log_level(logging::Level::ERROR);
+
+				group.sink(logging::make_entry<logging::entry_level_t<logging::Level::INFO>>(
+					FMT_COMPILE("{}"),
+					"info"));
+				group.sink(logging::make_entry<logging::entry_level_t<logging::Level::ERROR>>(
+					FMT_COMPILE("{}"),
+					"error"));
+				group.flush();
+				CHECK_EQ(count.load(), 1_usize);
+			}
+
+			SUBCASE("bounded_flush") {
+				auto released = std::atomic_bool(false);
+				auto count = std::atomic<usize>(0_usize);
+				auto stuck_group = logging::Sinks();
+				stuck_group.push_back(
+					logging::make_sink<detail::logger::test::BlockingSink>(released));
+				auto stuck_sinks = logging::Sinks();
+				stuck_sinks.push_back(logging::make_sink<CountingSink>(count, flushes));
+				stuck_sinks.push_back(
+					logging::make_sink<logging::SinkGroup<>>(std::move(stuck_group)));
+				auto stuck_logger = Logger<Parameters>(std::move(stuck_sinks));
+				auto& stuck_base = static_cast<detail::ILogger&>(stuck_logger);
+				CHECK(stuck_base.template log<logging::Level::ERROR>(None(), "entry").is_ok());
+
+				// a stuck group makes the flush time out, instead of blocking the logging thread
+				const auto start = std::chrono::steady_clock::now();
+				CHECK(stuck_logger.flush(std::chrono::milliseconds(50)).is_err());
+				CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(2));
+
+				// the other sinks were still written to and flushed
+				CHECK_EQ(count.load(), 1_usize);
+
+				released.store(true);
+				CHECK(stuck_logger.flush(std::chrono::seconds(5)).is_ok());
+			}
+		}
+
+		TEST_CASE("ThreadOptions") {
+			auto options = logging::ThreadOptions();
+			options.name = "HyperionTestLoggerThread";
+			options.cpu_affinity = {detail::logger::test::allowed_cpu()};
+			options.priority = logging::ThreadPriority::Low;
+
+			SUBCASE("set_current_thread_options") {
+				auto applied = false;
+				auto name = std::string();
+				auto thread = std::thread([&]() {
+					applied = logging::set_current_thread_options(options).is_ok();
+#if HYPERION_PLATFORM_LINUX
+					auto buffer = std::array<char, 16>{};
+					ignore(pthread_getname_np(pthread_self(), buffer.data(), buffer.size()));
+					name = buffer.data();
+#else
+					name = options.name.substr(0, logging::ThreadOptions::MAX_NAME_LENGTH);
+#endif
+				});
+				thread.join();
+
+				CHECK(applied);
+				CHECK_EQ(name, options.name.substr(0, logging::ThreadOptions::MAX_NAME_LENGTH));
+			}
+
+			SUBCASE("Logger") {
+				using Parameters = detail::logger::test::TestParameters<
+					logging::ThreadingPolicy::MultiThreadedAsync>;
+				auto count = std::atomic<usize>(0_usize);
+				auto flushes = std::atomic<usize>(0_usize);
+				auto sinks = logging::Sinks();
+				sinks.push_back(
+					logging::make_sink<detail::logger::test::CountingSink>(count, flushes));
+				auto logger = Logger<Parameters>(std::move(sinks), options);
+				auto& base = static_cast<detail::ILogger&>(logger);
+
+				CHECK(base.template log<logging::Level::ERROR>(None(), "entry").is_ok());
+				CHECK(logger.flush(std::chrono::seconds(5)).is_ok());
+				CHECK_EQ(count.load(), 1_usize);
+			}
+		}
+	}
+} // namespace hyperion
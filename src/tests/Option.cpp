@@ -24,6 +24,8 @@
 /// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
 /// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 /// IN THE SOFTWARE.
+#include <Hyperion/Memory.h>
+#include <Hyperion/NonZero.h>
 #include <Hyperion/Option.h>
 #include <Hyperion/Result.h>
 #include <Hyperion/Testing.h>
@@ -242,4 +244,71 @@ namespace hyperion {
 			move_test(std::move(none));
 		}
 	}
+
+	TEST_CASE("Layout") {
+		static_assert(sizeof(Option<i32&>) == sizeof(i32*));
+		static_assert(sizeof(Option<const i32&>) == sizeof(const i32*));
+		static_assert(sizeof(Option<i32*>) == sizeof(i32*));
+		static_assert(sizeof(Option<UniquePtr<i32>>) == sizeof(UniquePtr<i32>));
+		static_assert(sizeof(Option<NonZero<u32>>) == sizeof(u32));
+		static_assert(sizeof(Option<u8>) == 2_usize);
+
+		static_assert(std::is_trivially_copyable_v<Option<i32>>);
+		static_assert(std::is_trivially_copyable_v<Option<i32&>>);
+		static_assert(std::is_trivially_copyable_v<Option<i32*>>);
+		static_assert(std::is_trivially_copyable_v<Option<NonZero<u64>>>);
+		static_assert(!std::is_trivially_copyable_v<Option<UniquePtr<i32>>>);
+		static_assert(!std::is_trivially_copyable_v<Option<std::string>>);
+
+		SUBCASE("reference") {
+			auto value = 3_i32;
+			Option<i32&> some(value);
+			Option<i32&> none = None();
+
+			CHECK(some.is_some());
+			CHECK(none.is_none());
+			some.as_ref() = 4_i32;
+			CHECK_EQ(value, 4_i32);
+
+			none = some;
+			CHECK(none.is_some());
+			CHECK_EQ(&none.as_ref(), &value);
+		}
+
+		SUBCASE("pointer") {
+			auto value = 3_i32;
+			Option<i32*> some = Some(&value);
+			Option<i32*> null = Some(static_cast<i32*>(nullptr));
+
+			CHECK(some.is_some());
+			CHECK_EQ(some.unwrap(), &value);
+			// the niche of a pointer is `nullptr`, so `Some(nullptr)` is `None`
+			CHECK(null.is_none());
+		}
+
+		SUBCASE("UniquePtr") {
+			Option<UniquePtr<i32>> some = Some(make_unique<i32>(3_i32));
+			Option<UniquePtr<i32>> empty = Some(UniquePtr<i32>());
+
+			CHECK(some.is_some());
+			CHECK(empty.is_none());
+			CHECK_EQ(*some.as_cref(), 3_i32);
+
+			auto moved = std::move(some);
+			CHECK(moved.is_some());
+			CHECK(some.is_none()); // NOLINT(bugprone-use-after-move)
+
+			auto ptr = moved.unwrap();
+			CHECK_EQ(*ptr, 3_i32);
+		}
+
+		SUBCASE("NonZero") {
+			auto some = NonZero<u32>::make(42_u32);
+			auto none = NonZero<u32>::make(0_u32);
+
+			CHECK(some.is_some());
+			CHECK_EQ(some.unwrap().get(), 42_u32);
+			CHECK(none.is_none());
+		}
+	}
 } // namespace hyperion
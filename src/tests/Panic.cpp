@@ -0,0 +1,272 @@
+/// @file Panic.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for panic hooks and crash reporting
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Fmt.h>
+#include <Hyperion/Testing.h>
+#include <Hyperion/error/CrashReporter.h>
+#include <Hyperion/error/Panic.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if HYPERION_PLATFORM_UNIX
+	#include <csignal>
+	#include <signal.h>
+	#include <unistd.h>
+#endif
+
+namespace hyperion::error {
+	namespace {
+		auto invoked_hooks = std::vector<usize>(); // NOLINT
+
+		template<usize Index>
+		auto record_hook() noexcept -> void {
+			invoked_hooks.push_back(Index);
+		}
+
+		/// @brief Hook that panics (well, invokes the hooks) while the hooks are running
+		auto reentrant_hook() noexcept -> void {
+			invoked_hooks.push_back(5_usize); // NOLINT(readability-magic-numbers)
+			Panic::invoke_hooks();
+		}
+
+		std::atomic_bool slow_hook_started = false;	 // NOLINT
+		std::atomic_bool slow_hook_finished = false; // NOLINT
+		std::atomic<usize> slow_hook_calls = 0_usize; // NOLINT
+
+		/// @brief Hook that takes a while to finish, like flushing a logger does
+		auto slow_hook() noexcept -> void {
+			slow_hook_calls.fetch_add(1_usize);
+			slow_hook_started.store(true);
+			std::this_thread::sleep_for(std::chrono::milliseconds(100)); // NOLINT
+			slow_hook_finished.store(true);
+		}
+
+#if HYPERION_PLATFORM_UNIX
+		volatile std::sig_atomic_t chained_signal = 0; // NOLINT
+
+		auto record_signal(i32 signal,
+						   [[maybe_unused]] siginfo_t* info,
+						   [[maybe_unused]] void* context) -> void {
+			chained_signal = signal;
+		}
+#endif // HYPERION_PLATFORM_UNIX
+
+		/// @brief Offset of the hooks used to fill the hook table, so they're distinct from the
+		/// ones registered individually
+		constexpr auto FILLER_HOOKS = 100_usize;
+
+		template<usize... Indices>
+		auto
+		register_filler_hooks([[maybe_unused]] std::index_sequence<Indices...> indices) noexcept
+			-> usize {
+			return (0_usize + ...
+					+ (Panic::register_hook(&record_hook<FILLER_HOOKS + Indices>) ? 1_usize :
+																				   0_usize));
+		}
+
+		template<usize... Indices>
+		auto
+		unregister_filler_hooks([[maybe_unused]] std::index_sequence<Indices...> indices) noexcept
+			-> void {
+			(ignore(Panic::unregister_hook(&record_hook<FILLER_HOOKS + Indices>)), ...);
+		}
+	} // namespace
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("Panic") {
+		TEST_CASE("PanicHooks") {
+			// other tests may have registered hooks (e.g. the global logger's flush hook), so
+			// replace the flush hook for the duration of this test and count relative to them
+			auto* const previous_flush_hook = Panic::get_flush_hook();
+			Panic::set_flush_hook(&record_hook<4>);
+			CHECK_EQ(Panic::get_flush_hook(), &record_hook<4>);
+			const auto initial = Panic::registered_hooks();
+
+			CHECK(Panic::register_hook(&record_hook<0>, 10)); // NOLINT
+			CHECK(Panic::register_hook(&record_hook<1>, -10)); // NOLINT
+			CHECK(Panic::register_hook(&record_hook<2>));
+			CHECK(Panic::register_hook(&record_hook<3>));
+			CHECK_EQ(Panic::registered_hooks(), initial + 4_usize);
+
+			// registering again moves the hook instead of adding it twice
+			CHECK(Panic::register_hook(&record_hook<0>, -20)); // NOLINT
+			CHECK_EQ(Panic::registered_hooks(), initial + 4_usize);
+
+			CHECK_FALSE(Panic::register_hook(nullptr));
+			CHECK(Panic::unregister_hook(&record_hook<3>));
+			CHECK_FALSE(Panic::unregister_hook(&record_hook<3>));
+			CHECK_EQ(Panic::registered_hooks(), initial + 3_usize);
+
+			constexpr auto fillers = std::make_index_sequence<Panic::MAX_HOOKS>();
+			CHECK_EQ(register_filler_hooks(fillers), Panic::MAX_HOOKS - initial - 3_usize);
+			CHECK_EQ(Panic::registered_hooks(), Panic::MAX_HOOKS);
+			CHECK_FALSE(Panic::register_hook(&record_hook<3>));
+			unregister_filler_hooks(fillers);
+			CHECK_EQ(Panic::registered_hooks(), initial + 3_usize);
+
+			// hooks run in ascending order, equal orders in registration order, and the flush
+			// hook after the hooks with the default order
+			Panic::invoke_hooks();
+			CHECK_EQ(invoked_hooks, std::vector<usize>{0, 1, 2, 4});
+			// a panic while the hooks are running doesn't re-enter them, but a later one runs
+			// them again
+			CHECK(Panic::register_hook(&reentrant_hook));
+			invoked_hooks.clear();
+			Panic::invoke_hooks();
+			CHECK_EQ(invoked_hooks, std::vector<usize>{0, 1, 2, 5, 4});
+			invoked_hooks.clear();
+			Panic::invoke_hooks();
+			CHECK_EQ(invoked_hooks, std::vector<usize>{0, 1, 2, 5, 4});
+
+			CHECK(Panic::unregister_hook(&reentrant_hook));
+			CHECK(Panic::unregister_hook(&record_hook<0>));
+			CHECK(Panic::unregister_hook(&record_hook<1>));
+			CHECK(Panic::unregister_hook(&record_hook<2>));
+			Panic::set_flush_hook(previous_flush_hook);
+		}
+
+		TEST_CASE("ConcurrentPanics") {
+			auto* const previous_flush_hook = Panic::get_flush_hook();
+			Panic::set_flush_hook(nullptr);
+			REQUIRE(Panic::register_hook(&slow_hook));
+
+			auto first = std::thread([]() noexcept { Panic::invoke_hooks(); });
+			while(!slow_hook_started.load()) {
+				std::this_thread::yield();
+			}
+
+			// a panic on another thread waits for the hooks already running to finish instead of
+			// going straight on to the handler, then runs them itself
+			auto finished_when_returned = false;
+			auto second = std::thread([&finished_when_returned]() noexcept {
+				Panic::invoke_hooks();
+				finished_when_returned = slow_hook_finished.load();
+			});
+
+			first.join();
+			second.join();
+			CHECK(finished_when_returned);
+			CHECK_EQ(slow_hook_calls.load(), 2_usize);
+
+			CHECK(Panic::unregister_hook(&slow_hook));
+			Panic::set_flush_hook(previous_flush_hook);
+		}
+
+#if HYPERION_PLATFORM_UNIX
+		TEST_CASE("CrashReporter") {
+			auto fds = std::array<int, 2>{};
+			REQUIRE_EQ(pipe(fds.data()), 0);
+
+			struct sigaction previous = {};
+			REQUIRE_EQ(sigaction(SIGSEGV, nullptr, &previous), 0);
+
+			REQUIRE(CrashReporter::install(fds[1], "hyperion crash report test"));
+			CHECK(CrashReporter::is_installed());
+
+			struct sigaction installed = {};
+			REQUIRE_EQ(sigaction(SIGSEGV, nullptr, &installed), 0);
+			CHECK_NE(installed.sa_flags & SA_SIGINFO, 0);
+
+			constexpr auto address = std::uintptr_t{0x10};
+			// NOLINTNEXTLINE
+			CrashReporter::write_report(SIGSEGV, reinterpret_cast<const void*>(address));
+
+			CrashReporter::uninstall();
+			CHECK_FALSE(CrashReporter::is_installed());
+			// nothing is written once uninstalled
+			CrashReporter::write_report(SIGSEGV);
+
+			struct sigaction restored = {};
+			REQUIRE_EQ(sigaction(SIGSEGV, nullptr, &restored), 0);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+			CHECK_EQ(restored.sa_handler, previous.sa_handler);
+
+			close(fds[1]);
+			auto report = std::string();
+			auto buffer = std::array<char, 512>(); // NOLINT(readability-magic-numbers)
+			for(auto count = read(fds[0], buffer.data(), buffer.size()); count > 0;
+				count = read(fds[0], buffer.data(), buffer.size()))
+			{
+				report.append(buffer.data(), static_cast<usize>(count));
+			}
+			close(fds[0]);
+
+			const auto expected_start
+				= fmt::format("hyperion crash report test\nFatal signal {} (SIGSEGV) at address "
+							  "0x{:0{}x}\nBacktrace:\n 0# 0x",
+							  SIGSEGV,
+							  address,
+							  sizeof(std::uintptr_t) * 2_usize);
+			CHECK(report.starts_with(expected_start));
+			CHECK(report.ends_with("\n"));
+		}
+
+		TEST_CASE("CrashReporterChaining") {
+			auto fds = std::array<int, 2>{};
+			REQUIRE_EQ(pipe(fds.data()), 0);
+
+			struct sigaction original = {};
+			struct sigaction recorder = {};
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+			recorder.sa_sigaction = &record_signal;
+			recorder.sa_flags = SA_SIGINFO;
+			sigemptyset(&recorder.sa_mask);
+			REQUIRE_EQ(sigaction(SIGFPE, &recorder, &original), 0);
+
+			REQUIRE(CrashReporter::install(fds[1], "hyperion crash chaining test"));
+
+			// the reporter writes its report, then hands the signal to the handler that was
+			// installed before it
+			chained_signal = 0;
+			raise(SIGFPE);
+			CHECK_EQ(chained_signal, SIGFPE);
+
+			CrashReporter::uninstall();
+			REQUIRE_EQ(sigaction(SIGFPE, &original, nullptr), 0);
+
+			close(fds[1]);
+			auto report = std::string();
+			auto buffer = std::array<char, 512>(); // NOLINT(readability-magic-numbers)
+			for(auto count = read(fds[0], buffer.data(), buffer.size()); count > 0;
+				count = read(fds[0], buffer.data(), buffer.size()))
+			{
+				report.append(buffer.data(), static_cast<usize>(count));
+			}
+			close(fds[0]);
+
+			CHECK(report.starts_with(fmt::format("hyperion crash chaining test\nFatal signal {} "
+												 "(SIGFPE)",
+												 SIGFPE)));
+		}
+#endif // HYPERION_PLATFORM_UNIX
+	}
+} // namespace hyperion::error
@@ -272,5 +272,98 @@ namespace hyperion {
 				move_test(std::move(err));
 			}
 		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("rvalue combinators") {
+			using Pointer = UniquePtr<i32>;
+			constexpr auto twice = [](Pointer&& ptr) noexcept -> Pointer {
+				*ptr *= 2_i32;
+				return std::move(ptr);
+			};
+			constexpr auto to_value = [](Pointer&& ptr) noexcept -> i32 {
+				return *ptr;
+			};
+
+			SUBCASE("Ok") {
+				// `Pointer` is move-only, so the whole chain has to move through the `Result`s
+				const auto value = Result<Pointer, error::AnyError>(make_unique<i32>(3_i32))
+									   .map(twice)
+									   .map_err([](error::AnyError&& err) noexcept {
+										   return std::move(err);
+									   })
+									   .map(twice)
+									   .map_or(to_value, 0_i32);
+				CHECK_EQ(value, 12_i32);
+
+				const auto other = Result<Pointer, error::AnyError>(make_unique<i32>(4_i32))
+									   .map(twice)
+									   .map_or_else(to_value, []() noexcept { return 0_i32; });
+				CHECK_EQ(other, 8_i32);
+			}
+
+			SUBCASE("Err") {
+				auto result = Result<Pointer, error::AnyError>(error::SystemError(2_i32))
+								  .map(twice)
+								  .map_err([](error::AnyError&& err) noexcept {
+									  return error::AnyError(std::move(err));
+								  });
+				CHECK(result.is_err());
+				CHECK_EQ(result.unwrap_err().message(), error::SystemError(2_i32).message());
+
+				const auto value = Result<Pointer, error::AnyError>(error::SystemError(2_i32))
+									   .map(twice)
+									   .map_or(to_value, -1_i32);
+				CHECK_EQ(value, -1_i32);
+			}
+
+			SUBCASE("Option") {
+				const auto value
+					= Option<Pointer>(make_unique<i32>(5_i32)).map(twice).map_or(to_value, 0_i32);
+				CHECK_EQ(value, 10_i32);
+
+				const auto none = Option<Pointer>(None()).map(twice).map_or_else(
+					to_value,
+					[]() noexcept { return -1_i32; });
+				CHECK_EQ(none, -1_i32);
+			}
+		}
+
+		TEST_CASE("Layout") {
+			// error origin tracking adds no storage unless it's enabled
+			static_assert(result::ErrorOrigin::TRACKED || sizeof(Result<u8, i8>) == 2_usize);
+			static_assert(result::ErrorOrigin::TRACKED || sizeof(Result<u16, i16>) == 4_usize);
+			static_assert(result::ErrorOrigin::TRACKED || std::is_empty_v<result::ErrorOrigin>);
+			// copies of an error origin share its backtrace, so copying isn't trivial when
+			// backtraces are captured
+			static_assert(result::ErrorOrigin::HAS_BACKTRACE
+						  || std::is_trivially_copyable_v<Result<u32, i32>>);
+			static_assert(result::ErrorOrigin::HAS_BACKTRACE
+						  || std::is_trivially_copyable_v<Result<u64, const i32&>>);
+			static_assert(!std::is_trivially_copyable_v<Result<std::string, i32>>);
+			static_assert(!std::is_trivially_copyable_v<Result<u32, error::SystemError>>);
+
+			SUBCASE("trivial copy") {
+				Result<u32, i32> ok = Ok(3_u32);
+				Result<u32, i32> err = Err(-1_i32);
+				auto copy = ok;
+				CHECK(copy.is_ok());
+				CHECK_EQ(copy.unwrap(), 3_u32);
+
+				copy = err;
+				CHECK(copy.is_err());
+				CHECK_EQ(copy.unwrap_err(), -1_i32);
+			}
+
+			SUBCASE("non-trivial move") {
+				Result<std::string, i32> ok = Ok(std::string("a string long enough to allocate"));
+				auto moved = std::move(ok);
+
+				CHECK(moved.is_ok());
+				CHECK_EQ(moved.unwrap(), "a string long enough to allocate");
+				// moving a non-trivial `Result` consumes it
+				CHECK_FALSE(ok.is_ok()); // NOLINT(bugprone-use-after-move)
+				CHECK_FALSE(ok.is_err());
+			}
+		}
 	}
 } // namespace hyperion
@@ -72,6 +72,35 @@ namespace hyperion {
 
 			std::shared_ptr<i32> m_ptr;
 		};
+
+		/// @brief Tracks the number of live instances, so tests can check that `RingBuffer`
+		/// destroys exactly the elements it constructed
+		class LifetimeCounter {
+		  public:
+			static inline i64 s_live = 0; // NOLINT
+
+			explicit LifetimeCounter(i32 val) noexcept : m_value(val) {
+				s_live++;
+			}
+			LifetimeCounter(const LifetimeCounter& other) noexcept : m_value(other.m_value) {
+				s_live++;
+			}
+			LifetimeCounter(LifetimeCounter&& other) noexcept : m_value(other.m_value) {
+				s_live++;
+			}
+			~LifetimeCounter() noexcept {
+				s_live--;
+			}
+			auto operator=(const LifetimeCounter&) noexcept -> LifetimeCounter& = default;
+			auto operator=(LifetimeCounter&&) noexcept -> LifetimeCounter& = default;
+
+			[[nodiscard]] auto value() const noexcept -> i32 {
+				return m_value;
+			}
+
+		  private:
+			i32 m_value;
+		};
 		IGNORE_UNUSED_MEMBER_FUNCTIONS_STOP
 
 	} // namespace detail::ringbuffer::test
@@ -422,5 +451,209 @@ namespace hyperion {
 				CHECK_EQ(buffer.front(), 2);
 			}
 		}
+
+		TEST_CASE("PowerOfTwoCapacity") {
+			CHECK_EQ(RingBuffer<i32>(5).capacity(), 8_usize);
+			CHECK_EQ(RingBuffer<i32>(8).capacity(), 8_usize);
+			CHECK_EQ(RingBuffer<i32>({1, 2, 3}).capacity(), 4_usize);
+
+			auto buffer = RingBuffer<i32>(3);
+			for(auto i = 0_i32; i < 6_i32; ++i) {
+				buffer.push_back(i);
+			}
+			CHECK(buffer.full());
+			CHECK_EQ(buffer.size(), 4_usize);
+			CHECK_EQ(buffer.front(), 2_i32);
+			CHECK_EQ(buffer.back(), 5_i32);
+
+			buffer.reserve(5);
+			CHECK_EQ(buffer.capacity(), 8_usize);
+			CHECK_EQ(buffer.size(), 4_usize);
+			for(auto i = 0_usize; i < buffer.size(); ++i) {
+				CHECK_EQ(buffer[i], static_cast<i32>(i + 2));
+			}
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Liveness") {
+			using detail::ringbuffer::test::LifetimeCounter;
+			LifetimeCounter::s_live = 0;
+
+			{
+				auto buffer = RingBuffer<LifetimeCounter>(4);
+				CHECK_EQ(LifetimeCounter::s_live, 0);
+
+				for(auto i = 0_i32; i < 10_i32; ++i) {
+					buffer.emplace_back(i);
+				}
+				CHECK_EQ(LifetimeCounter::s_live, 4);
+				CHECK_EQ(buffer.front().value(), 6_i32);
+
+				buffer.insert_emplace(buffer.begin() + 1, 42);
+				CHECK_EQ(LifetimeCounter::s_live, 4);
+				CHECK_EQ(buffer[1].value(), 42_i32);
+				CHECK_EQ(buffer.back().value(), 8_i32);
+
+				ignore(buffer.erase(buffer.begin()));
+				CHECK_EQ(LifetimeCounter::s_live, 3);
+
+				ignore(buffer.erase(buffer.begin(), buffer.begin() + 2));
+				CHECK_EQ(LifetimeCounter::s_live, 1);
+				CHECK_EQ(buffer.front().value(), 8_i32);
+
+				ignore(buffer.erase(buffer.begin()));
+				CHECK_EQ(LifetimeCounter::s_live, 0);
+				CHECK(buffer.empty());
+
+				buffer.emplace_back(1);
+				buffer.emplace_back(2);
+				auto copy = buffer;
+				CHECK_EQ(LifetimeCounter::s_live, 4);
+
+				buffer.clear();
+				CHECK_EQ(LifetimeCounter::s_live, 2);
+
+				copy.reserve(16);
+				CHECK_EQ(LifetimeCounter::s_live, 2);
+				CHECK_EQ(copy.back().value(), 2_i32);
+			}
+
+			CHECK_EQ(LifetimeCounter::s_live, 0);
+		}
+
+		TEST_CASE("AliasedPushWhenFull") {
+			auto buffer = RingBuffer<std::shared_ptr<i32>>(2);
+			buffer.push_back(std::make_shared<i32>(1));
+			buffer.push_back(std::make_shared<i32>(2));
+			CHECK(buffer.full());
+
+			buffer.push_back(buffer.front());
+			CHECK_EQ(buffer.size(), 2_usize);
+			CHECK_EQ(*buffer.front(), 2_i32);
+			REQUIRE(buffer.back() != nullptr);
+			CHECK_EQ(*buffer.back(), 1_i32);
+			CHECK_EQ(buffer.back().use_count(), 1);
+
+			buffer.emplace_back(buffer.front());
+			CHECK_EQ(*buffer.front(), 1_i32);
+			CHECK_EQ(*buffer.back(), 2_i32);
+		}
+
+		TEST_CASE("AliasedPushRangeWhenFull") {
+			auto buffer = RingBuffer<std::shared_ptr<i32>>(4);
+			for(auto i = 0_i32; i < 6_i32; ++i) {
+				buffer.push_back(std::make_shared<i32>(i));
+			}
+			CHECK(buffer.full());
+
+			// the buffer wraps, so this is the first two elements, which are dropped to make room
+			buffer.push_range(buffer.as_spans().first);
+			CHECK_EQ(buffer.size(), 4_usize);
+			auto expected = std::array<i32, 4>{4, 5, 2, 3};
+			for(auto i = 0_usize; i < expected.size(); ++i) {
+				REQUIRE(buffer.at(i) != nullptr);
+				CHECK_EQ(*buffer.at(i), expected.at(i));
+				CHECK_EQ(buffer.at(i).use_count(), 1);
+			}
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Segments") {
+			auto buffer = RingBuffer<i32>(8);
+			for(auto i = 0_i32; i < 11_i32; ++i) {
+				buffer.push_back(i);
+			}
+
+			SUBCASE("as_spans") {
+				auto [first, second] = buffer.as_spans();
+				CHECK_EQ(first.size(), 5_usize);
+				CHECK_EQ(second.size(), 3_usize);
+				CHECK_EQ(first.front(), 3_i32);
+				CHECK_EQ(first.back(), 7_i32);
+				CHECK_EQ(second.front(), 8_i32);
+				CHECK_EQ(second.back(), 10_i32);
+			}
+
+			SUBCASE("iterators") {
+				auto expected = 3_i32;
+				for(auto& elem : buffer) {
+					CHECK_EQ(elem, expected);
+					expected++;
+				}
+				CHECK_EQ(expected, 11_i32);
+
+				auto iter = buffer.end();
+				for(auto i = 10_i32; i >= 3_i32; --i) {
+					--iter;
+					CHECK_EQ(*iter, i);
+				}
+				CHECK_EQ(iter, buffer.begin());
+			}
+
+			SUBCASE("copy_to") {
+				auto destination = std::array<i32, 6>{};
+				const auto span = make_span(destination.data(), destination.size());
+				CHECK_EQ(buffer.copy_to(span), 6_usize);
+				for(auto i = 0_usize; i < destination.size(); ++i) {
+					CHECK_EQ(destination.at(i), static_cast<i32>(i + 3));
+				}
+				CHECK_EQ(buffer.size(), 8_usize);
+			}
+
+			SUBCASE("pop_range") {
+				auto destination = std::array<i32, 16>{};
+				const auto span = make_span(destination.data(), destination.size());
+				CHECK_EQ(buffer.pop_range(span), 8_usize);
+				for(auto i = 0_usize; i < 8_usize; ++i) {
+					CHECK_EQ(destination.at(i), static_cast<i32>(i + 3));
+				}
+				CHECK(buffer.empty());
+
+				auto [first, second] = buffer.as_spans();
+				CHECK(first.is_empty());
+				CHECK(second.is_empty());
+			}
+
+			SUBCASE("push_range") {
+				const auto values = std::array<i32, 3>{20, 21, 22};
+				buffer.push_range(make_span(values.data(), values.size()));
+
+				CHECK_EQ(buffer.size(), 8_usize);
+				CHECK_EQ(buffer.front(), 6_i32);
+				CHECK_EQ(buffer.back(), 22_i32);
+
+				auto many = std::array<i32, 12>{};
+				for(auto i = 0_usize; i < many.size(); ++i) {
+					many.at(i) = static_cast<i32>(100 + i);
+				}
+				buffer.push_range(make_span(many.data(), many.size()));
+
+				CHECK_EQ(buffer.size(), 8_usize);
+				CHECK_EQ(buffer.front(), 104_i32);
+				CHECK_EQ(buffer.back(), 111_i32);
+				CHECK(buffer.as_spans().second.is_empty());
+			}
+
+			SUBCASE("non_trivial") {
+				using detail::ringbuffer::test::TestClass;
+				auto classes = RingBuffer<TestClass>(4);
+				for(auto i = 0_i32; i < 6_i32; ++i) {
+					classes.emplace_back(i);
+				}
+
+				auto values = std::array<TestClass, 2>{TestClass(6), TestClass(7)};
+				classes.push_range(make_span(values.data(), values.size()));
+				CHECK_EQ(classes.front(), 4);
+				CHECK_EQ(classes.back(), 7);
+
+				auto destination = std::array<TestClass, 3>{};
+				const auto span = make_span(destination.data(), destination.size());
+				CHECK_EQ(classes.pop_range(span), 3_usize);
+				CHECK_EQ(destination.at(0), 4);
+				CHECK_EQ(destination.at(2), 6);
+				CHECK_EQ(classes.size(), 1_usize);
+				CHECK_EQ(classes.front(), 7);
+			}
+		}
 	}
 } // namespace hyperion
@@ -0,0 +1,205 @@
+/// @file SPSCQueue.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for SPSCQueue
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/SPSCQueue.h>
+#include <Hyperion/Testing.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <thread>
+
+namespace hyperion { // NOLINT
+	namespace detail::spsc_queue::test {
+		IGNORE_UNUSED_MEMBER_FUNCTIONS_START
+		class TestClass {
+		  public:
+			TestClass() noexcept = default;
+			explicit TestClass(i32 val) noexcept : m_ptr(std::make_shared<i32>(val)) {
+			}
+			TestClass(const TestClass&) noexcept = default;
+			TestClass(TestClass&&) noexcept = default;
+			~TestClass() noexcept = default;
+			auto operator=(const TestClass&) noexcept -> TestClass& = default;
+			auto operator=(TestClass&&) noexcept -> TestClass& = default;
+
+			auto operator=(i32 val) noexcept -> TestClass& {
+				if(m_ptr != nullptr) {
+					*m_ptr = val;
+				}
+				else {
+					m_ptr = std::make_shared<i32>(val);
+				}
+
+				return *this;
+			}
+
+			// NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions))
+			explicit(false) operator i32() const noexcept {
+				return *m_ptr;
+			}
+
+			auto operator<=>(const TestClass& rhs) const noexcept -> std::strong_ordering {
+				return *m_ptr <=> *(rhs.m_ptr);
+			}
+
+			auto operator<=>(i32 rhs) const noexcept -> std::strong_ordering {
+				return *m_ptr <=> rhs;
+			}
+
+			auto operator==(const TestClass& rhs) const noexcept -> bool {
+				return (*this <=> rhs) == std::strong_ordering::equal;
+			}
+
+			auto operator!=(const TestClass& rhs) const noexcept -> bool {
+				return (*this <=> rhs) != std::strong_ordering::equal;
+			}
+
+			auto operator==(i32 rhs) const noexcept -> bool {
+				return (*this <=> rhs) == std::strong_ordering::equal;
+			}
+
+			auto operator!=(i32 rhs) const noexcept -> bool {
+				return (*this <=> rhs) != std::strong_ordering::equal;
+			}
+
+			std::shared_ptr<i32> m_ptr;
+		};
+		IGNORE_UNUSED_MEMBER_FUNCTIONS_STOP
+	} // namespace detail::spsc_queue::test
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("SPSCQueue") {
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("SingleThreaded") {
+			using detail::spsc_queue::test::TestClass;
+			auto queue = SPSCQueue<TestClass>(6_usize);
+
+			CHECK(queue.empty());
+			CHECK_EQ(queue.capacity(), 8_usize);
+			CHECK(queue.pop_front().is_none());
+
+			SUBCASE("try_push_back") {
+				for(auto i = 0_usize; i < queue.capacity(); ++i) {
+					CHECK(queue.try_push_back(TestClass(static_cast<i32>(i))));
+				}
+				CHECK(queue.full());
+				CHECK_FALSE(queue.try_emplace_back(42));
+
+				for(auto i = 0_usize; i < queue.capacity(); ++i) {
+					auto front = queue.pop_front();
+					CHECK(front.is_some());
+					CHECK_EQ(front.unwrap(), static_cast<i32>(i));
+				}
+				CHECK(queue.empty());
+			}
+
+			SUBCASE("batches") {
+				auto values = std::array<TestClass, 12>();
+				for(auto i = 0_usize; i < values.size(); ++i) {
+					values[i] = TestClass(static_cast<i32>(i)); // NOLINT
+				}
+
+				// only a prefix of the batch fits
+				CHECK_EQ(queue.push_batch(make_span(values.data(), values.size())), 8_usize);
+				CHECK(queue.full());
+
+				auto popped = std::array<TestClass, 5>();
+				CHECK_EQ(queue.pop_batch(make_span(popped.data(), popped.size())), 5_usize);
+				for(auto i = 0_usize; i < popped.size(); ++i) {
+					CHECK_EQ(popped[i], static_cast<i32>(i)); // NOLINT
+				}
+				CHECK_EQ(queue.size(), 3_usize);
+
+				// wraps around the end of the storage
+				CHECK_EQ(queue.push_batch(make_span(values.data() + 8, 4_usize)), 4_usize);
+
+				auto expected = 5_i32;
+				const auto consumed = queue.pop_batch([&expected](TestClass&& value) noexcept {
+					CHECK_EQ(value, expected);
+					expected++;
+				});
+				CHECK_EQ(consumed, 7_usize);
+				CHECK_EQ(expected, 12_i32);
+				CHECK(queue.empty());
+			}
+
+			SUBCASE("destroys remaining elements") {
+				auto value = TestClass(7);
+				queue.push_back(value);
+				queue.push_back(value);
+				CHECK_EQ(value.m_ptr.use_count(), 3);
+				ignore(queue.pop_front());
+				CHECK_EQ(value.m_ptr.use_count(), 2);
+			}
+		}
+
+		TEST_CASE("ProducerConsumer") {
+			static constexpr auto num_values = 100000_usize;
+			static constexpr auto batch_size = 7_usize;
+			auto queue = SPSCQueue<usize>(64_usize);
+
+			auto producer = std::thread([&queue]() {
+				auto batch = std::array<usize, batch_size>();
+				auto next = 0_usize;
+				while(next < num_values) {
+					const auto count = std::min(batch_size, num_values - next);
+					for(auto i = 0_usize; i < count; ++i) {
+						batch[i] = next + i; // NOLINT
+					}
+
+					auto pushed = 0_usize;
+					while(pushed < count) {
+						const auto remaining = make_span(batch.data() + pushed, count - pushed);
+						pushed += queue.push_batch(remaining);
+					}
+					next += count;
+				}
+			});
+
+			auto expected = 0_usize;
+			auto in_order = true;
+			while(expected < num_values) {
+				if(expected % 2 == 0) {
+					if(auto value = queue.pop_front(); value.is_some()) {
+						in_order = in_order && value.unwrap() == expected;
+						expected++;
+					}
+				}
+				else {
+					ignore(queue.pop_batch([&](usize value) noexcept {
+						in_order = in_order && value == expected;
+						expected++;
+					}));
+				}
+			}
+
+			producer.join();
+
+			CHECK(in_order);
+			CHECK(queue.empty());
+		}
+	}
+} // namespace hyperion
@@ -0,0 +1,172 @@
+/// @file StaticLockFreeQueue.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for StaticLockFreeQueue
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/StaticLockFreeQueue.h>
+#include <Hyperion/Testing.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace hyperion { // NOLINT
+	namespace detail::static_lock_free_queue::test {
+		IGNORE_UNUSED_MEMBER_FUNCTIONS_START
+		class TestClass {
+		  public:
+			TestClass() noexcept = default;
+			explicit TestClass(i32 val) noexcept : m_ptr(std::make_shared<i32>(val)) {
+			}
+			TestClass(const TestClass&) noexcept = default;
+			TestClass(TestClass&&) noexcept = default;
+			~TestClass() noexcept = default;
+			auto operator=(const TestClass&) noexcept -> TestClass& = default;
+			auto operator=(TestClass&&) noexcept -> TestClass& = default;
+
+			auto operator=(i32 val) noexcept -> TestClass& {
+				if(m_ptr != nullptr) {
+					*m_ptr = val;
+				}
+				else {
+					m_ptr = std::make_shared<i32>(val);
+				}
+
+				return *this;
+			}
+
+			// NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions))
+			explicit(false) operator i32() const noexcept {
+				return *m_ptr;
+			}
+
+			auto operator<=>(const TestClass& rhs) const noexcept -> std::strong_ordering {
+				return *m_ptr <=> *(rhs.m_ptr);
+			}
+
+			auto operator<=>(i32 rhs) const noexcept -> std::strong_ordering {
+				return *m_ptr <=> rhs;
+			}
+
+			auto operator==(const TestClass& rhs) const noexcept -> bool {
+				return (*this <=> rhs) == std::strong_ordering::equal;
+			}
+
+			auto operator!=(const TestClass& rhs) const noexcept -> bool {
+				return (*this <=> rhs) != std::strong_ordering::equal;
+			}
+
+			auto operator==(i32 rhs) const noexcept -> bool {
+				return (*this <=> rhs) == std::strong_ordering::equal;
+			}
+
+			auto operator!=(i32 rhs) const noexcept -> bool {
+				return (*this <=> rhs) != std::strong_ordering::equal;
+			}
+
+			std::shared_ptr<i32> m_ptr;
+		};
+		IGNORE_UNUSED_MEMBER_FUNCTIONS_STOP
+	} // namespace detail::static_lock_free_queue::test
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("StaticLockFreeQueue") {
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("SingleThreaded") {
+			using detail::static_lock_free_queue::test::TestClass;
+			constexpr auto capacity = 8_usize;
+			auto queue = StaticLockFreeQueue<TestClass, capacity>();
+
+			CHECK(queue.empty());
+			CHECK_EQ(queue.capacity(), capacity);
+			CHECK(queue.pop_front().is_none());
+
+			SUBCASE("try_push_back") {
+				for(auto i = 0_usize; i < capacity; ++i) {
+					CHECK(queue.try_push_back(TestClass(static_cast<i32>(i))));
+				}
+				CHECK(queue.full());
+				CHECK_FALSE(queue.try_push_back(TestClass(42)));
+
+				for(auto i = 0_usize; i < capacity; ++i) {
+					auto front = queue.pop_front();
+					CHECK(front.is_some());
+					CHECK_EQ(front.unwrap(), static_cast<i32>(i));
+				}
+				CHECK(queue.empty());
+			}
+
+			SUBCASE("force_emplace_back") {
+				for(auto i = 0_usize; i < capacity + 3; ++i) {
+					queue.force_emplace_back(static_cast<i32>(i));
+				}
+				CHECK_EQ(queue.size(), capacity);
+
+				auto front = queue.pop_front();
+				CHECK(front.is_some());
+				CHECK_EQ(front.unwrap(), 3);
+			}
+
+			SUBCASE("wrapping") {
+				for(auto i = 0_i32; i < 100_i32; ++i) {
+					queue.emplace_back(i);
+					auto front = queue.pop_front();
+					CHECK(front.is_some());
+					CHECK_EQ(front.unwrap(), i);
+				}
+				CHECK(queue.empty());
+			}
+		}
+
+		TEST_CASE("MultiProducer") {
+			constexpr auto num_producers = 4_usize;
+			constexpr auto num_per_producer = 10000_usize;
+			auto queue = StaticLockFreeQueue<usize, 64>();
+
+			auto producers = std::vector<std::thread>();
+			for(auto producer = 0_usize; producer < num_producers; ++producer) {
+				producers.emplace_back([&queue]() {
+					for(auto i = 1_usize; i <= num_per_producer; ++i) {
+						queue.push_back(i);
+					}
+				});
+			}
+
+			auto sum = 0_usize;
+			auto received = 0_usize;
+			while(received < num_producers * num_per_producer) {
+				if(auto value = queue.pop_front(); value.is_some()) {
+					sum += value.unwrap();
+					received++;
+				}
+			}
+
+			for(auto& producer : producers) {
+				producer.join();
+			}
+
+			CHECK_EQ(sum, num_producers * (num_per_producer * (num_per_producer + 1)) / 2);
+			CHECK(queue.empty());
+		}
+	}
+} // namespace hyperion
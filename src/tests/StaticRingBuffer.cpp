@@ -0,0 +1,273 @@
+/// @file StaticRingBuffer.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for StaticRingBuffer
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/StaticRingBuffer.h>
+#include <Hyperion/Testing.h>
+#include <array>
+#include <memory>
+
+namespace hyperion {
+	namespace detail::static_ringbuffer::test {
+		IGNORE_UNUSED_MEMBER_FUNCTIONS_START
+		class TestClass {
+		  public:
+			TestClass() noexcept = default;
+			explicit TestClass(i32 val) noexcept : m_ptr(std::make_shared<i32>(val)) {
+			}
+			TestClass(const TestClass&) noexcept = default;
+			TestClass(TestClass&&) noexcept = default;
+			~TestClass() noexcept = default;
+			auto operator=(const TestClass&) noexcept -> TestClass& = default;
+			auto operator=(TestClass&&) noexcept -> TestClass& = default;
+
+			// NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions))
+			operator i32() const noexcept {
+				return *m_ptr;
+			}
+
+			auto operator<=>(const TestClass& rhs) const noexcept -> std::strong_ordering {
+				return *m_ptr <=> *(rhs.m_ptr);
+			}
+
+			auto operator<=>(i32 rhs) const noexcept -> std::strong_ordering {
+				return *m_ptr <=> rhs;
+			}
+
+			auto operator==(const TestClass& rhs) const noexcept -> bool {
+				return (*this <=> rhs) == std::strong_ordering::equal;
+			}
+
+			auto operator!=(const TestClass& rhs) const noexcept -> bool {
+				return (*this <=> rhs) != std::strong_ordering::equal;
+			}
+
+			auto operator==(i32 rhs) const noexcept -> bool {
+				return (*this <=> rhs) == std::strong_ordering::equal;
+			}
+
+			auto operator!=(i32 rhs) const noexcept -> bool {
+				return (*this <=> rhs) != std::strong_ordering::equal;
+			}
+
+			std::shared_ptr<i32> m_ptr;
+		};
+
+		/// @brief Tracks the number of live instances, so tests can check that `RingBuffer`
+		/// destroys exactly the elements it constructed
+		class LifetimeCounter {
+		  public:
+			static inline i64 s_live = 0; // NOLINT
+
+			explicit LifetimeCounter(i32 val) noexcept : m_value(val) {
+				s_live++;
+			}
+			LifetimeCounter(const LifetimeCounter& other) noexcept : m_value(other.m_value) {
+				s_live++;
+			}
+			LifetimeCounter(LifetimeCounter&& other) noexcept : m_value(other.m_value) {
+				s_live++;
+			}
+			~LifetimeCounter() noexcept {
+				s_live--;
+			}
+			auto operator=(const LifetimeCounter&) noexcept -> LifetimeCounter& = default;
+			auto operator=(LifetimeCounter&&) noexcept -> LifetimeCounter& = default;
+
+			[[nodiscard]] auto value() const noexcept -> i32 {
+				return m_value;
+			}
+
+		  private:
+			i32 m_value;
+		};
+		IGNORE_UNUSED_MEMBER_FUNCTIONS_STOP
+	} // namespace detail::static_ringbuffer::test
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("StaticRingBuffer") {
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Basics") {
+			using detail::static_ringbuffer::test::LifetimeCounter;
+			LifetimeCounter::s_live = 0;
+
+			{
+				auto buffer = StaticRingBuffer<LifetimeCounter, 4>();
+				CHECK(buffer.empty());
+				CHECK_EQ(buffer.capacity(), 4_usize);
+
+				for(auto i = 0_i32; i < 6_i32; ++i) {
+					buffer.emplace_back(i);
+				}
+				CHECK(buffer.full());
+				CHECK_EQ(LifetimeCounter::s_live, 4);
+				CHECK_EQ(buffer.front().value(), 2_i32);
+				CHECK_EQ(buffer.back().value(), 5_i32);
+
+				auto expected = 2_i32;
+				for(const auto& elem : buffer) {
+					CHECK_EQ(elem.value(), expected);
+					expected++;
+				}
+
+				auto copy = buffer;
+				CHECK_EQ(LifetimeCounter::s_live, 8);
+				copy.clear();
+				CHECK_EQ(LifetimeCounter::s_live, 4);
+				CHECK(copy.empty());
+			}
+
+			CHECK_EQ(LifetimeCounter::s_live, 0);
+		}
+
+		TEST_CASE("Segments") {
+			auto buffer = StaticRingBuffer<i32, 8>();
+			for(auto i = 0_i32; i < 11_i32; ++i) {
+				buffer.push_back(i);
+			}
+
+			auto [first, second] = buffer.as_spans();
+			CHECK_EQ(first.size(), 5_usize);
+			CHECK_EQ(second.size(), 3_usize);
+
+			auto destination = std::array<i32, 8>{};
+			const auto span = make_span(destination.data(), destination.size());
+			CHECK_EQ(buffer.pop_range(span), 8_usize);
+			for(auto i = 0_usize; i < destination.size(); ++i) {
+				CHECK_EQ(destination.at(i), static_cast<i32>(i + 3));
+			}
+			CHECK(buffer.empty());
+		}
+
+		TEST_CASE("AliasedPushWhenFull") {
+			auto buffer = StaticRingBuffer<std::shared_ptr<i32>, 2>();
+			buffer.push_back(std::make_shared<i32>(1));
+			buffer.push_back(std::make_shared<i32>(2));
+			CHECK(buffer.full());
+
+			buffer.push_back(buffer.front());
+			CHECK_EQ(buffer.size(), 2_usize);
+			CHECK_EQ(*buffer.front(), 2_i32);
+			REQUIRE(buffer.back() != nullptr);
+			CHECK_EQ(*buffer.back(), 1_i32);
+			CHECK_EQ(buffer.back().use_count(), 1);
+		}
+
+		TEST_CASE("AliasedPushRangeWhenFull") {
+			auto buffer = StaticRingBuffer<std::shared_ptr<i32>, 4>();
+			for(auto i = 0_i32; i < 6_i32; ++i) {
+				buffer.push_back(std::make_shared<i32>(i));
+			}
+			CHECK(buffer.full());
+
+			// the buffer wraps, so this is the first two elements, which are dropped to make room
+			buffer.push_range(buffer.as_spans().first);
+			CHECK_EQ(buffer.size(), 4_usize);
+			auto expected = std::array<i32, 4>{4, 5, 2, 3};
+			auto index = 0_usize;
+			for(const auto& elem : buffer) {
+				REQUIRE(elem != nullptr);
+				CHECK_EQ(*elem, expected.at(index));
+				CHECK_EQ(elem.use_count(), 1);
+				index++;
+			}
+			CHECK_EQ(index, expected.size());
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("BulkCopies") {
+			auto buffer = StaticRingBuffer<i32, 8>();
+			for(auto i = 0_i32; i < 11_i32; ++i) {
+				buffer.push_back(i);
+			}
+
+			SUBCASE("push_range") {
+				const auto values = std::array<i32, 3>{20, 21, 22};
+				buffer.push_range(make_span(values.data(), values.size()));
+				CHECK_EQ(buffer.size(), 8_usize);
+				CHECK_EQ(buffer.front(), 6_i32);
+				CHECK_EQ(buffer.back(), 22_i32);
+
+				auto many = std::array<i32, 12>{};
+				for(auto i = 0_usize; i < many.size(); ++i) {
+					many.at(i) = static_cast<i32>(100 + i);
+				}
+				buffer.push_range(make_span(many.data(), many.size()));
+				CHECK_EQ(buffer.size(), 8_usize);
+				CHECK_EQ(buffer.front(), 104_i32);
+				CHECK_EQ(buffer.back(), 111_i32);
+				CHECK(buffer.as_spans().second.is_empty());
+			}
+
+			SUBCASE("copy_to") {
+				auto destination = std::array<i32, 6>{};
+				const auto span = make_span(destination.data(), destination.size());
+				CHECK_EQ(buffer.copy_to(span), 6_usize);
+				for(auto i = 0_usize; i < destination.size(); ++i) {
+					CHECK_EQ(destination.at(i), static_cast<i32>(i + 3));
+				}
+				CHECK_EQ(buffer.size(), 8_usize);
+			}
+
+			SUBCASE("non_trivial") {
+				using detail::static_ringbuffer::test::TestClass;
+				auto classes = StaticRingBuffer<TestClass, 4>();
+				for(auto i = 0_i32; i < 6_i32; ++i) {
+					classes.emplace_back(i);
+				}
+
+				auto values = std::array<TestClass, 2>{TestClass(6), TestClass(7)};
+				classes.push_range(make_span(values.data(), values.size()));
+				CHECK_EQ(classes.front(), 4);
+				CHECK_EQ(classes.back(), 7);
+
+				auto destination = std::array<TestClass, 3>{};
+				const auto span = make_span(destination.data(), destination.size());
+				CHECK_EQ(classes.copy_to(span), 3_usize);
+				CHECK_EQ(destination.at(0), 4);
+				CHECK_EQ(destination.at(2), 6);
+				CHECK_EQ(classes.size(), 4_usize);
+			}
+		}
+
+		TEST_CASE("Constexpr") {
+			constexpr auto sum = []() {
+				auto buffer = StaticRingBuffer<i32, 4>();
+				for(auto i = 0_i32; i < 6_i32; ++i) {
+					buffer.push_back(i);
+				}
+
+				auto total = 0_i32;
+				for(const auto& elem : buffer) {
+					total += elem;
+				}
+				return total;
+			}();
+
+			static_assert(sum == 2 + 3 + 4 + 5);
+			CHECK_EQ(sum, 14_i32);
+		}
+	}
+} // namespace hyperion
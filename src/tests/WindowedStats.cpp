@@ -0,0 +1,146 @@
+/// @file WindowedStats.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for WindowedStats
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Testing.h>
+#include <Hyperion/WindowedStats.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace hyperion {
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("WindowedStats") {
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Empty") {
+			auto stats = WindowedStats<f64>(8_usize, QuantileTracking::Enabled);
+
+			CHECK(stats.empty());
+			CHECK_FALSE(stats.full());
+			CHECK_EQ(stats.window_size(), 8_usize);
+			CHECK_EQ(stats.sum(), doctest::Approx(0.0));
+			CHECK_EQ(stats.mean(), doctest::Approx(0.0));
+			CHECK_EQ(stats.variance(), doctest::Approx(0.0));
+			CHECK(stats.min().is_none());
+			CHECK(stats.max().is_none());
+			CHECK(stats.quantile(0.5).is_none());
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("MatchesBruteForce") {
+			constexpr auto window = 16_usize;
+			auto stats = WindowedStats<i32>(window);
+			auto history = std::vector<i32>();
+			auto rng = std::mt19937(42U); // NOLINT(cert-msc32-c, cert-msc51-cpp)
+			auto dist = std::uniform_int_distribution<i32>(-1000, 1000);
+
+			for(auto i = 0_usize; i < 500_usize; ++i) {
+				const auto sample = dist(rng);
+				stats.push(sample);
+				history.push_back(sample);
+
+				const auto first = history.size() > window ?
+									   history.end() - static_cast<std::ptrdiff_t>(window) :
+									   history.begin();
+				const auto count = static_cast<f64>(std::distance(first, history.end()));
+				auto sum = 0.0;
+				std::for_each(first, history.end(), [&sum](i32 val) { sum += val; });
+				const auto mean = sum / count;
+				auto squares = 0.0;
+				std::for_each(first, history.end(), [&squares, mean](i32 val) {
+					squares += (val - mean) * (val - mean);
+				});
+
+				REQUIRE_EQ(stats.size(), static_cast<usize>(count));
+				REQUIRE_EQ(stats.sum(), doctest::Approx(sum));
+				REQUIRE_EQ(stats.mean(), doctest::Approx(mean));
+				REQUIRE_EQ(stats.variance(), doctest::Approx(squares / count).epsilon(1e-6));
+				REQUIRE_EQ(stats.min().unwrap(), *std::min_element(first, history.end()));
+				REQUIRE_EQ(stats.max().unwrap(), *std::max_element(first, history.end()));
+			}
+
+			CHECK(stats.full());
+			CHECK(stats.quantile(0.5).is_none());
+
+			stats.clear();
+			CHECK(stats.empty());
+			CHECK(stats.min().is_none());
+			stats.push(3_i32);
+			CHECK_EQ(stats.min().unwrap(), 3_i32);
+			CHECK_EQ(stats.max().unwrap(), 3_i32);
+			CHECK_EQ(stats.mean(), doctest::Approx(3.0));
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Quantiles") {
+			constexpr auto accuracy = QuantileSketch::DEFAULT_RELATIVE_ACCURACY;
+			auto stats = WindowedStats<f64>(1000_usize, QuantileTracking::Enabled);
+
+			// fill the window twice so the first 1000 samples have been evicted from the sketch
+			for(auto i = 1_usize; i <= 2000_usize; ++i) {
+				stats.push(static_cast<f64>(i));
+			}
+
+			// the window holds 1001..=2000
+			CHECK_EQ(stats.sketch().count(), 1000_u64);
+			const auto p50 = stats.quantile(0.5).unwrap();
+			const auto p99 = stats.quantile(0.99).unwrap();
+			CHECK_LE(std::abs(p50 - 1500.0) / 1500.0, accuracy + 1e-3);
+			CHECK_LE(std::abs(p99 - 1990.0) / 1990.0, accuracy + 1e-3);
+			CHECK_LE(std::abs(stats.quantile(0.0).unwrap() - 1001.0) / 1001.0, accuracy);
+			CHECK_LE(std::abs(stats.quantile(1.0).unwrap() - 2000.0) / 2000.0, accuracy);
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("SketchMerge") {
+			auto lhs = QuantileSketch();
+			auto rhs = QuantileSketch();
+			for(auto i = 1_i32; i <= 100_i32; ++i) {
+				lhs.add(static_cast<f64>(i));
+				rhs.add(static_cast<f64>(i + 100));
+			}
+
+			CHECK(lhs.merge(rhs).is_ok());
+			CHECK_EQ(lhs.count(), 200_u64);
+			const auto median = lhs.quantile(0.5).unwrap();
+			CHECK_LE(std::abs(median - 100.0) / 100.0, 0.02);
+
+			auto mismatched = QuantileSketch(0.05);
+			CHECK(lhs.merge(mismatched).is_err());
+
+			lhs.add(0.0);
+			lhs.add(-5.0);
+			CHECK_EQ(lhs.quantile(0.0).unwrap(), doctest::Approx(0.0));
+			lhs.remove(0.0);
+			lhs.remove(-5.0);
+			CHECK_EQ(lhs.count(), 200_u64);
+
+			lhs.clear();
+			CHECK(lhs.quantile(0.5).is_none());
+		}
+	}
+} // namespace hyperion
@@ -0,0 +1,195 @@
+/// @file ArenaAllocator.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for Arena, ArenaAllocator, and ThreadLocalArenaAllocator
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/LockFreeQueue.h>
+#include <Hyperion/RingBuffer.h>
+#include <Hyperion/SPSCQueue.h>
+#include <Hyperion/Testing.h>
+#include <Hyperion/memory/ArenaAllocator.h>
+#include <Hyperion/memory/UniquePtr.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hyperion {
+	// NOLINTNEXTLINE
+	TEST_SUITE("ArenaAllocator") {
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Arena") {
+			auto arena = Arena(256_usize);
+			CHECK_EQ(arena.reserved(), 0_usize);
+
+			auto* first = arena.allocate(3_usize, 1_usize);
+			auto* second = arena.allocate(8_usize, 64_usize);
+			CHECK_NE(first, nullptr);
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			CHECK_EQ(reinterpret_cast<std::uintptr_t>(second) % 64_usize, 0_usize);
+			CHECK_EQ(arena.allocated(), 11_usize);
+			const auto reserved = arena.reserved();
+			CHECK_GE(reserved, 256_usize);
+
+			SUBCASE("rollback") {
+				arena.deallocate(second, 8_usize);
+				CHECK_EQ(arena.allocated(), 3_usize);
+				CHECK_EQ(arena.allocate(8_usize, 64_usize), second);
+
+				// not the most recent allocation, so only reclaimed in bulk
+				arena.deallocate(first, 3_usize);
+				CHECK_EQ(arena.allocated(), 11_usize);
+			}
+
+			SUBCASE("growth") {
+				for(auto i = 0_usize; i < 64_usize; ++i) {
+					ignore(arena.allocate(100_usize));
+				}
+				CHECK_GT(arena.reserved(), reserved);
+
+				// larger than any block would be
+				auto* large = arena.allocate(Arena::MAX_BLOCK_SIZE * 2_usize);
+				CHECK_NE(large, nullptr);
+				CHECK_GE(arena.reserved(), Arena::MAX_BLOCK_SIZE * 2_usize);
+			}
+
+			SUBCASE("reset") {
+				for(auto i = 0_usize; i < 64_usize; ++i) {
+					ignore(arena.allocate(100_usize));
+				}
+				const auto before = arena.reserved();
+				arena.reset();
+				CHECK_EQ(arena.allocated(), 0_usize);
+				CHECK_GT(arena.reserved(), 0_usize);
+				CHECK_LT(arena.reserved(), before);
+
+				// the kept block is reused
+				const auto kept = arena.reserved();
+				ignore(arena.allocate(100_usize));
+				CHECK_EQ(arena.reserved(), kept);
+			}
+
+			SUBCASE("release") {
+				arena.release();
+				CHECK_EQ(arena.allocated(), 0_usize);
+				CHECK_EQ(arena.reserved(), 0_usize);
+				CHECK_NE(arena.allocate(16_usize), nullptr);
+			}
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Scopes") {
+			auto outer = Arena();
+			auto inner = Arena();
+			CHECK_EQ(&Arena::current(), &Arena::thread_local_arena());
+
+			{
+				const auto outer_scope = ArenaScope(outer);
+				CHECK_EQ(&Arena::current(), &outer);
+				{
+					const auto inner_scope = ArenaScope(inner);
+					CHECK_EQ(&ArenaAllocator<i32>().arena(), &inner);
+				}
+				CHECK_EQ(&ArenaAllocator<i32>().arena(), &outer);
+			}
+
+			CHECK_EQ(&Arena::current(), &Arena::thread_local_arena());
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("Containers") {
+			auto arena = Arena();
+
+			SUBCASE("RingBuffer") {
+				const auto scope = ArenaScope(arena);
+				auto buffer = RingBuffer<std::string, ArenaAllocator>(8_usize);
+				CHECK_GE(arena.allocated(), 8_usize * sizeof(std::string));
+
+				for(auto i = 0_i32; i < 20_i32; ++i) {
+					buffer.push_back(std::to_string(i));
+				}
+				CHECK_EQ(buffer.front(), "12");
+				CHECK_EQ(buffer.back(), "19");
+			}
+
+			SUBCASE("allocate_unique") {
+				auto allocator = ArenaAllocator<std::string>(arena);
+				{
+					auto value = std::string("arena allocated");
+					auto ptr = allocate_unique<std::string>(allocator, std::move(value));
+					CHECK_EQ(*ptr, "arena allocated");
+					CHECK_GE(arena.allocated(), sizeof(std::string));
+				}
+				// the deleter released the most recent allocation
+				CHECK_EQ(arena.allocated(), 0_usize);
+			}
+
+			SUBCASE("std::vector") {
+				auto values = std::vector<i32, ArenaAllocator<i32>>(ArenaAllocator<i32>(arena));
+				for(auto i = 0_i32; i < 1000_i32; ++i) {
+					values.push_back(i);
+				}
+				CHECK_EQ(values.size(), 1000_usize);
+				CHECK_EQ(values[999], 999_i32);
+				CHECK_GE(arena.allocated(), 1000_usize * sizeof(i32));
+			}
+
+			SUBCASE("equality") {
+				auto other = Arena();
+				CHECK(ArenaAllocator<i32>(arena) == ArenaAllocator<f64>(arena));
+				CHECK_FALSE(ArenaAllocator<i32>(arena) == ArenaAllocator<i32>(other));
+			}
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("ThreadLocal") {
+			static_assert(std::is_empty_v<ThreadLocalArenaAllocator<i32>>);
+			using Deleter = AllocatorAwareDeleter<i32, ThreadLocalArenaAllocator<i32>>;
+			static_assert(sizeof(UniquePtr<i32, Deleter>) == sizeof(i32*));
+
+			auto buffer = RingBuffer<i32, ThreadLocalArenaAllocator>(16_usize);
+			auto queue = LockFreeQueue<i32, ThreadLocalArenaAllocator>(16_u32);
+			auto spsc = SPSCQueue<i32, ThreadLocalArenaAllocator>(16_usize);
+			buffer.push_back(1_i32);
+			queue.push_back(2_i32);
+			spsc.push_back(3_i32);
+			CHECK_EQ(buffer.front(), 1_i32);
+			CHECK_EQ(queue.pop_front().unwrap(), 2_i32);
+			CHECK_EQ(spsc.pop_front().unwrap(), 3_i32);
+
+			auto* const main_arena = &Arena::thread_local_arena();
+			auto* other_arena = static_cast<Arena*>(nullptr);
+			auto value = 0_i32;
+			auto thread = std::thread([&other_arena, &value]() {
+				other_arena = &Arena::thread_local_arena();
+				auto ptr
+					= allocate_unique<i32>(ThreadLocalArenaAllocator<i32>(), 42_i32); // NOLINT
+				value = *ptr;
+			});
+			thread.join();
+
+			CHECK_NE(other_arena, main_arena);
+			CHECK_EQ(value, 42_i32);
+		}
+	}
+} // namespace hyperion
@@ -0,0 +1,145 @@
+/// @file LargePageAllocator.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for LargePages and LargePageAllocator
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/RingBuffer.h>
+#include <Hyperion/Testing.h>
+#include <Hyperion/memory/LargePageAllocator.h>
+#include <cstdint>
+#include <cstring>
+
+namespace hyperion {
+	// NOLINTNEXTLINE
+	TEST_SUITE("LargePageAllocator") {
+		static constexpr auto LARGE_SIZE = 4_usize * 1024_usize * 1024_usize;
+		static constexpr auto PAGE_ALIGNMENT = 4096_usize;
+
+		[[nodiscard]] static inline auto is_page_aligned(const void* ptr) noexcept -> bool {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+			return reinterpret_cast<std::uintptr_t>(ptr) % PAGE_ALIGNMENT == 0_usize;
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("LargePages") {
+			const auto options = LargePageOptions();
+			CHECK_FALSE(LargePages::is_mapped(64_usize, options));
+			CHECK(LargePages::is_mapped(LargePages::MIN_MAPPED_SIZE, options));
+			CHECK(LargePages::is_mapped(64_usize, LargePageOptions{.numa_node = 0_i32}));
+
+			SUBCASE("small") {
+				auto* ptr = LargePages::allocate(64_usize, options);
+				REQUIRE_NE(ptr, nullptr);
+				std::memset(ptr, 0xAB, 64_usize);
+				LargePages::deallocate(ptr, 64_usize, options);
+			}
+
+			SUBCASE("large") {
+				auto* ptr = LargePages::allocate(LARGE_SIZE, options);
+				REQUIRE_NE(ptr, nullptr);
+				CHECK(is_page_aligned(ptr));
+				std::memset(ptr, 0xAB, LARGE_SIZE);
+				CHECK_EQ(static_cast<unsigned char*>(ptr)[LARGE_SIZE - 1_usize], 0xAB);
+				LargePages::deallocate(ptr, LARGE_SIZE, options);
+			}
+
+			SUBCASE("explicit") {
+				// falls back to transparent huge pages when none are reserved
+				const auto explicit_options = LargePageOptions{.huge_pages = HugePages::Explicit};
+				auto* ptr = LargePages::allocate(LARGE_SIZE, explicit_options);
+				REQUIRE_NE(ptr, nullptr);
+				CHECK(is_page_aligned(ptr));
+				std::memset(ptr, 0xAB, LARGE_SIZE);
+				LargePages::deallocate(ptr, LARGE_SIZE, explicit_options);
+			}
+
+			SUBCASE("numa") {
+				const auto node = LargePages::current_numa_node();
+				CHECK_GE(node, LargePageOptions::ANY_NUMA_NODE);
+				CHECK_GE(LargePages::numa_node_of_cpu(0_usize), LargePageOptions::ANY_NUMA_NODE);
+
+				// binding is best-effort, so allocation succeeds even without NUMA support
+				const auto numa_options = LargePageOptions{
+					.huge_pages = HugePages::None,
+					.numa_node = node == LargePageOptions::ANY_NUMA_NODE ? 0_i32 : node};
+				auto* ptr = LargePages::allocate(256_usize, numa_options);
+				REQUIRE_NE(ptr, nullptr);
+				CHECK(is_page_aligned(ptr));
+				std::memset(ptr, 0xAB, 256_usize);
+				LargePages::deallocate(ptr, 256_usize, numa_options);
+			}
+
+			SUBCASE("null") {
+				LargePages::deallocate(nullptr, LARGE_SIZE, options);
+			}
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("LargePageScope") {
+			const auto outer = LargePageOptions{.huge_pages = HugePages::None};
+			const auto inner = LargePageOptions{.numa_node = 0_i32};
+			CHECK_EQ(LargePages::current_options(), LargePageOptions());
+			{
+				const auto outer_scope = LargePageScope(outer);
+				CHECK_EQ(LargePageAllocator<u64>().options(), outer);
+				{
+					const auto inner_scope = LargePageScope(inner);
+					CHECK_EQ(LargePageAllocator<u64>().options(), inner);
+				}
+				CHECK_EQ(LargePages::current_options(), outer);
+			}
+			CHECK_EQ(LargePages::current_options(), LargePageOptions());
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("LargePageAllocator") {
+			auto allocator = LargePageAllocator<u64>();
+			const auto numa_allocator
+				= LargePageAllocator<u64>(LargePageOptions{.numa_node = 0_i32});
+			CHECK_EQ(allocator, LargePageAllocator<u32>());
+			CHECK_NE(allocator, numa_allocator);
+			CHECK_EQ(LargePageAllocator<u32>(numa_allocator).options(), numa_allocator.options());
+
+			static constexpr auto COUNT = LARGE_SIZE / sizeof(u64);
+			auto* ptr = allocator.allocate(COUNT);
+			REQUIRE_NE(ptr, nullptr);
+			CHECK(is_page_aligned(ptr));
+			for(auto i = 0_usize; i < COUNT; ++i) {
+				ptr[i] = i; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+			}
+			CHECK_EQ(ptr[COUNT - 1_usize], COUNT - 1_usize); // NOLINT
+			allocator.deallocate(ptr, COUNT);
+
+			SUBCASE("RingBuffer") {
+				auto buffer = RingBuffer<u64, LargePageAllocator>(COUNT);
+				for(auto i = 0_usize; i < COUNT + 10_usize; ++i) {
+					buffer.push_back(i);
+				}
+				CHECK_EQ(buffer.size(), COUNT);
+				CHECK_EQ(buffer.front(), 10_usize);
+				CHECK_EQ(buffer.back(), COUNT + 9_usize);
+			}
+		}
+	}
+} // namespace hyperion
@@ -0,0 +1,142 @@
+/// @file ObjectPool.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for ObjectPool
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Testing.h>
+#include <Hyperion/memory/ObjectPool.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace hyperion {
+	namespace detail::object_pool::test {
+		/// @brief Counts live instances, so tests can check the pool destroys what it creates
+		class Counted {
+		  public:
+			static inline std::atomic<i64> s_live = 0; // NOLINT
+
+			explicit Counted(usize value) noexcept : m_value(value) {
+				s_live.fetch_add(1, std::memory_order_relaxed);
+			}
+			Counted(const Counted&) = delete;
+			Counted(Counted&&) = delete;
+			~Counted() noexcept {
+				s_live.fetch_sub(1, std::memory_order_relaxed);
+			}
+			auto operator=(const Counted&) -> Counted& = delete;
+			auto operator=(Counted&&) -> Counted& = delete;
+
+			[[nodiscard]] auto value() const noexcept -> usize {
+				return m_value;
+			}
+
+		  private:
+			usize m_value;
+		};
+	} // namespace detail::object_pool::test
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("ObjectPool") {
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("SingleThreaded") {
+			using detail::object_pool::test::Counted;
+			constexpr auto capacity = 4_usize;
+			auto pool = ObjectPool<Counted>(capacity);
+			CHECK_EQ(pool.capacity(), capacity);
+
+			{
+				auto objects = std::vector<PooledPtr<Counted>>();
+				for(auto i = 0_usize; i < capacity; ++i) {
+					auto object = pool.make(i);
+					REQUIRE_NE(object, nullptr);
+					CHECK(pool.owns(object.get()));
+					CHECK_EQ(object.get_deleter().pool(), &pool);
+					objects.push_back(std::move(object));
+				}
+				CHECK_EQ(Counted::s_live.load(), static_cast<i64>(capacity));
+
+				// exhausted
+				CHECK_EQ(pool.make(42_usize), nullptr);
+
+				// returning an object frees its slot for reuse
+				auto* const slot = objects.back().get();
+				objects.pop_back();
+				CHECK_EQ(Counted::s_live.load(), static_cast<i64>(capacity - 1));
+				auto reused = pool.make(42_usize);
+				CHECK_EQ(reused.get(), slot);
+				CHECK_EQ(reused->value(), 42_usize);
+
+				for(auto i = 0_usize; i < objects.size(); ++i) {
+					CHECK_EQ(objects[i]->value(), i);
+				}
+			}
+			CHECK_EQ(Counted::s_live.load(), 0_i64);
+
+			auto unrelated = Counted(0_usize);
+			CHECK_FALSE(pool.owns(&unrelated));
+		}
+
+		TEST_CASE("MultiThreaded") {
+			using detail::object_pool::test::Counted;
+			constexpr auto num_threads = 4_usize;
+			constexpr auto iterations = 20000_usize;
+			constexpr auto capacity = 8_usize;
+			auto pool = ObjectPool<Counted>(capacity);
+			auto corrupted = std::atomic<bool>(false);
+
+			auto threads = std::vector<std::thread>();
+			for(auto thread = 0_usize; thread < num_threads; ++thread) {
+				threads.emplace_back([&pool, &corrupted, thread]() {
+					for(auto i = 0_usize; i < iterations; ++i) {
+						const auto value = thread * iterations + i;
+						auto first = pool.make(value);
+						auto second = pool.make(value + 1);
+						if((first != nullptr && first->value() != value)
+						   || (second != nullptr && second->value() != value + 1)
+						   || (first != nullptr && first.get() == second.get()))
+						{
+							corrupted.store(true);
+						}
+					}
+				});
+			}
+
+			for(auto& thread : threads) {
+				thread.join();
+			}
+
+			CHECK_FALSE(corrupted.load());
+			CHECK_EQ(Counted::s_live.load(), 0_i64);
+
+			// every slot made it back onto the free list
+			auto objects = std::vector<PooledPtr<Counted>>();
+			for(auto i = 0_usize; i < capacity; ++i) {
+				objects.push_back(pool.make(i));
+				CHECK_NE(objects.back(), nullptr);
+			}
+			CHECK_EQ(pool.make(0_usize), nullptr);
+		}
+	}
+} // namespace hyperion
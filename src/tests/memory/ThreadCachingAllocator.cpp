@@ -0,0 +1,174 @@
+/// @file ThreadCachingAllocator.cpp
+/// @author Braxton Salyer <braxtonsalyer@gmail.com>
+/// @brief Tests for ThreadCache, ThreadCachingHeap, and ThreadCachingAllocator
+/// @version 0.1
+/// @date 2026-10-18
+///
+/// MIT License
+/// @copyright Copyright (c) 2026 Braxton Salyer <braxtonsalyer@gmail.com>
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to
+/// deal in the Software without restriction, including without limitation the
+/// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+/// sell copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+/// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+#include <Hyperion/Testing.h>
+#include <Hyperion/memory/ThreadCachingAllocator.h>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace hyperion {
+
+	// NOLINTNEXTLINE
+	TEST_SUITE("ThreadCachingAllocator") {
+		TEST_CASE("SizeClasses") {
+			auto previous = 0_usize;
+			for(auto size = 0_usize; size <= ThreadCache::MAX_BLOCK_SIZE; ++size) {
+				const auto size_class = ThreadCache::size_class_of(size);
+				REQUIRE_LT(size_class, ThreadCache::NUM_SIZE_CLASSES);
+				CHECK_GE(size_class, previous);
+				CHECK_GE(ThreadCache::class_size(size_class), size);
+				if(size_class > 0_usize) {
+					CHECK_LT(ThreadCache::class_size(size_class - 1), size);
+				}
+				previous = size_class;
+			}
+
+			for(auto size_class = 0_usize; size_class < ThreadCache::NUM_SIZE_CLASSES;
+				++size_class) {
+				CHECK_EQ(ThreadCache::class_size(size_class) % ThreadCache::BLOCK_ALIGNMENT,
+						 0_usize);
+			}
+		}
+
+		// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+		TEST_CASE("ThreadCache") {
+			auto cache = ThreadCache();
+
+			SUBCASE("LocalReuse") {
+				auto* first = cache.allocate(40_usize);
+				auto* second = cache.allocate(48_usize);
+				CHECK_NE(first, second);
+				CHECK_EQ(ThreadCache::owner_of(first), &cache);
+				CHECK_EQ(ThreadCache::owner_of(second), &cache);
+				CHECK_EQ(reinterpret_cast<std::uintptr_t>(first) // NOLINT
+							 % ThreadCache::BLOCK_ALIGNMENT,
+						 0_usize);
+
+				cache.deallocate(first, 40_usize);
+				CHECK_EQ(cache.allocate(33_usize), first);
+				cache.deallocate(first, 40_usize);
+				cache.deallocate(second, 48_usize);
+			}
+
+			SUBCASE("RemoteFree") {
+				constexpr auto size = 200_usize;
+				auto* block = cache.allocate(size);
+				static_cast<char*>(block)[size - 1] = 'a'; // NOLINT
+
+				auto thread = std::thread([block]() { ThreadCache::deallocate_remote(block); });
+				thread.join();
+
+				// the local free list is empty, so the remote free is reclaimed
+				CHECK_EQ(cache.allocate(size), block);
+				cache.deallocate(block, size);
+			}
+
+			SUBCASE("SpanOverflow") {
+				constexpr auto size = ThreadCache::MAX_BLOCK_SIZE;
+				constexpr auto count = 3_usize * ThreadCache::SPAN_SIZE / size;
+				auto blocks = std::vector<void*>();
+				for(auto i = 0_usize; i < count; ++i) {
+					blocks.push_back(cache.allocate(size));
+					std::memset(blocks.back(), static_cast<int>(i), size);
+				}
+
+				for(auto i = 0_usize; i < count; ++i) {
+					CHECK_EQ(static_cast<unsigned char*>(blocks[i])[size - 1], // NOLINT
+							 static_cast<unsigned char>(i));
+					cache.deallocate(blocks[i], size);
+				}
+			}
+		}
+
+		TEST_CASE("ThreadCachingAllocator") {
+			SUBCASE("SmallAndLarge") {
+				auto small = std::vector<u64, ThreadCachingAllocator<u64>>(8_usize, 42_u64);
+				auto large = std::vector<u64, ThreadCachingAllocator<u64>>(4096_usize, 42_u64);
+				CHECK_EQ(small.back(), 42_u64);
+				CHECK_EQ(large.back(), 42_u64);
+				CHECK(ThreadCachingHeap::current_cache() != nullptr);
+			}
+
+			SUBCASE("OverAligned") {
+				struct alignas(64) Aligned { // NOLINT
+					u64 m_value;
+				};
+				auto values = std::vector<Aligned, ThreadCachingAllocator<Aligned>>(3_usize);
+				CHECK_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % 64_usize, // NOLINT
+						 0_usize);
+			}
+
+			SUBCASE("CrossThreadFree") {
+				using String = std::basic_string<char,
+												 std::char_traits<char>,
+												 ThreadCachingAllocator<char>>;
+				constexpr auto num_threads = 4_usize;
+				constexpr auto strings_per_thread = 2000_usize;
+
+				auto mutex = std::mutex();
+				auto strings = std::vector<String>();
+				auto threads = std::vector<std::thread>();
+				for(auto thread = 0_usize; thread < num_threads; ++thread) {
+					threads.emplace_back([&mutex, &strings, thread]() {
+						for(auto i = 0_usize; i < strings_per_thread; ++i) {
+							auto string = String(32_usize + i % 300_usize, 'a');
+							string += std::to_string(thread);
+							const auto lock = std::scoped_lock(mutex);
+							strings.push_back(std::move(string));
+						}
+					});
+				}
+
+				// free strings on this thread while the producers are still allocating
+				auto checked = 0_usize;
+				auto failures = 0_usize;
+				while(checked < num_threads * strings_per_thread) {
+					auto batch = std::vector<String>();
+					{
+						const auto lock = std::scoped_lock(mutex);
+						batch.swap(strings);
+					}
+					for(auto& string : batch) {
+						if(string.front() != 'a' || string.back() < '0'
+						   || string.back() >= static_cast<char>('0' + num_threads))
+						{
+							++failures;
+						}
+					}
+					checked += batch.size();
+				}
+
+				for(auto& thread : threads) {
+					thread.join();
+				}
+				CHECK_EQ(failures, 0_usize);
+			}
+		}
+	}
+} // namespace hyperion
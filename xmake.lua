@@ -78,6 +78,15 @@ option("hyperion_tracy_enable")
 add_defines(TRACY_ENABLE)
 option_end()
 
+-- `Err` and `Result` change layout with the error origin mode, so it's configured once, here,
+-- and propagated to everything using hyperion-utils, never per translation unit
+option("hyperion_result_error_origin")
+set_default("off")
+set_showmenu(true)
+set_values("off", "location", "backtrace")
+set_description("Whether Err and Result record where errors originated")
+option_end()
+
 local setup_compile_flags = function(target)
     if target:has_tool("cxx", "cl", "clang_cl") then
         target:add("cxflags", "/Zc:preprocessor", { public = true })
@@ -138,6 +147,7 @@ end
 local hyperion_utils_error_headers = {
     "$(projectdir)/include/Hyperion/error/Assert.h",
     "$(projectdir)/include/Hyperion/error/Backtrace.h",
+    "$(projectdir)/include/Hyperion/error/CrashReporter.h",
     "$(projectdir)/include/Hyperion/error/GenericDomain.h",
     "$(projectdir)/include/Hyperion/error/NTDomain.h",
     "$(projectdir)/include/Hyperion/error/Panic.h",
@@ -154,12 +164,20 @@ local hyperion_utils_fs_headers = {
 local hyperion_utils_logging_headers = {
     "$(projectdir)/include/Hyperion/logging/Queue.h",
     "$(projectdir)/include/Hyperion/logging/Config.h",
+    "$(projectdir)/include/Hyperion/logging/Context.h",
     "$(projectdir)/include/Hyperion/logging/Entry.h",
+    "$(projectdir)/include/Hyperion/logging/LevelRegistry.h",
     "$(projectdir)/include/Hyperion/logging/Sink.h",
+    "$(projectdir)/include/Hyperion/logging/SinkGroup.h",
+    "$(projectdir)/include/Hyperion/logging/Thread.h",
 }
 local hyperion_utils_memory_headers = {
+    "$(projectdir)/include/Hyperion/memory/ArenaAllocator.h",
     "$(projectdir)/include/Hyperion/memory/CompressedPair.h",
     "$(projectdir)/include/Hyperion/memory/EmptyBaseClass.h",
+    "$(projectdir)/include/Hyperion/memory/LargePageAllocator.h",
+    "$(projectdir)/include/Hyperion/memory/ObjectPool.h",
+    "$(projectdir)/include/Hyperion/memory/ThreadCachingAllocator.h",
     "$(projectdir)/include/Hyperion/memory/UniquePtr.h",
 }
 local hyperion_utils_mpl_headers = {
@@ -173,14 +191,20 @@ local hyperion_utils_mpl_headers = {
 local hyperion_utils_enum_headers = {
     "$(projectdir)/include/Hyperion/enum/detail.h",
 }
+local hyperion_utils_ringbuffer_headers = {
+    "$(projectdir)/include/Hyperion/ringbuffer/detail.h",
+}
 local hyperion_utils_option_headers = {
+    "$(projectdir)/include/Hyperion/option/Niche.h",
     "$(projectdir)/include/Hyperion/option/None.h",
     "$(projectdir)/include/Hyperion/option/SomeFWD.h",
     "$(projectdir)/include/Hyperion/option/OptionData.h",
 }
 local hyperion_utils_result_headers = {
     "$(projectdir)/include/Hyperion/result/Ok.h",
+    "$(projectdir)/include/Hyperion/result/Collect.h",
     "$(projectdir)/include/Hyperion/result/Err.h",
+    "$(projectdir)/include/Hyperion/result/ErrorOrigin.h",
     "$(projectdir)/include/Hyperion/result/ResultData.h",
 }
 local hyperion_utils_sync_headers = {
@@ -202,32 +226,55 @@ local hyperion_utils_main_headers = {
     "$(projectdir)/include/Hyperion/Logger.h",
     "$(projectdir)/include/Hyperion/Memory.h",
     "$(projectdir)/include/Hyperion/MPL.h",
+    "$(projectdir)/include/Hyperion/NonZero.h",
     "$(projectdir)/include/Hyperion/Option.h",
     "$(projectdir)/include/Hyperion/Platform.h",
     "$(projectdir)/include/Hyperion/Result.h",
     "$(projectdir)/include/Hyperion/RingBuffer.h",
+    "$(projectdir)/include/Hyperion/SPSCQueue.h",
     "$(projectdir)/include/Hyperion/Span.h",
+    "$(projectdir)/include/Hyperion/StaticLockFreeQueue.h",
+    "$(projectdir)/include/Hyperion/StaticRingBuffer.h",
     "$(projectdir)/include/Hyperion/Synchronization.h",
     "$(projectdir)/include/Hyperion/Testing.h",
     "$(projectdir)/include/Hyperion/TypeTraits.h",
     "$(projectdir)/include/Hyperion/Utils.h",
+    "$(projectdir)/include/Hyperion/WindowedStats.h",
 }
 
 local hyperion_utils_sources = {
+    "$(projectdir)/src/error/Backtrace.cpp",
+    "$(projectdir)/src/error/CrashReporter.cpp",
     "$(projectdir)/src/error/Panic.cpp",
     "$(projectdir)/src/filesystem/File.cpp",
     "$(projectdir)/src/Logger.cpp",
+    "$(projectdir)/src/logging/LevelRegistry.cpp",
     "$(projectdir)/src/logging/Sink.cpp",
+    "$(projectdir)/src/logging/Thread.cpp",
+    "$(projectdir)/src/memory/LargePages.cpp",
 }
 
 local hyperion_utils_test_sources = {
     "$(projectdir)/src/tests/doctest_main.cpp",
     "$(projectdir)/src/tests/ChangeDetector.cpp",
+    "$(projectdir)/src/tests/Collect.cpp",
     "$(projectdir)/src/tests/Enum.cpp",
+    "$(projectdir)/src/tests/Error.cpp",
+    "$(projectdir)/src/tests/ErrorOrigin.cpp",
     "$(projectdir)/src/tests/LockFreeQueue.cpp",
+    "$(projectdir)/src/tests/Logger.cpp",
     "$(projectdir)/src/tests/Option.cpp",
+    "$(projectdir)/src/tests/Panic.cpp",
     "$(projectdir)/src/tests/Result.cpp",
     "$(projectdir)/src/tests/RingBuffer.cpp",
+    "$(projectdir)/src/tests/SPSCQueue.cpp",
+    "$(projectdir)/src/tests/StaticLockFreeQueue.cpp",
+    "$(projectdir)/src/tests/StaticRingBuffer.cpp",
+    "$(projectdir)/src/tests/WindowedStats.cpp",
+    "$(projectdir)/src/tests/memory/ArenaAllocator.cpp",
+    "$(projectdir)/src/tests/memory/LargePageAllocator.cpp",
+    "$(projectdir)/src/tests/memory/ObjectPool.cpp",
+    "$(projectdir)/src/tests/memory/ThreadCachingAllocator.cpp",
     "$(projectdir)/src/tests/memory/UniquePtr.cpp",
 }
 
@@ -241,6 +288,7 @@ add_headerfiles(hyperion_utils_logging_headers, { prefixdir = "Hyperion/logging"
 add_headerfiles(hyperion_utils_memory_headers, { prefixdir = "Hyperion/memory" })
 add_headerfiles(hyperion_utils_mpl_headers, { prefixdir = "Hyperion/mpl" })
 add_headerfiles(hyperion_utils_enum_headers, { prefixdir = "Hyperion/enum" })
+add_headerfiles(hyperion_utils_ringbuffer_headers, { prefixdir = "Hyperion/ringbuffer" })
 add_headerfiles(hyperion_utils_option_headers, { prefixdir = "Hyperion/option" })
 add_headerfiles(hyperion_utils_result_headers, { prefixdir = "Hyperion/result" })
 add_headerfiles(hyperion_utils_sync_headers, { prefixdir = "Hyperion/synchronization" })
@@ -251,6 +299,11 @@ if not is_plat("windows") then
 end
 set_default(true)
 add_options("hyperion_tracy_enable")
+if get_config("hyperion_result_error_origin") == "backtrace" then
+    add_defines("HYPERION_RESULT_CAPTURES_ERROR_BACKTRACE=true", { public = true })
+elseif get_config("hyperion_result_error_origin") == "location" then
+    add_defines("HYPERION_RESULT_TRACKS_ERROR_ORIGIN=true", { public = true })
+end
 on_config(function(target)
     setup_compile_flags(target)
     setup_link_libs(target)
@@ -284,6 +337,48 @@ on_config(function(target)
 end)
 target_end()
 
+target("hyperion-utils-allocator-benchmark")
+set_kind("binary")
+add_includedirs("$(projectdir)/include", { public = false })
+add_files(hyperion_utils_sources)
+add_files("src/benchmarks/Allocators.cpp")
+add_deps("hyperion-utils")
+add_defines("DOCTEST_CONFIG_DISABLE")
+set_default(false)
+on_config(function(target)
+    setup_compile_flags(target)
+    setup_link_libs(target)
+end)
+target_end()
+
+target("hyperion-utils-result-benchmark")
+set_kind("binary")
+add_includedirs("$(projectdir)/include", { public = false })
+add_files(hyperion_utils_sources)
+add_files("src/benchmarks/Results.cpp")
+add_deps("hyperion-utils")
+add_defines("DOCTEST_CONFIG_DISABLE")
+set_default(false)
+on_config(function(target)
+    setup_compile_flags(target)
+    setup_link_libs(target)
+end)
+target_end()
+
+target("hyperion-utils-error-benchmark")
+set_kind("binary")
+add_includedirs("$(projectdir)/include", { public = false })
+add_files(hyperion_utils_sources)
+add_files("src/benchmarks/ErrorPaths.cpp")
+add_deps("hyperion-utils")
+add_defines("DOCTEST_CONFIG_DISABLE")
+set_default(false)
+on_config(function(target)
+    setup_compile_flags(target)
+    setup_link_libs(target)
+end)
+target_end()
+
 target("hyperion-utils-docs")
 set_kind("phony")
 set_default(false)
@@ -312,6 +407,7 @@ local total_files = #hyperion_utils_main_headers
     + #hyperion_utils_memory_headers
     + #hyperion_utils_mpl_headers
     + #hyperion_utils_enum_headers
+    + #hyperion_utils_ringbuffer_headers
     + #hyperion_utils_option_headers
     + #hyperion_utils_result_headers
     + #hyperion_utils_sync_headers
@@ -327,6 +423,7 @@ add_files(hyperion_utils_logging_headers, { prefixdir = "Hyperion/logging", rule
 add_files(hyperion_utils_memory_headers, { prefixdir = "Hyperion/memory", rule = "clang-tidy-source" })
 add_files(hyperion_utils_mpl_headers, { prefixdir = "Hyperion/mpl", rule = "clang-tidy-source" })
 add_files(hyperion_utils_enum_headers, { prefixdir = "Hyperion/enum", rule = "clang-tidy-source" })
+add_files(hyperion_utils_ringbuffer_headers, { prefixdir = "Hyperion/ringbuffer", rule = "clang-tidy-source" })
 add_files(hyperion_utils_option_headers, { prefixdir = "Hyperion/option", rule = "clang-tidy-source" })
 add_files(hyperion_utils_result_headers, { prefixdir = "Hyperion/result", rule = "clang-tidy-source" })
 add_files(hyperion_utils_sync_headers, { prefixdir = "Hyperion/synchronization", rule = "clang-tidy-source" })